@@ -26,6 +26,37 @@
 #define CO_SDOS_N               1
 #endif
 
+/*! \brief DEFAULT SDO BLOCK SIZE
+*
+*    This configuration define specifies the default number of segments
+*    per block (1..127) for SDO block transfers of each SDO server.
+*/
+#ifndef CO_SDO_BUF_SEG
+#define CO_SDO_BUF_SEG        127
+#endif
+
+/*! \brief DEFAULT SDO TRANSFER BUFFER
+*
+*    This configuration define specifies the transfer buffer size in byte
+*    for each SDO server. The default buffer holds a single block of the
+*    configured block size. Set this define to (CO_SDO_BUF_SEG*7*2) to
+*    enable double buffering: the block upload reads the next block from
+*    the object while the current block is transmitted.
+*/
+#ifndef CO_SDO_BUF_BYTE
+#define CO_SDO_BUF_BYTE       (CO_SDO_BUF_SEG*7)
+#endif
+
+/*! \brief DEFAULT SDO OBJECT CACHE
+*
+*    This configuration define specifies how many resolved object entries
+*    each SDO server keeps for repeated requests to the same objects. Set
+*    this define to 0 to disable the object cache.
+*/
+#ifndef CO_SDO_CACHE_N
+#define CO_SDO_CACHE_N          4
+#endif
+
 /*! \brief DEFAULT EMERGENCY CODES
 *
 *    This configuration define specifies how many emergency codes the library
@@ -35,6 +66,27 @@
 #define CO_EMCY_N              32
 #endif
 
+/*! \brief DEFAULT EMERGENCY TRANSMIT QUEUE
+*
+*    This configuration define specifies how many EMCY messages the library
+*    will hold back while the EMCY inhibit time (1015h) is running. Further
+*    EMCY messages are dropped and counted as lost.
+*/
+#ifndef CO_EMCY_QUEUE_N
+#define CO_EMCY_QUEUE_N         8
+#endif
+
+/*! \brief DEFAULT EMERGENCY COALESCING
+*
+*    This configuration define enables (=1) or disables (=0) the coalescing
+*    of EMCY messages: when an error changes back to its previous state
+*    while the opposite EMCY message is still waiting in the transmit queue,
+*    both messages are discarded.
+*/
+#ifndef CO_EMCY_COALESCE
+#define CO_EMCY_COALESCE        1
+#endif
+
 /*! \brief DEFAULT RECEIVE PDO
 *
 *    This configuration define specifies how many receive PDOs the library
@@ -53,5 +105,90 @@
 #define CO_TPDO_N               4
 #endif
 
+/*! \brief DEFAULT PDO MAPPING ENTRIES
+*
+*    This configuration define specifies how many mapping entries the library
+*    will support per PDO. With bit-granular mapping entries, up to 64
+*    entries (e.g. 64 digital signals of 1 bit) fit into a single PDO.
+*/
+#ifndef CO_PDO_MAP_N
+#define CO_PDO_MAP_N            8
+#endif
+
+/*! \brief DEFAULT RPDO SNAPSHOTS
+*
+*    This configuration define enables (=1) or disables (=0) the consistent
+*    snapshots of received PDOs: each RPDO holds a sequence counter, which
+*    allows the application to read all mapped objects of a received PDO
+*    without locks while the receive path runs on a separate core.
+*/
+#ifndef CO_RPDO_SNAPSHOT
+#define CO_RPDO_SNAPSHOT        0
+#endif
+
+/*! \brief DEFAULT SNAPSHOT READ RETRIES
+*
+*    This configuration define limits the number of attempts to read a
+*    consistent RPDO snapshot, while the receive path writes the RPDO.
+*/
+#ifndef CO_RPDO_RETRY
+#define CO_RPDO_RETRY         100
+#endif
+
+/*! \brief DEFAULT PDO PROCESS IMAGE
+*
+*    This configuration define enables (=1) or disables (=0) the process
+*    image of the PDO mapped objects (see co_pimg.h), which may be placed
+*    in memory shared with other processes. The file co_pimg.c must be
+*    part of the build, when enabled.
+*/
+#ifndef CO_PDO_PIMG
+#define CO_PDO_PIMG             0
+#endif
+
+/*! \brief DEFAULT MEMORY BARRIER
+*
+*    This configuration define specifies the memory barrier, which orders
+*    the accesses to data against their sequence counters (RPDO snapshots
+*    and process image) and against the state of the parameter store task.
+*    The defaults are the full barrier of GCC compatible compilers and
+*    MemoryBarrier() of MSVC (declared in <windows.h>). Other toolchains
+*    must define the barrier (e.g. __DMB() with CMSIS) when these features
+*    are used; without a barrier, the parameter store task must run on the
+*    core of the node processing.
+*/
+#ifndef CO_BARRIER
+#if defined(__GNUC__)
+#define CO_BARRIER()            __sync_synchronize()
+#elif defined(_MSC_VER)
+#define CO_BARRIER()            MemoryBarrier()
+#endif
+#endif
+
+#if ((CO_RPDO_SNAPSHOT > 0) || (CO_PDO_PIMG > 0)) && !defined(CO_BARRIER)
+#error "CO_RPDO_SNAPSHOT and CO_PDO_PIMG need the memory barrier CO_BARRIER() for this toolchain"
+#endif
+
+/*! \brief DEFAULT PARAMETER CHANGE TRACKING
+*
+*    This configuration define specifies for how many parameter groups
+*    (0x1010 subindex 1 and following) the changed range is tracked. A
+*    store skips tracked parameter groups without changes; the application
+*    reports direct changes of parameter values with COParaChanged().
+*    Parameter groups without tracking are always stored. Set this define
+*    to 0 to disable the change tracking.
+*/
+#ifndef CO_PARA_TRACK_N
+#define CO_PARA_TRACK_N         0
+#endif
+
+/*! \brief DEFAULT NMT BOOT SDO TIMEOUT
+*
+*    This configuration define specifies the time in ms, which the NMT boot
+*    engine waits for the SDO response of a slave.
+*/
+#ifndef CO_NMT_BOOT_TIMEOUT
+#define CO_NMT_BOOT_TIMEOUT   500
+#endif
 
 #endif  /* #ifndef CO_CFG_H_ */
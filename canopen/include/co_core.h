@@ -27,15 +27,21 @@
 #include "co_dict.h"
 #include "co_if.h"
 #include "co_emcy.h"
+#include "co_emcy_cons.h"
 #include "co_nmt.h"
+#include "co_nmt_mst.h"
+#include "co_nmt_boot.h"
 #include "co_tmr.h"
 #include "co_sdo_srv.h"
 #include "co_pdo.h"
 #include "co_sync.h"
 #include "co_lss.h"
+#include "co_lss_mst.h"
 #include "co_err.h"
 #include "co_obj.h"
 #include "co_para.h"
+#include "co_para_log.h"
+#include "co_pimg.h"
 
 /******************************************************************************
 * PUBLIC TYPES
@@ -56,9 +62,14 @@ typedef struct CO_NODE_T {
     uint8_t               *SdoBuf;               /*!< SDO Transfer Buffer    */
     struct CO_RPDO_T       RPdo[CO_RPDO_N];      /*!< RPDO Array             */
     struct CO_TPDO_T       TPdo[CO_TPDO_N];      /*!< TPDO Array             */
-    struct CO_TPDO_LINK_T  TMap[CO_TPDO_N * 8];  /*!< TPDO mapping links     */
+    struct CO_TPDO_LINK_T  TMap[CO_TPDO_N * CO_PDO_MAP_N]; /*!< TPDO mapping links */
     struct CO_SYNC_T       Sync;                 /*!< SYNC management        */
     struct CO_LSS_T        Lss;                  /*!< LSS slave handling     */
+    struct CO_PARA_TASK_T *ParaTask;             /*!< parameter store task   */
+    struct CO_SDO_T       *SdoDefer;             /*!< SDO server in download */
+#if CO_PDO_PIMG > 0
+    struct CO_PIMG_T      *Pimg;                 /*!< process image          */
+#endif
     enum   CO_ERR_T        Error;                /*!< detected error code    */
     uint32_t               Baudrate;             /*!< default CAN baudrate   */
     uint8_t                NodeId;               /*!< default Node-ID        */
@@ -80,6 +91,7 @@ typedef struct CO_NODE_SPEC_T {
     uint16_t               TmrNum;       /*!< number of timer memory blocks  */
     CO_IF_DRV              CanDrv;       /*!< linked CAN bus driver          */
     uint8_t               *SdoBuf;       /*!< SDO Transfer Buffer Memory     */
+    uintptr_t             *DictVal;      /*!< values of direct objects (opt.) */
 
 } CO_NODE_SPEC;
 
@@ -22,6 +22,13 @@
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_DICT_IMG_HDR   7     /*!< header bytes of a parameter image record */
 
 /******************************************************************************
 * PUBLIC TYPES
@@ -29,7 +36,48 @@
 
 struct CO_NODE_T;
 struct CO_OBJ_T;
+struct CO_DICT_SUB_T;
     
+/*! \brief OBJECT CHANGE CALLBACK
+*
+*    This type specifies the callback function prototype, which is called
+*    for each changed object entry within the key range of a subscription.
+*/
+typedef void (*CO_DICT_SUB_FUNC)(struct CO_DICT_SUB_T *sub, struct CO_NODE_T *node, struct CO_OBJ_T *obj);
+
+/*! \brief OBJECT CHANGE SUBSCRIPTION
+*
+*    This structure holds all data, which are needed for the notification
+*    of value changes of the object entries within a key range. The
+*    structure is allocated by the application and managed by the object
+*    dictionary.
+*/
+typedef struct CO_DICT_SUB_T {
+    struct CO_DICT_SUB_T *Next;     /*!< next subscription in list           */
+    uint32_t              First;    /*!< first key of range (CO_DEV)         */
+    uint32_t              Last;     /*!< last key of range (CO_DEV)          */
+    CO_DICT_SUB_FUNC      Func;     /*!< callback function                   */
+
+} CO_DICT_SUB;
+
+/*! \brief PARAMETER GROUP CHANGE STATE
+*
+*    This structure holds the changed range of a tracked parameter group.
+*    The members DirtyStart and DirtyEnd hold the range of the parameter
+*    memory block, which is changed since the last load or store. A store
+*    takes this range into the members SaveStart and SaveEnd and clears it,
+*    therefore changes during a store in a background task are kept for
+*    the next store.
+*/
+typedef struct CO_DICT_PARA_T {
+    uint32_t          DirtyStart; /*!< Start of changed range                */
+    uint32_t          DirtyEnd;   /*!< End of changed range (0 = none)       */
+    uint32_t          Stored;     /*!< Bytes of changed range at last store  */
+    uint32_t          SaveStart;  /*!< Start of range in running store       */
+    uint32_t          SaveEnd;    /*!< End of range in running store         */
+
+} CO_DICT_PARA;
+
 /*! \brief OBJECT dictionary
 *
 *    This data structure holds all informations, which represents the
@@ -40,6 +88,14 @@ typedef struct CO_DICT_T {
     struct CO_OBJ_T  *Root;     /*!< Ptr to root object of dictionary        */
     uint16_t          Num;      /*!< Current number of objects in dictionary */
     uint16_t          Max;      /*!< Maximal number of objects in dictionary */
+    uint16_t          Gen;      /*!< Generation, changed with object entries */
+    struct CO_OBJ_T  *Para;     /*!< Ptr to first parameter group object     */
+    uint8_t           ParaNum;  /*!< Number of parameter group objects       */
+#if CO_PARA_TRACK_N > 0
+    CO_DICT_PARA      ParaState[CO_PARA_TRACK_N]; /*!< tracked changes       */
+#endif
+    uintptr_t        *Val;      /*!< Ptr to values of direct objects (opt.)  */
+    struct CO_DICT_SUB_T *Sub;  /*!< Ptr to first change subscription        */
 
 } CO_DICT;
 
@@ -122,6 +178,46 @@ int16_t CODictRdWord(CO_DICT *cod, uint32_t key, uint16_t *val);
 */
 int16_t CODictRdLong(CO_DICT *cod, uint32_t key, uint32_t *val);
 
+/*! \brief  READ QUAD FROM OBJECT DICTIONARY
+*
+*    This function reads a 64bit value from the given object dictionary.
+*    The object entry is addressed with the given key and the value will
+*    be written to the given destination pointer.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param val
+*    pointer to the value destination
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictRdQuad(CO_DICT *cod, uint32_t key, uint64_t *val);
+
+/*! \brief  READ DOUBLE FROM OBJECT DICTIONARY
+*
+*    This function reads a 64bit floating point value (REAL64) from the
+*    given object dictionary. The object entry is addressed with the given
+*    key and the value will be written to the given destination pointer.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param val
+*    pointer to the value destination
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictRdDouble(CO_DICT *cod, uint32_t key, double *val);
+
 /*! \brief  WRITE BYTE TO OBJECT DICTIONARY
 *
 *    This function writes a 8bit value to the given object dictionary. The
@@ -182,6 +278,45 @@ int16_t CODictWrWord(CO_DICT *cod, uint32_t key, uint16_t val);
 */
 int16_t CODictWrLong(CO_DICT *cod, uint32_t key, uint32_t val);
 
+/*! \brief  WRITE QUAD TO OBJECT DICTIONARY
+*
+*    This function writes a 64bit value to the given object dictionary. The
+*    object entry is addressed with the given key.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param val
+*    the source value
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictWrQuad(CO_DICT *cod, uint32_t key, uint64_t val);
+
+/*! \brief  WRITE DOUBLE TO OBJECT DICTIONARY
+*
+*    This function writes a 64bit floating point value (REAL64) to the
+*    given object dictionary. The object entry is addressed with the given
+*    key.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param val
+*    the source value
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictWrDouble(CO_DICT *cod, uint32_t key, double val);
+
 /*! \brief  READ BUFFER FROM OBJECT DICTIONARY
 *
 *    This function reads a buffer byte stream from the given object
@@ -229,10 +364,145 @@ int16_t CODictRdBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 */
 int16_t CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 
+/*! \brief  IMPORT PARAMETER IMAGE INTO OBJECT DICTIONARY
+*
+*    This function writes all records of the given parameter image into the
+*    object dictionary in a single pass. Each record of the image consists
+*    of the index (2 bytes), the subindex (1 byte), the length of the value
+*    (4 bytes) and the value bytes; all numbers in little endian byte order
+*    (same as the CANopen frames). Each record is checked with the same
+*    rules as a SDO download: the object entry must exist, must be writable
+*    and the length must match the object size. Values up to 4 bytes and
+*    8 byte values of objects without a size function are written like an
+*    expedited download (including the node-id and PDO event handling),
+*    larger values like a segmented download.
+*
+*    The import stops at the first bad record. The records in front of
+*    this record are already written to the object dictionary. A bad
+*    record is reported with the return value and the number of written
+*    records only; the node error state is not changed.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param img
+*    pointer to the parameter image
+*
+* \param len
+*    length of the parameter image in bytes
+*
+* \param num
+*    pointer to the number of written records (or 0, if not needed)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictImport(CO_DICT *cod, uint8_t *img, uint32_t len, uint32_t *num);
+
+/*! \brief  EXPORT PARAMETER IMAGE FROM OBJECT DICTIONARY
+*
+*    This function creates a parameter image with all readable and writable
+*    object entries within the given index range. The records are written in
+*    the format, described in CODictImport(), and in order of the object
+*    dictionary. The created image can be loaded with CODictImport().
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param first
+*    first index of exported object entries
+*
+* \param last
+*    last index of exported object entries
+*
+* \param img
+*    pointer to the parameter image buffer
+*
+* \param len
+*    pointer to the size of the image buffer; on return the length of the
+*    created parameter image in bytes
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictExport(CO_DICT *cod, uint16_t first, uint16_t last, uint8_t *img, uint32_t *len);
+
+/*! \brief  SUBSCRIBE TO OBJECT CHANGES
+*
+*    This function links the given subscription to the object dictionary.
+*    The callback function is called after each write access with a value
+*    function (e.g. CODictWrLong(), SDO expedited download or RPDO), which
+*    changes the value of an object entry within the given key range. Writes
+*    of the same value are not notified.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param sub
+*    pointer to the subscription, allocated by the application
+*
+* \param first
+*    first key of the range (CO_DEV(index, subindex))
+*
+* \param last
+*    last key of the range (CO_DEV(index, subindex))
+*
+* \param func
+*    callback function
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CODictSubscribe(CO_DICT *cod, CO_DICT_SUB *sub, uint32_t first, uint32_t last, CO_DICT_SUB_FUNC func);
+
+/*! \brief  UNSUBSCRIBE FROM OBJECT CHANGES
+*
+*    This function removes the given subscription from the object
+*    dictionary. The callback function is not called after this function
+*    returns.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param sub
+*    pointer to the subscription
+*/
+void CODictUnsubscribe(CO_DICT *cod, CO_DICT_SUB *sub);
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+/*! \brief  CHECK FOR 64BIT VALUE OBJECT
+*
+*    This function checks, if the given object entry is a 64bit value,
+*    which is accessed with the value functions instead of the buffer
+*    functions.
+*
+* \param obj
+*    pointer to the object entry
+*
+* \param size
+*    object entry size in bytes
+*
+* \retval  =0    object entry is no 64bit value
+* \retval  =1    object entry is a 64bit value
+*/
+uint8_t CODictIsQuad(struct CO_OBJ_T *obj, uint32_t size);
+
+/*! \brief  NOTIFY OBJECT CHANGE
+*
+*    This function calls the callback functions of all subscriptions with
+*    a key range, which contains the given object entry.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param obj
+*    pointer to the changed object entry
+*/
+void CODictSubNotify(CO_DICT *cod, struct CO_OBJ_T *obj);
+
 /*! \brief  INIT OBJECT DICTIONARY
 *
 *    This function identifies the number of already configured object
@@ -243,6 +513,10 @@ int16_t CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 *    with the identified results and linked to the given node information
 *    structure.
 *
+*    When the object dictionary is configured with a value array, the
+*    initial values of the direct object entries are copied into the array
+*    element with the same position as the object entry.
+*
 * \param cod
 *    pointer to object dictionary which must be initialized
 *
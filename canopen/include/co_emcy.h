@@ -30,9 +30,27 @@
 * PUBLIC DEFINES
 ******************************************************************************/
     
-#define CO_TEMCY      (CO_OBJ_TYPE *)&COTEmcy  /*!< Object Type EMCY History */
+#define CO_TEMCY      (CO_OBJ_TYPE *)&COTEmcy     /*!< Object Type EMCY History */
+#define CO_TEMCY_CFG  (CO_OBJ_TYPE *)&COTEmcyCfg  /*!< Object Type EMCY Config  */
 
-#define CO_EMCY_STORAGE  (1+((CO_EMCY_N-1)/8))  /*!< bytes for CO_EMCY_N bit */
+#define CO_EMCY_COBID_OFF  0x80000000  /*!< EMCY COB-ID: EMCY does not exist */
+#define CO_EMCY_COBID_RSV  0x40000000  /*!< EMCY COB-ID: reserved bit          */
+#define CO_EMCY_COBID_EXT  0x20000000  /*!< EMCY COB-ID: extended CAN-ID      */
+
+#define CO_EMCY_STORAGE  (1+((CO_EMCY_N-1)/32)) /*!< words for CO_EMCY_N bit */
+
+#if CO_EMCY_N > 0x7FFF
+#error "CO_EMCY_N: more than 32767 EMCY codes are not supported"
+#endif
+
+/*! \brief EMCY INHIBIT TIME
+*
+*    This macro converts the EMCY inhibit time (1015h) in multiples of 100us
+*    into timer ticks. The result is rounded up to guarantee the minimal
+*    distance between two EMCY messages.
+*/
+#define CO_EMCY_INHIBIT(x)  \
+    ((((uint32_t)(x)) * CO_TMR_TICKS_PER_SEC + 9999) / 10000)
 
 /*! \brief EMCY CODE
 *
@@ -98,21 +116,34 @@
 */
 extern const CO_OBJ_TYPE COTEmcy;      /* Link to EMCY Object Type Structure */
 
+/*! \brief OBJECT TYPE EMCY CONFIGURATION
+*
+*    This type is responsible for the write access to the EMCY COB-ID (1014h)
+*    and the EMCY inhibit time (1015h). The written values are taken over
+*    into the EMCY transmit management.
+*/
+extern const CO_OBJ_TYPE COTEmcyCfg;   /* Link to EMCY Config Type Structure */
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
 
 struct CO_OBJ_T;
+struct CO_EMCY_CONS_T;
 
 /*! \brief EMCY HISTORY
 *
 *    This structure holds all data, which are needed for the EMCY history
-*    management within the object dictionary.
+*    management within the object dictionary. The object entries 1003h:1
+*    to 1003h:Max are used as ringbuffer; they are addressed directly via
+*    the cached reference to the first entry.
 */
 typedef struct CO_EMCY_HIST_T {
     uint8_t Max;                 /*!< Total length of EMCY history           */
     uint8_t Num;                 /*!< Number of EMCY in history              */
     uint8_t Off;                 /*!< Subindex-Offset to newest EMCY entry   */
+    CO_OBJ *Sub0;                /*!< object entry 1003h:0                   */
+    CO_OBJ *Sub1;                /*!< object entry 1003h:1 (ringbuffer)      */
 
 } CO_EMCY_HIST;
 
@@ -138,6 +169,33 @@ typedef struct CO_EMCY_TBL_T {
 
 } CO_EMCY_TBL;
 
+/*! \brief EMCY MESSAGE
+*
+*    This structure holds a single EMCY message, which waits in the transmit
+*    queue for the end of the EMCY inhibit time.
+*/
+typedef struct CO_EMCY_MSG_T {
+    uint16_t  Err;               /*!< user error identifier                  */
+    uint8_t   State;             /*!< error state (=0: no error, =1: error)  */
+    uint8_t   Data[8];           /*!< EMCY message payload                   */
+
+} CO_EMCY_MSG;
+
+/*! \brief EMCY TRANSMIT QUEUE
+*
+*    This structure holds the EMCY messages, which are delayed by the EMCY
+*    inhibit time (1015h). The messages are stored in a ringbuffer.
+*/
+typedef struct CO_EMCY_TX_T {
+    int16_t      Tmr;                      /*!< inhibit timer (-1: idle)     */
+    uint32_t     Inhibit;                  /*!< inhibit time in ticks        */
+    uint8_t      Head;                     /*!< index of oldest message      */
+    uint8_t      Num;                      /*!< number of queued messages    */
+    uint16_t     Lost;                     /*!< number of dropped messages   */
+    CO_EMCY_MSG  Msg[CO_EMCY_QUEUE_N];     /*!< queued EMCY messages         */
+
+} CO_EMCY_TX;
+
 /*! \brief EMCY MANAGEMENT
 *
 *    This structure holds the EMCY defintion table and informations to
@@ -147,8 +205,13 @@ typedef struct CO_EMCY_T {
     struct CO_NODE_T      *Node;                  /*!< parent node           */
     struct CO_EMCY_TBL_T  *Root;                  /*!< root to EMCY table    */
     struct CO_EMCY_HIST_T  Hist;                  /*!< EMCY history          */
-    uint8_t                Cnt[CO_EMCY_REG_NUM];  /*!< count register bits   */
-    uint8_t                Err[CO_EMCY_STORAGE];  /*!< error status storage  */
+    CO_OBJ                *Reg;                   /*!< error register 1001h  */
+    uint16_t               Cnt[CO_EMCY_REG_NUM];  /*!< count register bits   */
+    uint32_t               Err[CO_EMCY_STORAGE];  /*!< error status bitmap   */
+    uint32_t               CobId;                 /*!< EMCY COB-ID (1014h)   */
+    CO_OBJ                *Cob;                   /*!< EMCY COB-ID entry     */
+    struct CO_EMCY_TX_T    Tx;                    /*!< EMCY transmit queue   */
+    struct CO_EMCY_CONS_T *Cons;                  /*!< EMCY consumer (or 0)  */
 
 } CO_EMCY;
 
@@ -172,7 +235,7 @@ typedef struct CO_EMCY_T {
 * \param usr
 *    manufacturer specific fields in EMCY history and/or EMCY message
 */
-void COEmcySet(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr);
+void COEmcySet(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr);
 
 /*! \brief CLEAR EMCY ERROR
 *
@@ -186,7 +249,7 @@ void COEmcySet(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr);
 * \param err
 *    EMCY error identifier in User EMCY table
 */
-void COEmcyClr(CO_EMCY *emcy, uint8_t err);
+void COEmcyClr(CO_EMCY *emcy, uint16_t err);
 
 /*! \brief GET EMCY ERROR STATUS
 *
@@ -202,7 +265,7 @@ void COEmcyClr(CO_EMCY *emcy, uint8_t err);
 * \retval   =1    the error was detected before
 * \retval   <0    an error is detected inside of this function
 */
-int16_t COEmcyGet(CO_EMCY *emcy, uint8_t err);
+int16_t COEmcyGet(CO_EMCY *emcy, uint16_t err);
 
 /*! \brief COUNT DETECTED EMCY ERRORS
 *
@@ -216,10 +279,36 @@ int16_t COEmcyGet(CO_EMCY *emcy, uint8_t err);
 */
 int16_t COEmcyCnt(CO_EMCY *emcy);
 
+/*! \brief FIND NEXT DETECTED EMCY ERROR
+*
+*    This function returns the first currently detected EMCY error with an
+*    error identifier greater or equal to the given start identifier. The
+*    search skips 32 undetected errors at once, so iterating over all
+*    detected errors depends on the number of detected errors:
+*
+*    \code
+*    for (err = COEmcyNext(emcy, 0); err >= 0; err = COEmcyNext(emcy, err + 1)) {
+*        ...
+*    }
+*    \endcode
+*
+* \param emcy
+*    pointer to the EMCY object
+*
+* \param start
+*    EMCY error identifier to start the search
+*
+* \retval  >=0    the error identifier of the next detected EMCY error
+* \retval  <0     no further detected EMCY error, or an error is detected
+*                 inside of this function
+*/
+int16_t COEmcyNext(CO_EMCY *emcy, uint16_t start);
+
 /*! \brief RESET ALL EMCY ERRORS
 *
 *    This function clears all EMCY errors. The EMCY message transmission
-*    can be suppressed by setting the parameter silent to 1.
+*    can be suppressed by setting the parameter silent to 1. Only the
+*    currently detected EMCY errors are processed.
 *
 * \param emcy
 *    pointer to the EMCY object
@@ -296,7 +385,21 @@ int16_t COEmcyCheck(CO_EMCY *emcy);
 *
 * \internal
 */
-int16_t COEmcyGetErr(CO_EMCY *emcy, uint8_t err);
+int16_t COEmcyGetErr(CO_EMCY *emcy, uint16_t err);
+
+/*! \brief FIND FIRST SET BIT
+*
+*    This function returns the bit number of the least significant bit,
+*    which is set in the given word.
+*
+* \param word
+*    the bitmap word (must not be 0)
+*
+* \return  bit number (0..31) of the least significant set bit
+*
+* \internal
+*/
+uint8_t COEmcyFfs(uint32_t word);
 
 /*! \brief  SET INTERNAL ERROR STATE
 *
@@ -320,7 +423,7 @@ int16_t COEmcyGetErr(CO_EMCY *emcy, uint8_t err);
 *
 * \internal
 */
-int16_t COEmcySetErr(CO_EMCY *emcy, uint8_t err, uint8_t state);
+int16_t COEmcySetErr(CO_EMCY *emcy, uint16_t err, uint8_t state);
     
 /*! \brief  SEND EMCY MESSAGE
 *
@@ -344,10 +447,95 @@ int16_t COEmcySetErr(CO_EMCY *emcy, uint8_t err, uint8_t state);
 * \internal
 */
 void COEmcySend(CO_EMCY     *emcy,
-                uint8_t      err,
+                uint16_t     err,
                 CO_EMCY_USR *usr,
                 uint8_t      state);
 
+/*! \brief  INIT EMCY TRANSMIT MANAGEMENT
+*
+*    This function takes over the EMCY COB-ID (1014h) and the optional EMCY
+*    inhibit time (1015h) out of the object dictionary and discards all
+*    queued EMCY messages.
+*
+* \note
+*    The parameter emcy shall be checked by the calling function.
+*
+* \param emcy
+*    pointer to the EMCY object
+*
+* \internal
+*/
+void COEmcyTxInit(CO_EMCY *emcy);
+
+/*! \brief  GET EMCY COB-ID
+*
+*    This function returns the EMCY COB-ID for the transmission. The cached
+*    COB-ID is updated by the write access of an EMCY COB-ID entry with the
+*    type CO_TEMCY_CFG. Other EMCY COB-ID entries may be changed without
+*    notification, therefore the COB-ID is read out of the object entry.
+*
+* \note
+*    The parameter emcy shall be checked by the calling function.
+*
+* \param emcy
+*    pointer to the EMCY object
+*
+* \return  EMCY COB-ID (1014h)
+*
+* \internal
+*/
+uint32_t COEmcyTxCobId(CO_EMCY *emcy);
+
+/*! \brief  QUEUE EMCY MESSAGE
+*
+*    This function appends the EMCY message to the transmit queue. With
+*    enabled coalescing, a queued EMCY message of the same error with the
+*    opposite error state is removed instead. The EMCY message is dropped
+*    and counted as lost, if the transmit queue is full.
+*
+* \note
+*    The parameter emcy shall be checked by the calling function.
+*
+* \param emcy
+*    pointer to the EMCY object
+*
+* \param msg
+*    EMCY message
+*
+* \internal
+*/
+void COEmcyTxQueue(CO_EMCY *emcy, CO_EMCY_MSG *msg);
+
+/*! \brief  TRANSMIT EMCY MESSAGE
+*
+*    This function transmits the EMCY message payload with the cached EMCY
+*    COB-ID and starts the EMCY inhibit time.
+*
+* \note
+*    The parameter emcy shall be checked by the calling function.
+*
+* \param emcy
+*    pointer to the EMCY object
+*
+* \param data
+*    EMCY message payload (8 bytes)
+*
+* \internal
+*/
+void COEmcyTxSend(CO_EMCY *emcy, uint8_t *data);
+
+/*! \brief  END OF EMCY INHIBIT TIME
+*
+*    This timer callback function is called at the end of the EMCY inhibit
+*    time and transmits the oldest queued EMCY message.
+*
+* \param parg
+*    pointer to the EMCY object
+*
+* \internal
+*/
+void COEmcyTxNext(void *parg);
+
 /*! \brief  UPDATE EMCY OBJECT ENTRIES
 *
 *    This function updates the EMCY object dictionary entries with the
@@ -371,7 +559,7 @@ void COEmcySend(CO_EMCY     *emcy,
 * \internal
 */
 void COEmcyUpdate(CO_EMCY     *emcy,
-                  uint8_t      err,
+                  uint16_t     err,
                   CO_EMCY_USR *usr,
                   uint8_t      state);
 
@@ -379,6 +567,8 @@ void COEmcyUpdate(CO_EMCY     *emcy,
 *
 *    This function initializes the EMCY history management. Additionally,
 *    the object entries, mandatory for EMCY history are checked for existance.
+*    The history length is limited to the object entries 1003h:1 to 1003h:n,
+*    which are placed consecutively in the object dictionary.
 *
 * \note
 *    The parameter emcy shall be checked by the calling function.
@@ -417,7 +607,7 @@ void COEmcyHistInit(CO_EMCY *emcy);
 *
 * \internal
 */
-void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr);
+void COEmcyHistAdd(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr);
 
 /*! \brief EMCY OBJECT READ ACCESS
 *
@@ -474,4 +664,29 @@ int16_t COTypeEmcyRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t
 */
 int16_t COTypeEmcyWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len);
 
+/*! \brief EMCY CONFIGURATION WRITE ACCESS
+*
+*    This function is responsible for the write access to the EMCY COB-ID
+*    (1014h) and the EMCY inhibit time (1015h). The new value is stored in
+*    the object entry and taken over into the EMCY transmit management.
+*
+* \param obj
+*    EMCY configuration object entry reference
+*
+* \param node
+*    reference to parent node
+*
+* \param buf
+*    Pointer to buffer memory
+*
+* \param len
+*    Length of buffer memory
+*
+* \retval  =CO_ERR_NONE    configuration is written
+* \retval !=CO_ERR_NONE    an error is detected and function aborted
+*
+* \internal
+*/
+int16_t COTypeEmcyCfgWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len);
+
 #endif  /* #ifndef CO_EMCY_H_ */
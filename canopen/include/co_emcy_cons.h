@@ -0,0 +1,187 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_EMCY_CONS_H_
+#define CO_EMCY_CONS_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_if.h"
+#include "co_nmt.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;
+struct CO_EMCY_CONS_T;
+struct CO_EMCY_PROD_T;
+
+/*! \brief EMCY CONSUMER CALLBACK
+*
+*    This type specifies the callback function prototype, which is called
+*    for each received and accepted EMCY message.
+*/
+typedef void (*CO_EMCY_CONS_FUNC)(struct CO_EMCY_CONS_T *cons, uint8_t nodeId, struct CO_EMCY_PROD_T *prod);
+
+/*! \brief EMCY PRODUCER
+*
+*    This structure holds all data, which are needed for consuming the EMCY
+*    messages of a single remote node. The application configures the
+*    member NodeId, all other members are managed by the EMCY consumer.
+*/
+typedef struct CO_EMCY_PROD_T {
+    uint8_t   NodeId;            /*!< Node-ID of EMCY producer (1..127)      */
+    uint32_t  CobId;             /*!< consumed COB-ID (1028h:NodeId)         */
+    uint32_t  Num;               /*!< number of received EMCY messages       */
+    uint32_t  Err;               /*!< number of received error occurrences   */
+    uint16_t  Code;              /*!< last received error code               */
+    uint8_t   Reg;               /*!< last received error register           */
+    uint8_t   Usr[5];            /*!< last manufacturer specific field       */
+    uint32_t  Last;              /*!< timer ticks of last EMCY message       */
+    uint32_t  Ival;              /*!< average message interval (ticks * 16)  */
+
+} CO_EMCY_PROD;
+
+/*! \brief EMCY CONSUMER
+*
+*    This structure holds all data, which are needed for consuming the EMCY
+*    messages of the remote nodes in the network.
+*/
+typedef struct CO_EMCY_CONS_T {
+    struct CO_NODE_T      *Node;    /*!< link to parent node                 */
+    struct CO_EMCY_PROD_T *Prod;    /*!< EMCY producer table                 */
+    CO_EMCY_CONS_FUNC      Func;    /*!< callback function (or 0)            */
+    uint8_t                Idx[CO_HBCONS_NODE_N]; /*!< producer index+1 by id*/
+    uint8_t                Num;     /*!< number of producers in table        */
+    uint8_t                Ext;     /*!< producers with non-default COB-ID   */
+    uint16_t               Mask;    /*!< callback filter: error code mask    */
+    uint16_t               Match;   /*!< callback filter: masked error code  */
+
+} CO_EMCY_CONS;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  EMCY CONSUMER INITIALIZATION
+*
+*    This function initializes the EMCY consumer with the given producer
+*    table and links the EMCY consumer to the given node. The consumed
+*    COB-ID of each producer is taken from the object entry 1028h with the
+*    Node-ID as subindex; without this entry, the default COB-ID 80h plus
+*    Node-ID is used. A producer with a COB-ID with bit 31 set is ignored.
+*
+* \param cons
+*    reference to EMCY consumer structure
+*
+* \param node
+*    reference to parent node
+*
+* \param prod
+*    reference to EMCY producer table
+*
+* \param num
+*    number of producers in the EMCY producer table
+*
+* \param func
+*    callback function (or 0, if not needed)
+*
+* \retval   =CO_ERR_NONE    EMCY consumer is initialized
+* \retval  !=CO_ERR_NONE    An error is detected (bad or double Node-ID)
+*/
+int16_t COEmcyConsInit(CO_EMCY_CONS      *cons,
+                       struct CO_NODE_T  *node,
+                       CO_EMCY_PROD      *prod,
+                       uint8_t            num,
+                       CO_EMCY_CONS_FUNC  func);
+
+/*! \brief  SET EMCY CONSUMER FILTER
+*
+*    This function sets the callback filter of the EMCY consumer. The
+*    callback function is called for EMCY messages with an error code, which
+*    fulfills: (code & mask) == match. The statistics of the producers are
+*    updated for all received EMCY messages.
+*
+* \param cons
+*    reference to EMCY consumer structure
+*
+* \param mask
+*    error code mask (0: all EMCY messages are passed)
+*
+* \param match
+*    masked error code
+*/
+void COEmcyConsSetFilter(CO_EMCY_CONS *cons, uint16_t mask, uint16_t match);
+
+/*! \brief  GET EMCY PRODUCER
+*
+*    This function returns the EMCY producer with the given Node-ID.
+*
+* \param cons
+*    reference to EMCY consumer structure
+*
+* \param nodeId
+*    Node-ID of the producer
+*
+* \return  reference to EMCY producer, or 0 if not in producer table
+*/
+CO_EMCY_PROD *COEmcyConsGet(CO_EMCY_CONS *cons, uint8_t nodeId);
+
+/*! \brief  GET EMCY RATE
+*
+*    This function returns the estimated EMCY message rate of the producer
+*    with the given Node-ID. The estimation is a moving average of the
+*    message intervals; a silent producer lowers the estimation with the
+*    time since the last EMCY message.
+*
+* \param cons
+*    reference to EMCY consumer structure
+*
+* \param nodeId
+*    Node-ID of the producer
+*
+* \return  estimated EMCY messages per minute (0: no EMCY message received)
+*/
+uint32_t COEmcyConsRate(CO_EMCY_CONS *cons, uint8_t nodeId);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CHECK EMCY MESSAGE
+*
+*    This function checks the given CAN frame for an EMCY message of a
+*    consumed producer. The producer statistics are updated and the
+*    callback function is called, if the EMCY message passes the filter.
+*
+* \param cons
+*    reference to EMCY consumer structure (or 0)
+*
+* \param frm
+*    received CAN frame
+*
+* \retval  >=0    Node-ID of the producer
+* \retval  <0     CAN frame is no consumed EMCY message
+*
+* \internal
+*/
+int16_t COEmcyConsCheck(CO_EMCY_CONS *cons, CO_IF_FRM *frm);
+
+#endif  /* #ifndef CO_EMCY_CONS_H_ */
@@ -93,6 +93,7 @@ typedef enum CO_ERR_T {
 
     CO_ERR_SDO_READ,             /*!< error during in SDO block reading      */
     CO_ERR_SDO_WRITE,            /*!< error during in SDO block writing      */
+    CO_ERR_SDO_DEFER,            /*!< SDO response is deferred by the object */
 
     CO_ERR_SYNC_MSG,             /*!< error during receive synchronous PDO   */
 
@@ -168,6 +168,37 @@
       (f)->Data[((p)+2)&0x7] = (uint8_t)(((uint32_t)(n)) >> 16); \
       (f)->Data[((p)+3)&0x7] = (uint8_t)(((uint32_t)(n)) >> 24); }
 
+/*! \brief GET DATA QUAD
+*
+*    This macro extracts a data quad (64 bit) out of the CAN frame.
+*
+* \param f
+*    The CAN frame
+*
+* \param p
+*    The data position (0)
+*/
+#define CO_GET_QUAD(f,p)     \
+    (uint64_t)( ( ( (uint64_t)CO_GET_LONG(f,(p)+4) ) << 32 ) | \
+                ( ( (uint64_t)CO_GET_LONG(f,(p)  ) )       )   )
+
+/*! \brief SET DATA QUAD
+*
+*    This macro sets a data quad (64 bit) within the CAN frame.
+*
+* \param f
+*    The CAN frame
+*
+* \param n
+*    The data value
+*
+* \param p
+*    The data position (0)
+*/
+#define CO_SET_QUAD(f,n,p)   \
+    { CO_SET_LONG(f, (uint32_t)((uint64_t)(n)      ), (p)  ); \
+      CO_SET_LONG(f, (uint32_t)((uint64_t)(n) >> 32), (p)+4); }
+
 /*! \brief CAN DRIVER IDENTIFIER
 *
 *    The driver specific bus identifier type.
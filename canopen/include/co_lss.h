@@ -27,7 +27,7 @@
 * PUBLIC DEFINES
 ******************************************************************************/
 
-#define CO_LSS_MAX_SID           21       /*!< number of LSS services        */
+#define CO_LSS_MAX_CMD          256       /*!< number of command specifiers  */
 #define CO_LSS_MAX_BAUD          10       /*!< number of standard baudrates  */
 
 #define CO_LSS_RX_ID           2021       /*!< LSS request identifier        */
@@ -59,11 +59,15 @@
 #define CO_LSS_REM_SERIAL_MIN    14
 #define CO_LSS_REM_SERIAL_MAX    15
 
+#define CO_LSS_FS_RESET        0x80       /*!< fastscan: reset bit check     */
+#define CO_LSS_FS_IDLE         0xFF       /*!< fastscan: no scan in progress */
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
 
 struct CO_NODE_T;
+struct CO_LSS_MST_T;
 
 /*! \brief LSS SLAVE HANDLING
 *
@@ -77,13 +81,20 @@ typedef struct CO_LSS_T {
     uint8_t           Mode;          /* mode of layer setting service slave  */
     uint8_t           Step;          /* LSS address selection step           */
     uint8_t           Flags;         /* event flags                          */
+    uint8_t           FsPos;         /* fastscan: expected LSS-ID part       */
+    struct CO_LSS_MST_T *Mst;        /* linked LSS master (or 0)             */
 
 } CO_LSS;
 
 typedef int16_t(*CO_LSS_SERVICE)(CO_LSS *, CO_IF_FRM *);
 
+/*! \brief LSS SERVICE MAP
+*
+*    This structure holds the service of a single LSS command specifier.
+*    The service table is indexed with the command specifier; an unused
+*    command specifier has no allowed LSS mode.
+*/
 typedef struct CO_LSS_MAP_T {
-    uint8_t        Request;        /* received LSS command specifier         */
     uint8_t        Allowed;        /* allowed service in bitmasked LSS modes */
     CO_LSS_SERVICE Service;        /* service function                       */
 
@@ -103,7 +114,9 @@ void COLssInit(CO_LSS *lss, struct CO_NODE_T *node);
 *
 *    This functions checks a received frame to be a LSS message. If this is
 *    a valid LSS frame, the frame will be processed and replaced by the
-*    corresponding response frame.
+*    corresponding response frame. The service is selected with a single
+*    lookup in the service table, which is indexed with the command
+*    specifier.
 *
 * \param frm
 *    The CAN frame
@@ -135,6 +148,7 @@ int16_t COLssIdentifyRemoteSlave_RevMax(CO_LSS *lss, CO_IF_FRM *frm);
 int16_t COLssIdentifyRemoteSlave_SerMin(CO_LSS *lss, CO_IF_FRM *frm);
 int16_t COLssIdentifyRemoteSlave_SerMax(CO_LSS *lss, CO_IF_FRM *frm);
 int16_t COLssNonConfiguredRemoteSlave(CO_LSS *lss, CO_IF_FRM *frm);
+int16_t COLssFastscan(CO_LSS *lss, CO_IF_FRM *frm);
 
 /******************************************************************************
 * CALLBACK FUNCTIONS
@@ -0,0 +1,181 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_LSS_MST_H_
+#define CO_LSS_MST_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_if.h"
+#include "co_lss.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_LSS_MST_IDLE      0    /*!< no LSS master service in progress     */
+#define CO_LSS_MST_RESET     1    /*!< fastscan: reset of the bit check      */
+#define CO_LSS_MST_SCAN      2    /*!< fastscan: check of a single bit       */
+#define CO_LSS_MST_CONFIRM   3    /*!< fastscan: confirm of a LSS-ID part    */
+#define CO_LSS_MST_NODE_ID   4    /*!< configure node ID of selected slave   */
+
+/*! \brief MAXIMAL NUMBER OF FASTSCAN STEPS
+*
+*    A fastscan needs a reset step, 32 bit checks and a confirmation step
+*    for each of the 4 parts of the LSS address. Each step waits a single
+*    response timeout.
+*/
+#define CO_LSS_MST_STEPS     (1 + (4 * (32 + 1)))
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;
+struct CO_LSS_MST_T;
+
+/*! \brief LSS MASTER EVENT
+*
+*    This enumeration holds all events, which are reported by the LSS
+*    master.
+*/
+typedef enum CO_LSS_MST_EVENT_T {
+    CO_LSS_MST_FOUND = 0,        /*!< slave found and in configuration mode  */
+    CO_LSS_MST_NONE,             /*!< no unconfigured slave in the network   */
+    CO_LSS_MST_LOST,             /*!< scanned slave stops responding         */
+    CO_LSS_MST_NODE_ID_OK,       /*!< node ID configured, slave is waiting   */
+    CO_LSS_MST_NODE_ID_ERR,      /*!< node ID rejected or no response        */
+    CO_LSS_MST_EVENT_NUM         /*!< number of LSS master events            */
+
+} CO_LSS_MST_EVENT;
+
+/*! \brief LSS MASTER EVENT CALLBACK
+*
+*    This type specifies the LSS master event callback function prototype.
+*/
+typedef void (*CO_LSS_MST_FUNC)(struct CO_LSS_MST_T *mst, CO_LSS_MST_EVENT event);
+
+/*! \brief LSS MASTER
+*
+*    This structure holds all data, which are needed for discovering and
+*    addressing the unconfigured LSS slaves in the network.
+*/
+typedef struct CO_LSS_MST_T {
+    struct CO_NODE_T *Node;      /*!< link to parent node                    */
+    CO_LSS_MST_FUNC   Func;      /*!< event callback function (or 0)         */
+    uint32_t          Id[4];     /*!< LSS address of the found slave         */
+    uint32_t          Start;     /*!< tick of service start                  */
+    uint32_t          Time;      /*!< duration of last service in ticks      */
+    uint16_t          Timeout;   /*!< response timeout in ms                 */
+    int16_t           Tmr;       /*!< response timeout timer                 */
+    uint8_t           State;     /*!< service state (CO_LSS_MST_xxx)         */
+    uint8_t           Sub;       /*!< scanned part of the LSS address        */
+    uint8_t           Bit;       /*!< checked bit of the LSS address part    */
+    uint8_t           Resp;      /*!< number of responses in current step    */
+    uint8_t           NodeId;    /*!< requested node ID                      */
+
+} CO_LSS_MST;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  LSS MASTER INITIALIZATION
+*
+*    This function initializes the LSS master and links the LSS master to
+*    the given node.
+*
+* \param mst
+*    reference to LSS master structure
+*
+* \param node
+*    reference to parent node
+*
+* \param timeout
+*    response timeout of the LSS slaves in ms
+*
+* \param func
+*    event callback function (or 0, if not needed)
+*
+* \retval   =CO_ERR_NONE    LSS master is initialized
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COLssMstInit(CO_LSS_MST       *mst,
+                     struct CO_NODE_T *node,
+                     uint16_t          timeout,
+                     CO_LSS_MST_FUNC   func);
+
+/*! \brief  START LSS FASTSCAN
+*
+*    This function starts the fastscan for an unconfigured LSS slave. The
+*    LSS address is determined bit by bit, therefore the fastscan is
+*    finished after at most CO_LSS_MST_STEPS response timeouts, independent
+*    of the number of slaves in the network. The result is reported with
+*    the events CO_LSS_MST_FOUND, CO_LSS_MST_NONE or CO_LSS_MST_LOST. The
+*    found slave is in configuration mode and the LSS address is stored in
+*    the member Id.
+*
+* \param mst
+*    reference to LSS master structure
+*
+* \retval   =CO_ERR_NONE    fastscan is started
+* \retval  !=CO_ERR_NONE    An error is detected (LSS master is busy)
+*/
+int16_t COLssMstFastscan(CO_LSS_MST *mst);
+
+/*! \brief  CONFIGURE NODE ID
+*
+*    This function configures the node ID of the slave in configuration
+*    mode. After the slave accepts the node ID, all slaves are switched to
+*    waiting mode. The result is reported with the events
+*    CO_LSS_MST_NODE_ID_OK or CO_LSS_MST_NODE_ID_ERR. A slave with a
+*    configured node ID takes no part in the following fastscans.
+*
+* \param mst
+*    reference to LSS master structure
+*
+* \param nodeId
+*    node ID for the slave (1..127)
+*
+* \retval   =CO_ERR_NONE    node ID configuration is started
+* \retval  !=CO_ERR_NONE    An error is detected (bad node ID or busy)
+*/
+int16_t COLssMstNodeId(CO_LSS_MST *mst, uint8_t nodeId);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CHECK LSS RESPONSE
+*
+*    This function checks the given frame to be a LSS slave response for
+*    the running LSS master service.
+*
+* \param mst
+*    reference to LSS master structure (or 0)
+*
+* \param frm
+*    received CAN frame
+*
+* \retval   <0    CAN message is not a LSS response for the LSS master
+* \retval  >=0    CAN message is consumed
+*/
+int16_t COLssMstCheck(CO_LSS_MST *mst, CO_IF_FRM *frm);
+
+#endif  /* #ifndef CO_LSS_MST_H_ */
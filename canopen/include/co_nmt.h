@@ -37,6 +37,8 @@
 #define CO_SDO_ALLOWED   0x20    /*!< indication of SDO transfers allowed    */
 #define CO_PDO_ALLOWED   0x40    /*!< indication of PDO transfers allowed    */
 
+#define CO_HBCONS_NODE_N 128     /*!< number of consumable node-ids 0..127 */
+
 #define CO_THB_PROD  ((CO_OBJ_TYPE *)&COTNmtHbProd)  /*!< Heartbeat Producer */
 #define CO_THB_CONS  ((CO_OBJ_TYPE *)&COTNmtHbCons)  /*!< Heartbeat Consumer */
 
@@ -66,6 +68,7 @@ extern const CO_OBJ_TYPE COTNmtHbProd;
 
 struct CO_NODE_T;
 struct CO_HBCONS_T;
+struct CO_NMT_MST_T;
 
 /*! \brief RESET TYPE
 *
@@ -92,6 +95,21 @@ typedef enum CO_MODE_T {
 
 } CO_MODE;
 
+/*! \brief HEARTBEAT PRODUCER STATISTICS
+*
+*    This structure holds the measured periods of the heartbeat producer in
+*    timer ticks. The measurement is restarted with each change of the
+*    heartbeat producer time.
+*/
+typedef struct CO_NMT_HB_STAT_T {
+    uint32_t            Num;     /*!< number of sent heartbeats              */
+    uint32_t            Cycle;   /*!< configured heartbeat period in ticks   */
+    uint32_t            Last;    /*!< timer tick of last heartbeat           */
+    uint32_t            Min;     /*!< minimal measured period in ticks       */
+    uint32_t            Max;     /*!< maximal measured period in ticks       */
+
+} CO_NMT_HB_STAT;
+
 /*! \brief NMT MANAGEMENT
 *
 *    This structure holds all data, which are needed for the NMT state
@@ -100,8 +118,14 @@ typedef enum CO_MODE_T {
 typedef struct CO_NMT_T {
     struct CO_NODE_T   *Node;    /*!< ptr to parent CANopen node info        */
     struct CO_HBCONS_T *HbCons;  /*!< The used heartbeat consumer chain      */
+    struct CO_HBCONS_T *HbTbl[CO_HBCONS_NODE_N]; /*!< Consumers by node-id  */
+    struct CO_NMT_MST_T *Mst;    /*!< linked NMT master (or 0)               */
     enum CO_MODE_T      Mode;    /*!< NMT mode of this node                  */
     int16_t             Tmr;     /*!< heartbeat producer timer identifier    */
+    int16_t             HbTmr;   /*!< heartbeat consumer monitor timer id    */
+    uint32_t            HbTick;  /*!< heartbeat consumer monitor ticks       */
+    uint32_t            HbDue;   /*!< earliest heartbeat consumer deadline   */
+    CO_NMT_HB_STAT      HbStat;  /*!< heartbeat producer statistics          */
     uint8_t             Allowed; /*!< encoding of allowed CAN objects        */
 
 } CO_NMT;
@@ -115,7 +139,8 @@ typedef struct CO_HBCONS_T {
     struct CO_NODE_T   *Node;    /*!< Link to parent node                    */
     struct CO_HBCONS_T *Next;    /*!< Link to next consumer in active chain  */
     CO_MODE             State;   /*!< Received Node-State                    */
-    int16_t             Tmr;     /*!< Timer Identifier                       */
+    uint32_t            Due;     /*!< Deadline in monitor ticks              */
+    uint8_t             Run;     /*!< Monitoring started (first heartbeat)   */
     uint16_t            Time;    /*!< Time   (Bit00-15 when read object)     */
     uint8_t             NodeId;  /*!< NodeId (Bit16-23 when read object)     */
     uint8_t             Event;   /*!< Event Counter                          */
@@ -221,6 +246,30 @@ CO_MODE CONmtModeDecode(uint8_t code);
 */
 uint8_t CONmtModeEncode(CO_MODE mode);
 
+/*! \brief  GET HEARTBEAT PRODUCER JITTER
+*
+*    This function returns the maximal deviation of the measured heartbeat
+*    producer periods from the configured heartbeat producer time. The
+*    heartbeat is sent with a prioritized timer action, therefore the
+*    deviation shows the delay of the timer processing in the application.
+*
+* \param nmt
+*    reference to NMT structure
+*
+* \return  maximal deviation in ms (0 if less than two heartbeats are sent)
+*/
+uint32_t CONmtHbJitter(CO_NMT *nmt);
+
+/*! \brief  RESET HEARTBEAT PRODUCER STATISTICS
+*
+*    This function restarts the measurement of the heartbeat producer
+*    periods.
+*
+* \param nmt
+*    reference to NMT structure
+*/
+void CONmtHbStatReset(CO_NMT *nmt);
+
 /*! \brief  GET NUMBER OF HEARTBEAT EVENTS
 *
 *    This function retuns the number of heartbeat (miss-)events, which are
@@ -366,11 +415,14 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm);
 
 /*! \brief  HEARTBEAT CONSUMER TIMEOUT
 *
-*    This timer callback function checks that at least one received heartbeat 
-*    is detected for this heartbeat consumer.
+*    This cyclic timer callback function is the single monitor of all
+*    active heartbeat consumers. With each timer tick, the deadlines of
+*    the started consumers are checked, when the earliest deadline is
+*    reached. A consumer with a reached deadline raises a heartbeat
+*    consumer event and the deadline is moved by the consumer time.
 *
 * \param parg
-*    heartbeat consumer structure
+*    reference to NMT structure
 */
 void CONmtHbConsMonitor(void *parg);
 
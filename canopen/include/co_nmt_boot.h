@@ -0,0 +1,208 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_NMT_BOOT_H_
+#define CO_NMT_BOOT_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_if.h"
+#include "co_nmt.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_NMT_CFG_WAIT      0    /*!< waiting for slave in pre-operational  */
+#define CO_NMT_CFG_BUSY      1    /*!< slave configuration in progress       */
+#define CO_NMT_CFG_DONE      2    /*!< slave configuration finished          */
+#define CO_NMT_CFG_ERROR     3    /*!< slave configuration aborted           */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NMT_MST_T;
+
+/*! \brief SLAVE CONFIGURATION
+*
+*    This structure holds all data, which are needed for configuring a
+*    single slave with the NMT boot engine. The application configures the
+*    members NodeId, Img and Len, all other members are managed by the boot
+*    engine.
+*
+*    The configuration image is a sequence of records, which are written
+*    to the slave with SDO download in the given order. The record format
+*    is the parameter image format of CODictExport().
+*/
+typedef struct CO_NMT_CFG_T {
+    uint8_t     NodeId;   /*!< Node-ID of slave                              */
+    uint8_t    *Img;      /*!< configuration image                           */
+    uint32_t    Len;      /*!< length of configuration image in bytes        */
+    uint8_t     State;    /*!< configuration state (CO_NMT_CFG_xxx)          */
+    uint8_t     Step;     /*!< SDO transfer step of current record           */
+    uint8_t     Req;      /*!< request is waiting for the bus-load budget    */
+    uint8_t     Toggle;   /*!< toggle bit of next segment                    */
+    uint32_t    Pos;      /*!< start of current record in image              */
+    uint32_t    Seg;      /*!< written bytes of current record value         */
+    uint16_t    Num;      /*!< number of written records                     */
+    uint32_t    Abort;    /*!< SDO abort code of failed configuration        */
+    uint32_t    Start;    /*!< tick of configuration start                   */
+    uint32_t    Due;      /*!< SDO response deadline in ticks                */
+    uint32_t    Time;     /*!< configuration time in ms                      */
+
+} CO_NMT_CFG;
+
+/*! \brief NMT BOOT ENGINE
+*
+*    This structure holds all data, which are needed for configuring the
+*    slaves of the NMT master in parallel.
+*/
+typedef struct CO_NMT_BOOT_T {
+    struct CO_NMT_MST_T *Mst;    /*!< link to NMT master                     */
+    struct CO_NMT_CFG_T *Cfg;    /*!< slave configuration table              */
+    uint8_t  Idx[CO_HBCONS_NODE_N]; /*!< configuration index+1 by Node-ID    */
+    uint8_t  Num;                /*!< number of slave configurations         */
+    uint8_t  Par;                /*!< max. number of parallel configurations */
+    uint8_t  Budget;             /*!< max. number of SDO requests per tick   */
+    uint8_t  Busy;               /*!< number of running configurations       */
+    uint8_t  Sent;               /*!< number of SDO requests in current tick */
+    uint8_t  Next;               /*!< first configuration in next tick       */
+
+} CO_NMT_BOOT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  NMT BOOT ENGINE INITIALIZATION
+*
+*    This function initializes the boot engine for the given NMT master.
+*    A slave is configured as soon as the slave reports PRE-OPERATIONAL,
+*    and is configured again after each boot-up message. A configured slave
+*    with the flag CO_NMT_MST_START is started with a node specific
+*    command, all other slaves are started by the application.
+*
+*    The bus-load of the configuration is bounded by the number of parallel
+*    configurations and the number of SDO requests per timer tick.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param mst
+*    reference to initialized NMT master
+*
+* \param cfg
+*    reference to slave configuration table
+*
+* \param num
+*    number of slave configurations in table
+*
+* \param par
+*    maximal number of parallel configurations
+*
+* \param budget
+*    maximal number of SDO requests per timer tick
+*
+* \retval   =CO_ERR_NONE    NMT boot engine is initialized
+* \retval  !=CO_ERR_NONE    An error is detected (bad Node-ID or budget)
+*/
+int16_t CONmtBootInit(CO_NMT_BOOT         *boot,
+                      struct CO_NMT_MST_T *mst,
+                      CO_NMT_CFG          *cfg,
+                      uint8_t              num,
+                      uint8_t              par,
+                      uint8_t              budget);
+
+/*! \brief  GET CONFIGURATION PROGRESS
+*
+*    This function returns the configuration progress of the given slave.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \return  written part of the configuration image in percent
+*/
+uint8_t CONmtBootProgress(CO_NMT_BOOT *boot, uint8_t nodeId);
+
+/*! \brief  GET NUMBER OF PENDING CONFIGURATIONS
+*
+*    This function returns the number of slaves, which are waiting for
+*    configuration or are configured right now.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \return  number of pending slave configurations
+*/
+uint8_t CONmtBootPending(CO_NMT_BOOT *boot);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  RESTART SLAVE CONFIGURATION
+*
+*    This function restarts the configuration of the given slave, when the
+*    slave reports a boot-up.
+*
+* \param boot
+*    reference to NMT boot engine structure (or 0)
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \retval   =0    no configuration for the slave
+* \retval   =1    configuration of slave restarted
+*/
+uint8_t CONmtBootRestart(CO_NMT_BOOT *boot, uint8_t nodeId);
+
+/*! \brief  CHECK SDO RESPONSE
+*
+*    This function checks the given frame to be a SDO response of a slave
+*    in configuration and continues the configuration of this slave.
+*
+* \param boot
+*    reference to NMT boot engine structure (or 0)
+*
+* \param frm
+*    received CAN frame
+*
+* \retval   <0    CAN message is not a SDO response for the boot engine
+* \retval  >=0    CAN message is consumed. The return value is the Node-ID
+*/
+int16_t CONmtBootCheck(CO_NMT_BOOT *boot, CO_IF_FRM *frm);
+
+/*! \brief  NMT BOOT ENGINE PROCESSING
+*
+*    This function is called with each tick of the NMT master monitor. The
+*    function starts the configuration of waiting slaves, checks the SDO
+*    response timeouts and sends the SDO requests within the bus-load
+*    budget.
+*
+* \param boot
+*    reference to NMT boot engine structure (or 0)
+*/
+void CONmtBootProcess(CO_NMT_BOOT *boot);
+
+#endif  /* #ifndef CO_NMT_BOOT_H_ */
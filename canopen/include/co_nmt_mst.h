@@ -0,0 +1,290 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_NMT_MST_H_
+#define CO_NMT_MST_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_if.h"
+#include "co_nmt.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_NMT_MST_START     0x01    /*!< start slave after boot-up          */
+#define CO_NMT_MST_MANDATORY 0x02    /*!< slave is mandatory for the network */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;
+struct CO_NMT_MST_T;
+struct CO_NMT_BOOT_T;
+
+/*! \brief NMT MASTER EVENT
+*
+*    This enumeration holds all events, which are reported by the NMT
+*    master for a single slave.
+*/
+typedef enum CO_NMT_MST_EVENT_T {
+    CO_NMT_MST_BOOTUP = 0,       /*!< boot-up message of slave received      */
+    CO_NMT_MST_STATE,            /*!< changed slave state reported           */
+    CO_NMT_MST_LOST,             /*!< heartbeat of slave is missing          */
+    CO_NMT_MST_CONFIG,           /*!< configuration of slave finished        */
+    CO_NMT_MST_CONFIG_ERR,       /*!< configuration of slave aborted         */
+    CO_NMT_MST_EVENT_NUM         /*!< number of NMT master events            */
+
+} CO_NMT_MST_EVENT;
+
+/*! \brief NMT MASTER EVENT CALLBACK
+*
+*    This type specifies the NMT master event callback function prototype.
+*/
+typedef void (*CO_NMT_MST_FUNC)(struct CO_NMT_MST_T *mst, uint8_t nodeId, CO_NMT_MST_EVENT event);
+
+/*! \brief NMT SLAVE ASSIGNMENT
+*
+*    This structure holds all data, which are needed for managing a single
+*    slave within the NMT master. The application configures the members
+*    NodeId, Flags and Time, all other members are managed by the NMT
+*    master.
+*/
+typedef struct CO_NMT_SLAVE_T {
+    uint8_t             NodeId;  /*!< Node-ID of slave (1..127)              */
+    uint8_t             Flags;   /*!< slave assignment flags                 */
+    uint16_t            Time;    /*!< heartbeat consumer time in ms (0: off) */
+    CO_MODE             State;   /*!< last reported state (or CO_INVALID)    */
+    CO_MODE             Target;  /*!< requested state                        */
+    uint32_t            Due;     /*!< heartbeat deadline in master ticks     */
+    uint8_t             Lost;    /*!< number of missing heartbeat events     */
+
+} CO_NMT_SLAVE;
+
+/*! \brief NMT MASTER
+*
+*    This structure holds all data, which are needed for managing the
+*    slaves of the network with the NMT master.
+*/
+typedef struct CO_NMT_MST_T {
+    struct CO_NODE_T      *Node;    /*!< link to parent node                 */
+    struct CO_NMT_SLAVE_T *Slave;   /*!< slave assignment table              */
+    struct CO_NMT_BOOT_T  *Boot;    /*!< linked boot engine (or 0)           */
+    CO_NMT_MST_FUNC        Func;    /*!< event callback function (or 0)      */
+    uint8_t                Idx[CO_HBCONS_NODE_N]; /*!< slave index+1 by id   */
+    uint8_t                Num;     /*!< number of slaves in table           */
+    int16_t                Tmr;     /*!< heartbeat monitor timer identifier  */
+    uint32_t               Tick;    /*!< heartbeat monitor ticks             */
+    uint32_t               Due;     /*!< earliest heartbeat deadline         */
+
+} CO_NMT_MST;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  NMT MASTER INITIALIZATION
+*
+*    This function initializes the NMT master with the given slave table
+*    and links the NMT master to the given node. The received boot-up and
+*    heartbeat messages of the slaves are consumed by the NMT master from
+*    now on.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param node
+*    reference to parent node
+*
+* \param slave
+*    reference to slave assignment table
+*
+* \param num
+*    number of slaves in the slave assignment table
+*
+* \param func
+*    event callback function (or 0, if not needed)
+*
+* \retval   =CO_ERR_NONE    NMT master is initialized
+* \retval  !=CO_ERR_NONE    An error is detected (bad or double Node-ID)
+*/
+int16_t CONmtMstInit(CO_NMT_MST       *mst,
+                     struct CO_NODE_T *node,
+                     CO_NMT_SLAVE     *slave,
+                     uint8_t           num,
+                     CO_NMT_MST_FUNC   func);
+
+/*! \brief  NMT MASTER NETWORK BOOT
+*
+*    This function starts the boot-up of the network. All slaves are reset
+*    with a single broadcast 'reset communication' command. The slaves are
+*    reported in PRE-OPERATIONAL with their boot-up message.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CONmtMstBoot(CO_NMT_MST *mst);
+
+/*! \brief  SET NETWORK STATE
+*
+*    This function requests the given state for all slaves in the slave
+*    table. The command is sent as a single broadcast, when more than one
+*    slave is not in the requested state. A single slave gets a node
+*    specific command and no command is sent, when all slaves are in the
+*    requested state.
+*
+* \note
+*    The broadcast addresses all nodes of the network, including nodes
+*    which are not part of the slave table.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param mode
+*    requested state (CO_PREOP, CO_OPERATIONAL or CO_STOP)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CONmtMstSetMode(CO_NMT_MST *mst, CO_MODE mode);
+
+/*! \brief  SET SLAVE STATE
+*
+*    This function requests the given state for a single slave with a node
+*    specific command.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \param mode
+*    requested state (CO_PREOP, CO_OPERATIONAL or CO_STOP)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CONmtMstSetNodeMode(CO_NMT_MST *mst, uint8_t nodeId, CO_MODE mode);
+
+/*! \brief  RESET SLAVE
+*
+*    This function resets the given slave, or all slaves with a single
+*    broadcast if the given Node-ID is 0. The slaves are reported in
+*    PRE-OPERATIONAL with their boot-up message.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param nodeId
+*    Node-ID of the slave (or 0 for all slaves)
+*
+* \param type
+*    reset type (CO_RESET_NODE or CO_RESET_COM)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CONmtMstReset(CO_NMT_MST *mst, uint8_t nodeId, CO_NMT_RESET type);
+
+/*! \brief  GET SLAVE STATE
+*
+*    This function returns the last state, which is reported by the given
+*    slave with the boot-up or heartbeat message.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \return  reported slave state, or CO_INVALID if unknown or lost
+*/
+CO_MODE CONmtMstGetMode(CO_NMT_MST *mst, uint8_t nodeId);
+
+/*! \brief  GET NUMBER OF PENDING SLAVES
+*
+*    This function returns the number of slaves, which have not confirmed
+*    the requested state with their heartbeat message.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param mandatory
+*    if != 0, count the mandatory slaves only
+*
+* \return  number of pending slaves
+*/
+uint8_t CONmtMstPending(CO_NMT_MST *mst, uint8_t mandatory);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SEND NMT COMMAND
+*
+*    This function sends the given NMT command to the given node.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param cmd
+*    NMT command specifier
+*
+* \param nodeId
+*    addressed Node-ID (or 0 for all nodes)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t CONmtMstSend(CO_NMT_MST *mst, uint8_t cmd, uint8_t nodeId);
+
+/*! \brief  CHECK SLAVE MESSAGE
+*
+*    This function checks the given frame to be a boot-up or heartbeat
+*    message of a slave in the slave table and updates the slave state.
+*
+* \param mst
+*    reference to NMT master structure (or 0, if no NMT master is used)
+*
+* \param frm
+*    received CAN frame
+*
+* \retval   <0    CAN message is not a message of a slave
+* \retval  >=0    CAN message is consumed. The return value is the Node-ID
+*/
+int16_t CONmtMstCheck(CO_NMT_MST *mst, CO_IF_FRM *frm);
+
+/*! \brief  SLAVE HEARTBEAT MONITOR
+*
+*    This cyclic timer callback function checks the heartbeat deadlines of
+*    all slaves, when the earliest deadline is reached. A slave with a
+*    reached deadline is reported as lost.
+*
+* \param parg
+*    reference to NMT master structure
+*/
+void CONmtMstMonitor(void *parg);
+
+#endif  /* #ifndef CO_NMT_MST_H_ */
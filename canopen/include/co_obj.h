@@ -67,6 +67,8 @@
 #define CO_SIGNED8       (CO_OBJ_SGN|CO_OBJ_SZ1)  /*!< Datatype: SIGNED8     */
 #define CO_SIGNED16      (CO_OBJ_SGN|CO_OBJ_SZ2)  /*!< Datatype: SIGNED16    */
 #define CO_SIGNED32      (CO_OBJ_SGN|CO_OBJ_SZ4)  /*!< Datatype: SIGNED32    */
+#define CO_SIGNED64      (CO_OBJ_SGN|CO_OBJ_SZ8)  /*!< Datatype: SIGNED64    */
+#define CO_REAL64        CO_OBJ_SZ8               /*!< Datatype: REAL64      */
 #define CO_FLOAT         0                        /*!< Datatype: FLOAT       */
 #define CO_DOMAIN        0                        /*!< Datatype: DOMAIN      */
 #define CO_STRING        0                        /*!< Datatype: STRING      */
@@ -74,6 +76,7 @@
 #define CO_BYTE          1                /*!< Number of bytes for a byte    */
 #define CO_WORD          2                /*!< Number of bytes for a word    */
 #define CO_LONG          4                /*!< Number of bytes for a long    */
+#define CO_QUAD          8                /*!< Number of bytes for a quad    */
 
 #define CO_CTRL_SET_OFF  1       /*!< Set read/write offset for next access  */
 
@@ -86,6 +89,7 @@
 
 #define CO_TSTRING    ((CO_OBJ_TYPE *)&COTString)   /*!< Object Type String  */
 #define CO_TDOMAIN    ((CO_OBJ_TYPE *)&COTDomain)   /*!< Object Type Domain  */
+#define CO_TSTREAM    ((CO_OBJ_TYPE *)&COTStream)   /*!< Object Type Stream  */
 
 /******************************************************************************
 * PUBLIC MACROS
@@ -140,7 +144,7 @@
 *    CANopen object subindex [0x00..0xFF]
 *
 * \param bit
-*    Length of mapped signal in bits [8,16 or 32]
+*    Length of mapped signal in bits [8,16,32 or 64]
 */
 #define CO_LINK(idx,sub,bit)           \
     ( (uint32_t)((idx) & 0xFFFF)<<16 | \
@@ -246,6 +250,7 @@
 
 struct CO_OBJ_TYPE_T;          /* Declaration of object type structure       */
 struct CO_DICT_T;              /* Declaration of object dictionary structure */
+struct CO_NODE_T;              /* Declaration of node structure              */
 
 /*! \brief OBJECT ENTRY
 *
@@ -313,6 +318,25 @@ typedef struct CO_OBJ_STR_T {
 
 } CO_OBJ_STR;
 
+/*!< Stream access function prototype (context, offset, buffer, length) */
+typedef int16_t (*CO_OBJ_STREAM_FUNC)(void *, uint32_t, uint8_t *, uint32_t);
+
+/*! \brief STREAM MANAGEMENT STRUCTURE
+*
+*    This structure holds all data, which are needed for the streaming
+*    domain object management within the object dictionary. The domain
+*    content is not held in memory; the application provides functions to
+*    pull (Read) or push (Write) a chunk of the stream at a given offset.
+*/
+typedef struct CO_OBJ_STREAM_T {
+    uint32_t            Offset;        /*!< Internal offset information      */
+    uint32_t            Size;          /*!< Stream size information          */
+    void               *Context;       /*!< Application stream context       */
+    CO_OBJ_STREAM_FUNC  Read;          /*!< Pull chunk from stream (or 0)    */
+    CO_OBJ_STREAM_FUNC  Write;         /*!< Push chunk into stream (or 0)    */
+
+} CO_OBJ_STREAM;
+
 /******************************************************************************
 * PUBLIC CONSTANTS
 ******************************************************************************/
@@ -341,6 +365,21 @@ extern const CO_OBJ_TYPE COTString;
 */
 extern const CO_OBJ_TYPE COTDomain;
 
+/*! \brief OBJECT TYPE STREAM
+*
+*    This type is responsible for the access to streaming domains. The
+*    domain content is transfered in chunks with the application functions,
+*    referenced in the stream management structure, which is stored in the
+*    object entry member 'Data'. This allows large domains (e.g. a file or
+*    a memory mapped region) without a copy of the domain in RAM.
+*
+* \note
+*    The stream functions are called with the current stream offset and
+*    the chunk length. The SDO server requests one chunk per segment for
+*    segmented transfers and one chunk per block for block transfers.
+*/
+extern const CO_OBJ_TYPE COTStream;
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -377,8 +416,9 @@ uint32_t COObjGetSize(CO_OBJ *obj, struct CO_NODE_T *node, uint32_t width);
 *    pointer to the result memory
 *
 * \param width
-*    width of read value (must be 1, 2 or 4 and reflecting the width
-*    of the referenced variable with given parameter pointer: value)
+*    width of read value (must be 1, 2, 4 or 8 and reflecting the width
+*    of the referenced variable with given parameter pointer: value).
+*    Values of objects with a smaller size are zero-extended.
 *
 * \param nodeid
 *    device nodeid (only used in case of node-id dependent value)
@@ -402,8 +442,9 @@ int16_t COObjRdValue(CO_OBJ *obj, struct CO_NODE_T *node, void *value, uint8_t w
 *    pointer to the source memory
 *
 * \param width
-*    width of write value (must be 1, 2 or 4 and reflecting the width
-*    of the referenced variable with given parameter pointer: value)
+*    width of write value (must be 1, 2, 4 or 8 and reflecting the width
+*    of the referenced variable with given parameter pointer: value).
+*    Values for objects with a smaller size are truncated.
 *
 * \param nodeid
 *    device nodeid (only used in case of node-id dependent value)
@@ -520,19 +561,43 @@ void COObjInit(CO_OBJ *obj);
 /*! \brief  COMPARE GIVEN VALUE WITH OBJECT ENTRY VALUE
 *
 *    This function compares the given value with the currently stored value
-*    within the object dictionary.
+*    within the object dictionary. The value of an object with a type is
+*    read with the read function of the type; a stream is always reported
+*    as changed.
 *
 * \param obj
 *    pointer to the object dictionary entry
 *
+* \param node
+*    reference to parent node
+*
 * \param val
-*    new value, (casted to 32bit value)
+*    new value, (casted to 64bit value for objects with 8 bytes, otherwise
+*    casted to 32bit value)
 *
 * \retval  =0    new value is equal to stored value
 * \retval  >0    new value is not equal to stored value
 * \retval  <0    an error is detected within this function
 */
-int16_t COObjCmp(CO_OBJ *obj, void *val);
+int16_t COObjCmp(CO_OBJ *obj, struct CO_NODE_T *node, void *val);
+
+/*! \brief  DIRECT VALUE REFERENCE
+*
+*    This function returns the storage of the value of a direct object
+*    entry. When the object dictionary of the node is configured with a
+*    value array, the value of the object entry is stored in the array
+*    element with the same position as the object entry. Otherwise the
+*    value is stored in the object entry member 'Data'.
+*
+* \param obj
+*    pointer to the object dictionary entry
+*
+* \param node
+*    reference to parent node (or 0 for the object entry member 'Data')
+*
+* \retval  pointer to the value storage of the direct object entry
+*/
+uintptr_t *COObjDirectRef(CO_OBJ *obj, struct CO_NODE_T *node);
 
 /*! \brief  DIRECT READ FROM DATA POINTER
 *
@@ -544,6 +609,9 @@ int16_t COObjCmp(CO_OBJ *obj, void *val);
 * \param obj
 *    pointer to the object dictionary entry
 *
+* \param node
+*    reference to parent node
+*
 * \param val
 *    pointer to the result memory
 *
@@ -553,7 +621,7 @@ int16_t COObjCmp(CO_OBJ *obj, void *val);
 * \retval    =CO_ERR_NONE    Successfully operation
 * \retval   !=CO_ERR_NONE    An error is detected
 */
-int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len);
+int16_t COObjRdDirect(CO_OBJ *obj, struct CO_NODE_T *node, void *val, uint32_t len);
 
 /*! \brief  DIRECT WRITE TO DATA POINTER
 *
@@ -565,6 +633,9 @@ int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len);
 * \param obj
 *    pointer to the object dictionary entry
 *
+* \param node
+*    reference to parent node
+*
 * \param val
 *    pointer to the source memory
 *
@@ -574,7 +645,48 @@ int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len);
 * \retval   =CO_ERR_NONE    Successfully operation
 * \retval  !=CO_ERR_NONE    An error is detected
 */
-int16_t COObjWrDirect(CO_OBJ *obj, void *val, uint32_t len);
+int16_t COObjWrDirect(CO_OBJ *obj, struct CO_NODE_T *node, void *val, uint32_t len);
+
+/*! \brief  DIRECT READ QUAD FROM DATA POINTER
+*
+*    This function reads the value of the entry from the data pointer
+*    address, when the object entry size or the requested length is 8
+*    bytes (CO_QUAD). The value is zero-extended or truncated to the
+*    requested length.
+*
+* \param obj
+*    pointer to the object dictionary entry
+*
+* \param val
+*    pointer to the result memory
+*
+* \param len
+*    length of value in bytes
+*
+* \retval    =CO_ERR_NONE    Successfully operation
+* \retval   !=CO_ERR_NONE    An error is detected
+*/
+int16_t COObjRdDirectQuad(CO_OBJ *obj, void *val, uint32_t len);
+
+/*! \brief  DIRECT WRITE QUAD TO DATA POINTER
+*
+*    This function writes the value to the data pointer address, when the
+*    object entry size or the given length is 8 bytes (CO_QUAD). The value
+*    is zero-extended or truncated to the object entry size.
+*
+* \param obj
+*    pointer to the object dictionary entry
+*
+* \param val
+*    pointer to the source memory
+*
+* \param len
+*    length of value in bytes
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COObjWrDirectQuad(CO_OBJ *obj, void *val, uint32_t len);
 
 /*! \brief  READ WITH TYPE FUNCTIONS
 *
@@ -785,4 +897,91 @@ int16_t COTypeDomainRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_
 */
 int16_t COTypeDomainWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len);
 
+/*! \brief STREAM OBJECT SIZE
+*
+*    This function is responsible to return the size of the stream.
+*
+* \param obj
+*    Stream object entry reference
+*
+* \param node
+*    reference to parent node
+*
+* \param width
+*    Requested stream size (or 0 if unknown)
+*
+* \return
+*    Size in bytes of the stream.
+*/
+uint32_t COTypeStreamSize(CO_OBJ *obj, struct CO_NODE_T *node, uint32_t width);
+
+/*! \brief STREAM OBJECT ACCESS CONTROL
+*
+*    This function is responsible to perform special control operations on
+*    the object entry. This control function supports the function(s):
+*
+*    - CO_CTRL_SET_OFF: set the working offset to the given value in para
+*                       for subsequent read or write function calls.
+*
+* \param obj
+*    Stream object entry reference
+*
+* \param node
+*    reference to parent node
+*
+* \param func
+*    Control function code
+*
+* \param para
+*    Control function parameter
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COTypeStreamCtrl(CO_OBJ *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para);
+
+/*! \brief STREAM OBJECT READ ACCESS
+*
+*    This function is responsible to pull the next chunk of the stream at
+*    the current offset into the given buffer memory.
+*
+* \param obj
+*    Stream object entry reference
+*
+* \param node
+*    reference to parent node
+*
+* \param buf
+*    Pointer to buffer memory
+*
+* \param len
+*    Length of buffer memory
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COTypeStreamRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len);
+
+/*! \brief STREAM OBJECT WRITE ACCESS
+*
+*    This function is responsible to push the given buffer memory as next
+*    chunk into the stream at the current offset.
+*
+* \param obj
+*    Stream object entry reference
+*
+* \param node
+*    reference to parent node
+*
+* \param buf
+*    Pointer to buffer memory
+*
+* \param len
+*    Length of buffer memory
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COTypeStreamWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len);
+
 #endif  /* #ifndef CO_OBJ_H_ */
@@ -36,6 +36,10 @@
 
 #define CO_TPARA  ((CO_OBJ_TYPE *)&COTPara)  /*!< Object Type Parameter      */
 
+#define CO_PARA_TASK_IDLE  0     /*!< no parameter request                   */
+#define CO_PARA_TASK_PEND  1     /*!< request waits for the store task       */
+#define CO_PARA_TASK_DONE  2     /*!< request executed, response pending     */
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -59,6 +63,28 @@ typedef struct CO_PARA_T {
 
 } CO_PARA;
 
+struct CO_NODE_T;
+struct CO_SDO_T;
+
+/*! \brief PARAMETER STORE TASK
+*
+*    This structure holds the request for storing or restoring parameter
+*    groups, which is executed outside of the CANopen node processing. The
+*    member State is the handshake between the node processing and the
+*    application task, which executes the request.
+*/
+typedef struct CO_PARA_TASK_T {
+    struct CO_NODE_T *Node;      /*!< link to parent node                    */
+    struct CO_SDO_T  *Srv;       /*!< SDO server waiting for response (or 0) */
+    CO_OBJ           *Obj;       /*!< first requested parameter object       */
+    uint16_t          Idx;       /*!< index of requested object              */
+    uint8_t           Sub;       /*!< subindex of requested object           */
+    uint8_t           Num;       /*!< number of requested parameter objects  */
+    int16_t           Result;    /*!< result of executed request             */
+    volatile uint8_t  State;     /*!< request state (CO_PARA_TASK_xxx)       */
+
+} CO_PARA_TASK;
+
 /******************************************************************************
 * EXTERN CONSTANTS
 ******************************************************************************/
@@ -79,8 +105,10 @@ extern const CO_OBJ_TYPE COTPara;
 /*! \brief PARAMETER STORE
 *
 *    This function is responsible for the storing activities of the given
-*    parameter group. The whole parameter group will be stored in NVM by
-*    calling the user callback function \ref COParaSave().
+*    parameter group. The parameter group will be stored in NVM by calling
+*    the user callback function \ref COParaSave(). A parameter group with
+*    change tracking (see CO_PARA_TRACK_N) is skipped, when it is unchanged
+*    since the last load or store.
 *
 * \param pg
 *    Ptr to parameter group info
@@ -104,6 +132,64 @@ void COParaStore(CO_PARA *pg, struct CO_NODE_T *node);
 *    Ptr to node info
 */
 void COParaRestore(CO_PARA *pg, struct CO_NODE_T *node);
+
+/*! \brief PARAMETER CHANGED
+*
+*    This function extends the changed range of the parameter group with the
+*    given memory area. The application calls this function after changing
+*    parameter values without the object dictionary access functions. An
+*    area outside of the parameter memory block and a parameter group
+*    without change tracking are ignored.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    Ptr to node info
+*
+* \param addr
+*    Ptr to changed parameter value
+*
+* \param size
+*    Size of changed parameter value in bytes
+*/
+void COParaChanged(CO_PARA *pg, struct CO_NODE_T *node, void *addr, uint32_t size);
+
+/*! \brief PARAMETER STORE TASK INITIALIZATION
+*
+*    This function initializes the parameter store task and links the task
+*    to the given node. With a linked task, a write access to the objects
+*    0x1010 and 0x1011 enqueues the request and returns immediately. The
+*    SDO response is sent by the node processing after the request is
+*    executed with \ref COParaTaskProcess(). A further request is rejected
+*    while a request is in progress.
+*
+* \param task
+*    reference to parameter store task
+*
+* \param node
+*    reference to parent node
+*
+* \retval   =CO_ERR_NONE    parameter store task is initialized
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaTaskInit(CO_PARA_TASK *task, struct CO_NODE_T *node);
+
+/*! \brief PARAMETER STORE TASK PROCESSING
+*
+*    This function executes the enqueued request by calling the user
+*    callback functions \ref COParaSave() or \ref COParaDefault(). The
+*    application calls this function in a background task or idle loop,
+*    therefore a slow NVM access does not block the node processing.
+*
+* \param task
+*    reference to parameter store task
+*
+* \retval   =0    no request is enqueued
+* \retval   =1    request is executed
+* \retval   <0    An error is detected
+*/
+int16_t COParaTaskProcess(CO_PARA_TASK *task);
     
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -135,6 +221,50 @@ void COParaRestore(CO_PARA *pg, struct CO_NODE_T *node);
 */
 int16_t COParaCheck(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_t size);
 
+/*! \brief PARAMETER OBJECT CHANGED
+*
+*    This function extends the changed range of all parameter groups, which
+*    hold the value of the given object. The whole content of a domain is
+*    taken as changed. The function is called after each successful write
+*    access of an object value and of an object buffer.
+*
+* \param obj
+*    Ptr to written object entry
+*
+* \param node
+*    reference to parent node
+*/
+void COParaObjChanged(CO_OBJ *obj, struct CO_NODE_T *node);
+
+/*! \brief PARAMETER GROUP LOADED
+*
+*    This function sets the changed range of a parameter group after
+*    loading the parameter group from NVM: a loaded parameter group is
+*    unchanged, a failed load marks the whole parameter group as changed.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    reference to parent node
+*
+* \param err
+*    result of the load callback function
+*/
+void COParaLoaded(CO_PARA *pg, struct CO_NODE_T *node, int16_t err);
+
+/*! \brief CHECK PARAMETER STORE TASK
+*
+*    This function finishes an executed request of the parameter store
+*    task: the changed ranges of not stored parameter groups are merged
+*    back, the deferred SDO response is sent and the task is ready for the
+*    next request. The function is called within the node processing.
+*
+* \param task
+*    reference to parameter store task (or 0)
+*/
+void COParaTaskCheck(CO_PARA_TASK *task);
+
 /*! \brief PARAMETER OBJECT READ ACCESS
 *
 *    This function is responsible for the delivery of the store- and
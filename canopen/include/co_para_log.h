@@ -0,0 +1,186 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PARA_LOG_H_
+#define CO_PARA_LOG_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_para.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_PARA_LOG_HDR      8    /*!< size of sector and record header      */
+#define CO_PARA_LOG_ALIGN    4    /*!< flash programming granularity         */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PARAMETER LOG FLASH DRIVER
+*
+*    This structure holds the geometry and the access functions of the flash
+*    memory, which is used by the parameter log. The flash memory is a
+*    sequence of equal sized sectors; an erased byte reads 0xFF. The
+*    programming is called with addresses and lengths, which are multiples
+*    of CO_PARA_LOG_ALIGN. All functions return 0 on success and a value
+*    <0 on error.
+*/
+typedef struct CO_PARA_LOG_DRV_T {
+    uint32_t  SecSize;           /*!< size of a sector in bytes              */
+    uint8_t   SecNum;            /*!< number of sectors                      */
+    int16_t (*Read) (uint32_t addr, uint8_t *buf, uint32_t len);
+    int16_t (*Prog) (uint32_t addr, const uint8_t *buf, uint32_t len);
+    int16_t (*Erase)(uint8_t sec);
+
+} CO_PARA_LOG_DRV;
+
+/*! \brief PARAMETER LOG
+*
+*    This structure holds all data, which are needed for keeping parameter
+*    groups in flash memory as a log of changed records. The used sectors
+*    are a ring, which is compacted into a snapshot of all parameter groups
+*    when the free sectors are needed.
+*/
+typedef struct CO_PARA_LOG_T {
+    const CO_PARA_LOG_DRV *Drv;  /*!< flash driver                           */
+    CO_PARA  **Grp;              /*!< parameter group table                  */
+    uint8_t   *Buf;              /*!< scratch buffer (largest group size)    */
+    uint32_t   Seq;              /*!< sequence number of head sector         */
+    uint32_t   Pos;              /*!< append offset in head sector           */
+    uint32_t   Written;          /*!< number of programmed bytes             */
+    uint32_t   Erased;           /*!< number of erased sectors               */
+    uint8_t    Num;              /*!< number of parameter groups             */
+    uint8_t    Snap;             /*!< number of sectors for a snapshot       */
+    uint8_t    Base;             /*!< oldest sector of the log               */
+    uint8_t    Used;             /*!< number of sectors in the log           */
+    uint8_t    Act;              /*!< group in storage (or 0xFF)             */
+    uint8_t    Compact;          /*!< compaction in progress                 */
+
+} CO_PARA_LOG;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PARAMETER LOG INITIALIZATION
+*
+*    This function initializes the parameter log for the given parameter
+*    groups and mounts the log in the flash memory. An interrupted write or
+*    compaction of the previous run is detected and completed; a flash
+*    memory without log is formatted.
+*
+*    The flash memory needs at least twice the number of sectors of a
+*    snapshot of all parameter groups.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param drv
+*    reference to flash driver
+*
+* \param grp
+*    reference to table of parameter group references
+*
+* \param num
+*    number of parameter groups in table
+*
+* \param buf
+*    scratch buffer with the size of the largest parameter group
+*
+* \retval   =CO_ERR_NONE    parameter log is initialized
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaLogInit(CO_PARA_LOG           *log,
+                      const CO_PARA_LOG_DRV *drv,
+                      CO_PARA              **grp,
+                      uint8_t                num,
+                      uint8_t               *buf);
+
+/*! \brief  LOAD PARAMETER GROUP
+*
+*    This function replays the records of the given parameter group into
+*    the parameter group memory. The parameter group memory is unchanged,
+*    if the parameter group is not stored. The replay reads the headers of
+*    the records of other parameter groups only, therefore the load time is
+*    bounded by the size of the flash memory.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param pg
+*    reference to parameter group
+*
+* \retval   =CO_ERR_NONE    parameter group is loaded
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaLogLoad(CO_PARA_LOG *log, CO_PARA *pg);
+
+/*! \brief  SAVE PARAMETER GROUP
+*
+*    This function appends the changed ranges of the given parameter group
+*    to the log. Ranges with small unchanged gaps are merged into a single
+*    record.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param pg
+*    reference to parameter group
+*
+* \retval   =CO_ERR_NONE    parameter group is saved
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaLogSave(CO_PARA_LOG *log, CO_PARA *pg);
+
+/*! \brief  RESTORE DEFAULT PARAMETER GROUP
+*
+*    This function appends a default record of the given parameter group
+*    to the log. The following load of the parameter group copies the
+*    default memory block into the parameter group memory.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param pg
+*    reference to parameter group
+*
+* \retval   =CO_ERR_NONE    parameter group default is saved
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaLogDefault(CO_PARA_LOG *log, CO_PARA *pg);
+
+/*! \brief  COMPACT PARAMETER LOG
+*
+*    This function writes a snapshot of all parameter groups into the free
+*    sectors and erases the previous sectors of the log. The compaction is
+*    called automatically, when the log runs out of free sectors. The
+*    application may call this function in idle times.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \retval   =CO_ERR_NONE    parameter log is compacted
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COParaLogCompact(CO_PARA_LOG *log);
+
+#endif  /* #ifndef CO_PARA_LOG_H_ */
@@ -57,6 +57,8 @@
 
 #define CO_TPDO_MS(x)       ((((uint32_t)(x))*CO_TMR_TICKS_PER_SEC)/1000)
 
+#define CO_PDO_MAP_LEN(m)   ((uint8_t)((m) & 0xFF)) /*!< mapping length in bit */
+
 #define CO_TASYNC   ((CO_OBJ_TYPE *)&COTAsync)   /*!< Asynchronous TPDO      */
 #define CO_TEVENT   ((CO_OBJ_TYPE *)&COTEvent)   /*!< TPDO Event Timer       */
 #define CO_TPDONUM  ((CO_OBJ_TYPE *)&COTPdoMapN) /*!< Dynamic Map Numbers    */
@@ -68,6 +70,20 @@
 * PUBLIC TYPES
 ******************************************************************************/
 
+/*! \brief PDO MAPPING ENTRY
+*
+*    This structure holds a single PDO mapping entry, compiled into the
+*    position and mask of the signal within the PDO payload. The payload is
+*    handled as a single 64bit little endian word, so packing or unpacking
+*    a signal of any bit length is a single shift and mask operation.
+*/
+typedef struct CO_PDO_MAP_T {
+    struct CO_OBJ_T *Obj;        /*!< pointer to mapped object               */
+    uint64_t         Mask;       /*!< bit mask of signal within payload      */
+    uint8_t          Shift;      /*!< bit position of signal within payload  */
+
+} CO_PDO_MAP;
+
 /*! \brief TPDO SIGNAL LINK TABLE
 *
 *    This structure holds all data, which are needed for managing the links
@@ -88,13 +104,14 @@ typedef struct CO_TPDO_LINK_T {
 typedef struct CO_TPDO_T {
     struct CO_NODE_T *Node;        /*!< link to parent CANopen node          */
     uint32_t          Identifier;  /*!< message identifier                   */
-    struct CO_OBJ_T  *Map[8];      /*!< pointer list with mapped objects     */
+    CO_PDO_MAP        Map[CO_PDO_MAP_N]; /*!< compiled mapping entries       */
     int16_t           EvTmr;       /*!< event timer id                       */
     uint16_t          Event;       /*!< event time in timer ticks            */
     int16_t           InTmr;       /*!< inhibit timer id                     */
     uint16_t          Inhibit;     /*!< inhibit time in timer ticks          */
     uint8_t           Flags;       /*!< info flags                           */
     uint8_t           ObjNum;      /*!< Number of linked objects             */
+    uint8_t           Size;        /*!< PDO payload size in byte             */
 
 } CO_TPDO;
 
@@ -106,9 +123,13 @@ typedef struct CO_TPDO_T {
 typedef struct CO_RPDO_T {
     struct CO_NODE_T *Node;        /*!< link to parent CANopen node          */
     uint32_t          Identifier;  /*!< message identifier                   */
-    struct CO_OBJ_T  *Map[8];      /*!< pointer list with mapped objects     */
+    CO_PDO_MAP        Map[CO_PDO_MAP_N]; /*!< compiled mapping entries       */
     uint8_t           ObjNum;      /*!< Number of linked objects             */
     uint8_t           Flag;        /*!< Flags attributed of PDO              */
+#if CO_RPDO_SNAPSHOT > 0
+    volatile uint32_t Seq;         /*!< snapshot sequence counter            */
+    uint64_t          Data;        /*!< last written PDO payload             */
+#endif
 
 } CO_RPDO;
 
@@ -197,6 +218,83 @@ void COTPdoTrigObj(CO_TPDO *tpdo, struct CO_OBJ_T *obj);
 */
 void COTPdoTrigPdo(CO_TPDO *tpdo, uint16_t num);
 
+#if CO_RPDO_SNAPSHOT > 0
+
+/*! \brief RPDO SNAPSHOT
+*
+*    This function reads a consistent snapshot of the mapped values of the
+*    given RPDO without locks. The values are the raw (zero extended) mapped
+*    values of the last received PDO in the mapping order (without dummy
+*    entries). The function retries up to CO_RPDO_RETRY times, while the
+*    receive path writes the RPDO on another core.
+*
+* \note
+*    The mapping of the RPDO must not be changed during the snapshot. The
+*    function fails when called within the receive path of the same RPDO
+*    (e.g. from a write callback of a mapped object).
+*
+* \param pdo
+*    Pointer to RPDO (e.g. &node->RPdo[num])
+*
+* \param val
+*    Pointer to value buffer
+*
+* \param max
+*    Size of value buffer (number of values)
+*
+* \retval  >=0    number of values in the snapshot
+* \retval  <0     bad argument or no consistent snapshot
+*/
+int16_t CORPdoSnapshot(CO_RPDO *pdo, uint64_t *val, uint8_t max);
+
+/*! \brief RPDO READ BEGIN
+*
+*    This function starts a lock-free read of objects, which are mapped
+*    into the given RPDO. The function waits (up to CO_RPDO_RETRY polls)
+*    until a running write of the RPDO is finished and returns the sequence
+*    counter for the following call of CORPdoReadRetry(). A write, which
+*    is not finished within the polls, lets CORPdoReadRetry() request a
+*    repetition.
+*
+* \note
+*    The read loop must not run within the receive path of the same RPDO
+*    (e.g. in a write callback of a mapped object): the write is never
+*    finished and the loop doesn't terminate.
+*
+*    Example: reading two mapped objects as a consistent pair:
+*
+*        do {
+*            seq = CORPdoReadBegin(&node->RPdo[0]);
+*            x   = PosX;
+*            y   = PosY;
+*        } while (CORPdoReadRetry(&node->RPdo[0], seq) != 0);
+*
+* \param pdo
+*    Pointer to RPDO (e.g. &node->RPdo[num])
+*
+* \return
+*    sequence counter at begin of read
+*/
+uint32_t CORPdoReadBegin(CO_RPDO *pdo);
+
+/*! \brief RPDO READ RETRY
+*
+*    This function finishes a lock-free read of objects, which are mapped
+*    into the given RPDO, and checks the consistency of the read values.
+*
+* \param pdo
+*    Pointer to RPDO (e.g. &node->RPdo[num])
+*
+* \param seq
+*    Sequence counter of CORPdoReadBegin()
+*
+* \retval  =0     the read values are consistent
+* \retval  !=0    the RPDO is written in the meantime; repeat the read
+*/
+int16_t CORPdoReadRetry(CO_RPDO *pdo, uint32_t seq);
+
+#endif
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -263,8 +361,12 @@ void COTPdoReset(CO_TPDO *pdo, uint16_t num);
 *    puts the pre-calculated values in the CAN message configuration.
 *
 *    The following list shows the considered mapping profile entries:
-*    -# 0x1A00+[num] : 0x00 = Number of mapped signals (0..8)
-*    -# 0x1A00+[num] : 0x01..0x08 = Mapped signal
+*    -# 0x1A00+[num] : 0x00 = Number of mapped signals (0..CO_PDO_MAP_N)
+*    -# 0x1A00+[num] : 0x01..CO_PDO_MAP_N = Mapped signal
+*
+*    The mapping length is given in bit and may be any value between 1 and
+*    the size of the mapped object. Each entry is compiled into a shift and
+*    mask operation on the PDO payload.
 *
 * \param pdo
 *    Pointer to start of TPDO array
@@ -280,6 +382,33 @@ void COTPdoReset(CO_TPDO *pdo, uint16_t num);
 */
 int16_t COTPdoGetMap(CO_TPDO *pdo, uint16_t num);
 
+/*! \brief COMPILE PDO MAPPING ENTRY
+*
+*    This function checks the mapping length against the mapped object and
+*    pre-calculates the shift and mask of the signal within the PDO payload.
+*
+* \param map
+*    Pointer to mapping entry
+*
+* \param obj
+*    Pointer to mapped object entry
+*
+* \param node
+*    Pointer to parent node object
+*
+* \param pos
+*    Bit position of the signal within the PDO payload
+*
+* \param len
+*    Length of the signal in bit
+*
+* \retval  =0    Mapping entry is valid and compiled
+* \retval  <0    Mapping length doesn't fit to the object or PDO payload
+*
+* \internal
+*/
+int16_t COPdoMapCompile(CO_PDO_MAP *map, struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint8_t pos, uint8_t len);
+
 /*! \brief TPDO TRIGGER EVENT TIMER CALLBACK
 *
 *    This function is used to trigger a PDO with the event timer object
@@ -490,8 +619,12 @@ int16_t CORPdoReset(CO_RPDO *pdo, int16_t num);
 *    and puts the pre-calculated values in the CAN message configuration.
 *
 *    The following list shows the considered mapping profile entries:
-*    -# 0x1600+[num] : 0x00 = Number of mapped signals (0..8)
-*    -# 0x1600+[num] : 0x01..0x08 = Mapped signal
+*    -# 0x1600+[num] : 0x00 = Number of mapped signals (0..CO_PDO_MAP_N)
+*    -# 0x1600+[num] : 0x01..CO_PDO_MAP_N = Mapped signal
+*
+*    The mapping length is given in bit and may be any value between 1 and
+*    the size of the mapped object. Dummy entries skip the given number of
+*    bits and are not stored in the compiled mapping.
 *
 * \param pdo
 *    Pointer to start of RPDO array
@@ -546,7 +679,9 @@ void CORPdoRx(CO_RPDO *pdo, uint16_t num, CO_IF_FRM *frm);
 /*! \brief RPDO WRITE
 *
 *    This function is used to write the received CAN message data to the
-*    object dictionary.
+*    object dictionary. With CO_RPDO_SNAPSHOT enabled, the writes of all
+*    mapped objects are enclosed by the increments of the RPDO sequence
+*    counter.
 *
 * \param pdo
 *    Pointer to start of RPDO array
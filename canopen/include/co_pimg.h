@@ -0,0 +1,276 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PIMG_H_
+#define CO_PIMG_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_pdo.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_PIMG_MAGIC   0x49504F43u   /*!< process image signature 'COPI'    */
+
+/*! \brief READ RETRIES
+*
+*    This define limits the number of read attempts of a consistent PDO
+*    snapshot, while the writer modifies the PDO segment.
+*/
+#ifndef CO_PIMG_RETRY
+#define CO_PIMG_RETRY       100
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PROCESS IMAGE PDO SEGMENT
+*
+*    This structure holds the mapped values of a single PDO in the process
+*    image. Each part of the segment has a single writer and is guarded by
+*    a sequence counter: the writer increments the counter before and after
+*    the modification, therefore an odd counter marks a modification in
+*    progress. The mapping (Map, Num, Key) is written by the node only. The
+*    values (Seq, Val) are written by the node for RPDOs and by the consumer
+*    for TPDOs. The values are the raw (zero extended) mapped object values
+*    in the mapping order.
+*/
+typedef struct CO_PIMG_PDO_T {
+    volatile uint32_t Seq;              /*!< value sequence counter          */
+    volatile uint32_t Map;              /*!< mapping sequence counter        */
+    volatile uint32_t Ack;              /*!< mapping counter of the values   */
+    uint8_t           Num;              /*!< number of mapped objects        */
+    uint8_t           Rsv[3];           /*!< reserved (alignment)            */
+    uint32_t          Key[CO_PDO_MAP_N];/*!< object keys (index/subindex)    */
+    uint64_t          Val[CO_PDO_MAP_N];/*!< object values                   */
+
+} CO_PIMG_PDO;
+
+/*! \brief PROCESS IMAGE MEMORY
+*
+*    This structure is the layout of the process image memory. The memory
+*    contains no pointers and may be placed in memory, which is shared with
+*    other processes (e.g. POSIX shared memory). The RPDO segments are
+*    written by the node only; the values of the TPDO segments are written
+*    by a single consumer of the process image.
+*/
+typedef struct CO_PIMG_MEM_T {
+    volatile uint32_t Magic;            /*!< process image signature         */
+    uint16_t          RPdoNum;          /*!< number of RPDO segments         */
+    uint16_t          TPdoNum;          /*!< number of TPDO segments         */
+    CO_PIMG_PDO       RPdo[CO_RPDO_N];  /*!< received PDO values             */
+    CO_PIMG_PDO       TPdo[CO_TPDO_N];  /*!< transmit PDO values             */
+
+} CO_PIMG_MEM;
+
+/*! \brief PROCESS IMAGE
+*
+*    This structure holds all data, which are needed for mirroring the PDO
+*    mapped objects of a node into the process image memory.
+*/
+typedef struct CO_PIMG_T {
+    struct CO_NODE_T *Node;             /*!< link to parent node             */
+    CO_PIMG_MEM      *Mem;              /*!< process image memory            */
+    uint32_t          TSeq[CO_TPDO_N];  /*!< applied TPDO sequence counters  */
+
+} CO_PIMG;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PROCESS IMAGE INITIALIZATION
+*
+*    This function initializes the process image memory with the current
+*    mapping and the current values of all PDOs of the node and links the
+*    process image to the node. The signature is set as last action, the
+*    consumer may wait for the signature before accessing the segments.
+*
+* \param pimg
+*    reference to process image structure
+*
+* \param node
+*    reference to parent node
+*
+* \param mem
+*    reference to process image memory
+*
+* \retval   =CO_ERR_NONE    process image is initialized
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COPimgInit(CO_PIMG *pimg, struct CO_NODE_T *node, CO_PIMG_MEM *mem);
+
+/*! \brief  READ PDO SEGMENT
+*
+*    This function reads a consistent snapshot of the values of the given
+*    PDO segment without any locking. The function is intended for the
+*    consumer of the process image.
+*
+* \param seg
+*    reference to PDO segment
+*
+* \param val
+*    reference to value buffer
+*
+* \param max
+*    size of the value buffer (number of values)
+*
+* \retval   >=0     number of values in the snapshot
+* \retval   <0      bad argument or no consistent snapshot within
+*                   CO_PIMG_RETRY attempts
+*/
+int16_t COPimgRead(CO_PIMG_PDO *seg, uint64_t *val, uint8_t max);
+
+/*! \brief  WRITE PDO SEGMENT
+*
+*    This function writes values into the given PDO segment. The function
+*    is intended for the single consumer, which provides the values of the
+*    TPDO segments. The node applies the values to the object dictionary
+*    within the next call of CONodeProcess(). The values are marked with
+*    the current mapping counter of the segment: values, which are written
+*    for a previous mapping, are not applied. After a change of the mapping
+*    counter, the consumer writes all values of the segment.
+*
+* \param seg
+*    reference to PDO segment
+*
+* \param pos
+*    position of the first value in the PDO segment
+*
+* \param val
+*    reference to the values
+*
+* \param num
+*    number of values
+*
+* \retval   =CO_ERR_NONE    values are written
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+int16_t COPimgWrite(CO_PIMG_PDO *seg, uint8_t pos, uint64_t *val, uint8_t num);
+
+/*! \brief  FIND OBJECT IN PDO SEGMENTS
+*
+*    This function searches the given object within the given table of PDO
+*    segments (e.g. mem->RPdo with mem->RPdoNum).
+*
+* \param seg
+*    reference to the first PDO segment
+*
+* \param num
+*    number of PDO segments
+*
+* \param key
+*    object key (index and subindex, see CO_DEV())
+*
+* \param pos
+*    reference to the position of the object in the found PDO segment
+*
+* \retval   !=0     reference to the PDO segment
+* \retval   =0      object is not mapped
+*/
+CO_PIMG_PDO *COPimgFind(CO_PIMG_PDO *seg, uint16_t num, uint32_t key, uint8_t *pos);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PUBLISH RPDO MAPPING
+*
+*    This function writes the mapping and the current object values of the
+*    given RPDO into the process image. The function is called after a
+*    successful change of the RPDO mapping.
+*
+* \param pimg
+*    reference to process image structure (or 0)
+*
+* \param num
+*    RPDO number
+*/
+void COPimgRPdoMap(CO_PIMG *pimg, uint16_t num);
+
+/*! \brief  PUBLISH TPDO MAPPING
+*
+*    This function writes the mapping of the given TPDO into the process
+*    image. The current object values are written during the
+*    initialization only; afterwards the values are owned by the consumer
+*    and the values of the previous mapping are discarded. The function is
+*    called after a successful change of the TPDO mapping.
+*
+* \param pimg
+*    reference to process image structure (or 0)
+*
+* \param num
+*    TPDO number
+*/
+void COPimgTPdoMap(CO_PIMG *pimg, uint16_t num);
+
+/*! \brief  PUBLISH RECEIVED PDO
+*
+*    This function writes the values of the given received PDO payload
+*    into the corresponding RPDO segment of the process image.
+*
+* \param pimg
+*    reference to process image structure (or 0)
+*
+* \param pdo
+*    reference to received PDO
+*
+* \param data
+*    PDO payload
+*/
+void COPimgRPdoPush(CO_PIMG *pimg, CO_RPDO *pdo, uint64_t data);
+
+/*! \brief  APPLY TPDO SEGMENTS
+*
+*    This function writes the values of all TPDO segments, which are
+*    changed by the consumer, into the object dictionary. The objects with
+*    asynchronous transmission are written last and trigger the
+*    corresponding TPDO with all new values. The function is called at the
+*    beginning of CONodeProcess().
+*
+* \param pimg
+*    reference to process image structure (or 0)
+*/
+void COPimgCheck(CO_PIMG *pimg);
+
+/*! \brief  LOCK PDO SEGMENT
+*
+*    This function marks the start of a modification of the part of a PDO
+*    segment, which is guarded by the given sequence counter.
+*
+* \param seq
+*    reference to sequence counter (e.g. &seg->Seq)
+*/
+void COPimgLock(volatile uint32_t *seq);
+
+/*! \brief  UNLOCK PDO SEGMENT
+*
+*    This function marks the end of a modification of the part of a PDO
+*    segment, which is guarded by the given sequence counter.
+*
+* \param seq
+*    reference to sequence counter (e.g. &seg->Seq)
+*/
+void COPimgUnlock(volatile uint32_t *seq);
+
+#endif  /* #ifndef CO_PIMG_H_ */
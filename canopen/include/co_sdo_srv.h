@@ -52,8 +52,12 @@
 
 #define CO_SDO_ID_OFF      ((uint32_t)1<<31)  /*!< Disabled SDO server / COBID            */
 
-#define CO_SDO_BUF_SEG     127
-#define CO_SDO_BUF_BYTE    (CO_SDO_BUF_SEG*7) /*!< transfer buffer size in byte           */
+#if (CO_SDO_BUF_SEG < 1) || (CO_SDO_BUF_SEG > 127)
+#error "CO_SDO_BUF_SEG must be in range 1..127"
+#endif
+#if (CO_SDO_BUF_BYTE < (CO_SDO_BUF_SEG*7))
+#error "CO_SDO_BUF_BYTE must hold at least one block of CO_SDO_BUF_SEG segments"
+#endif
 
 #define CO_TSDOID  ((CO_OBJ_TYPE *)&COTSdoId) /*!< Object Type Dynamic SDO Identifier     */
 
@@ -97,6 +101,19 @@ typedef struct CO_SDO_SEG_T {
 
 } CO_SDO_SEG;
 
+/*! \brief SDO VALUE TRANSFER
+*
+*    This structure holds the value of a numeric object entry (e.g. a 64bit
+*    value), which is transfered with a segmented or block transfer. The
+*    value is held in CANopen byte order (little endian).
+*/
+typedef struct CO_SDO_VAL_T {
+    uint8_t   Data[8];           /*!< Value bytes in little endian order     */
+    uint8_t   Size;              /*!< Size of value, 0 for buffer objects    */
+    uint8_t   Num;               /*!< Number of transfered bytes             */
+
+} CO_SDO_VAL;
+
 /*! \brief SDO BLOCK TRANSFER STATES
 *
 *    This enumeration holds the possible SDO server block transfer states.
@@ -119,12 +136,28 @@ typedef struct CO_SDO_BLK_T {
     enum CO_SDO_BLK_STATE_T State;      /*!< block transfer state            */
     uint32_t                Size;       /*!< Size of object entry            */
     uint32_t                Len;        /*!< remaining block length in byte  */
+    uint8_t                *Data;       /*!< start of current block data     */
+    uint32_t                Num;        /*!< number of bytes in current block*/
+    uint32_t                Pre;        /*!< prefetched bytes for next block */
+    uint8_t                 SegMax;     /*!< configured max. segments/block  */
     uint8_t                 SegNum;     /*!< number of segments in block     */
     uint8_t                 SegCnt;     /*!< current segment number          */
     uint8_t                 LastValid;  /*!< valid bytes in last segment     */
 
 } CO_SDO_BLK;
 
+/*! \brief SDO OBJECT CACHE ENTRY
+*
+*    This structure holds a resolved object entry of a previous SDO
+*    request, including the precomputed object size.
+*/
+typedef struct CO_SDO_CACHE_T {
+    uint32_t            Key;     /*!< Object index and subindex (CO_DEV)     */
+    struct CO_OBJ_T    *Obj;     /*!< Resolved object entry reference        */
+    uint32_t            Size;    /*!< Fixed object size, 0 if type dependent */
+
+} CO_SDO_CACHE;
+
 /*! \brief SDO SERVER
 *
 *    This structure holds all data, which are needed for managing a
@@ -138,12 +171,47 @@ typedef struct CO_SDO_T {
     uint32_t            TxId;    /*!< SDO response CAN identifier            */
     uint16_t            Idx;     /*!< Extracted Multiplexer Index            */
     uint8_t             Sub;     /*!< Extracted Multiplexer Subindex         */
+    uint8_t             Defer;   /*!< Deferred download response pending     */
     struct CO_SDO_BUF_T Buf;     /*!< Transfer buffer management structure   */
     struct CO_SDO_SEG_T Seg;     /*!< Segmented transfer control structure   */
     struct CO_SDO_BLK_T Blk;     /*!< Block transfer control structure       */
+    struct CO_SDO_VAL_T Val;     /*!< Value transfer control structure       */
+#if CO_SDO_CACHE_N > 0
+    struct CO_SDO_CACHE_T Cache[CO_SDO_CACHE_N]; /*!< Object cache (MRU first) */
+    uint16_t            CacheGen;/*!< Dictionary generation of cache content */
+#endif
 
 } CO_SDO;
 
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SET SDO BLOCK SIZE
+*
+*    This function sets the maximal number of segments per block for SDO
+*    block transfers of the given SDO server 'num'. The setting is kept
+*    over communication resets. When two blocks of the given size fit into
+*    the SDO transfer buffer (CO_SDO_BUF_BYTE), the block upload reads the
+*    next block from the object while the current block is transmitted.
+*
+* \note
+*    The new block size is used with the next initiated block transfer.
+*
+* \param srv
+*    Ptr to root element of SDO server array
+*
+* \param num
+*    Number of SDO server
+*
+* \param segnum
+*    Maximal number of segments per block (1..CO_SDO_BUF_SEG)
+*
+* \retval  =0    block size is changed
+* \retval  <0    an error is detected
+*/
+int16_t COSdoSetBlkSize(CO_SDO *srv, uint8_t num, uint8_t segnum);
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -254,6 +322,27 @@ int16_t COSdoResponse(CO_SDO *srv);
 */
 int16_t COSdoGetObject(CO_SDO *srv, uint16_t mode);
 
+/*! \brief  FIND OBJECT IN CACHE
+*
+*    This function looks up the object entry with the given key within the
+*    object cache of the SDO server. The cache keeps the most recently used
+*    object entries first and is cleared, when the object dictionary
+*    generation changed. On a cache miss, the object entry is searched in
+*    the object dictionary and added as most recent entry to the cache.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param key
+*    Object entry key (generated with CO_DEV)
+*
+* \retval  >0    pointer to the object entry
+* \retval  =0    object entry is not existing in dictionary
+*
+* \internal
+*/
+struct CO_OBJ_T *COSdoCacheFind(CO_SDO *srv, uint32_t key);
+
 /*! \brief  GET SIZE OF OBJECT
 *
 *    This function checks the given size acc. the addressed object size in
@@ -306,6 +395,28 @@ int16_t COSdoUploadExpedited(CO_SDO *srv);
 */
 int16_t COSdoDownloadExpedited(CO_SDO *srv);
 
+/*! \brief  DEFERRED DOWNLOAD RESPONSE
+*
+*    This function sends the response of an expedited download, which is
+*    deferred by the object type with the result CO_ERR_SDO_DEFER. The
+*    response confirms the download, or aborts the transfer with the given
+*    error code. Until the response is sent, the SDO server rejects further
+*    requests; a client abort cancels the deferred response.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param idx
+*    Index of the downloaded object
+*
+* \param sub
+*    Subindex of the downloaded object
+*
+* \param err
+*    The SDO abort code (or 0 for a successful download)
+*/
+void COSdoDeferred(CO_SDO *srv, uint16_t idx, uint8_t sub, uint32_t err);
+
 /*! \brief  ABORT PROTOCOL
 *
 *    This function generates the response for a SDO abort.
@@ -320,6 +431,85 @@ int16_t COSdoDownloadExpedited(CO_SDO *srv);
 */
 void COSdoAbort(CO_SDO *srv, uint32_t err);
 
+/*! \brief  START READING OBJECT FOR TRANSFER
+*
+*    This function starts reading the addressed object entry for a
+*    segmented or block upload. Numeric object entries (without a type
+*    specific size function) are read completely with COObjRdValue() into
+*    the value transfer structure. Other object entries are read with
+*    COObjRdBufStart().
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*
+* \internal
+*/
+int16_t COSdoObjRdStart(struct CO_SDO_T *srv);
+
+/*! \brief  CONTINUE READING OBJECT FOR TRANSFER
+*
+*    This function reads the next bytes of the addressed object entry for a
+*    segmented or block upload into the given buffer.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param buf
+*    Pointer to destination buffer
+*
+* \param len
+*    Number of bytes to read
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*
+* \internal
+*/
+int16_t COSdoObjRdCont(struct CO_SDO_T *srv, uint8_t *buf, uint32_t len);
+
+/*! \brief  START WRITING OBJECT FOR TRANSFER
+*
+*    This function starts writing the addressed object entry for a
+*    segmented or block download. For numeric object entries (without a
+*    type specific size function) the received bytes are collected in the
+*    value transfer structure. Other object entries are written with
+*    COObjWrBufStart().
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*
+* \internal
+*/
+int16_t COSdoObjWrStart(struct CO_SDO_T *srv);
+
+/*! \brief  CONTINUE WRITING OBJECT FOR TRANSFER
+*
+*    This function writes the given bytes to the addressed object entry for
+*    a segmented or block download. A numeric object entry is written with
+*    COObjWrValue(), when all bytes of the value are received.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param buf
+*    Pointer to source buffer
+*
+* \param len
+*    Number of bytes to write
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*
+* \internal
+*/
+int16_t COSdoObjWrCont(struct CO_SDO_T *srv, uint8_t *buf, uint32_t len);
+
 /*! \brief  INIT SEGMENTED UPLOAD
 *
 *    This function generates the response for 'Initiate SDO Upload Protocol'.
@@ -562,6 +752,24 @@ int16_t COSdoInitUploadBlock(struct CO_SDO_T *srv);
 */
 int16_t COSdoUploadBlock(struct CO_SDO_T *srv);
 
+/*! \brief  READ BLOCK DATA
+*
+*    This function reads the next bytes of the addressed object into the
+*    given location within the SDO transfer buffer.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param buf
+*    Pointer to destination within the transfer buffer
+*
+* \param num
+*    Number of bytes to read
+*
+* \internal
+*/
+void COSdoReadBlock(struct CO_SDO_T *srv, uint8_t *buf, uint32_t num);
+
 /*! \brief  CONFIRM BLOCK UPLOAD
 *
 *    This function generates the response for 'Upload SDO Block Segment
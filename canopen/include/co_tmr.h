@@ -104,6 +104,7 @@ typedef struct CO_TMR_ACTION_T {
     CO_TMR_FUNC             Func;          /*!< pointer to callback function */
     void                   *Para;          /*!< callback function parameter  */
     uint32_t                CycleTime;     /*!< action cycle time in ticks   */
+    uint8_t                 Prio;          /*!< prioritized action           */
 
 } CO_TMR_ACTION;
 
@@ -149,6 +150,7 @@ typedef struct CO_TMR_T {
     struct CO_TMR_TIME_T   *Elapsed;   /*!< Timer event elapsed list         */
     uint32_t                Time;      /*!< Ticks of next event since create */
     uint32_t                Delay;     /*!< Ticks of next event from now     */
+    uint32_t                Ticks;     /*!< Number of serviced ticks         */
 
 } CO_TMR;
 
@@ -185,6 +187,37 @@ int16_t COTmrCreate(CO_TMR      *tmr,
                     CO_TMR_FUNC  func,
                     void        *para);
 
+/*! \brief CREATE PRIORITIZED TIMER
+*
+*    This function creates the defined action like COTmrCreate(), but the
+*    action is performed ahead of all not prioritized actions, which are
+*    elapsed with the same timer tick. This is intended for safety relevant
+*    cyclic messages, like the heartbeat.
+*
+* \param tmr
+*    Pointer to timer structure
+*
+* \param startTime
+*    delta time in ticks for the first timer event
+*
+* \param cycleTime
+*    if != 0, the delta time in ticks for the cyclic timer events
+*
+* \param func
+*    pointer to the action callback function
+*
+* \param para
+*    pointer to the callback function parameter
+*
+* \retval  >=0    the action identifier
+* \retval  <0     an error is detected
+*/
+int16_t COTmrCreatePrio(CO_TMR      *tmr,
+                        uint32_t     start,
+                        uint32_t     cycle,
+                        CO_TMR_FUNC  func,
+                        void        *para);
+
 /*! \brief DELETE TIMER
 *
 *    This function deletes the defined action and removes the timer, if this
@@ -286,6 +319,41 @@ void COTmrClear(CO_TMR *tmr);
 */
 void COTmrReset(CO_TMR *tmr);
 
+/*! \brief ADD TIMER ACTION
+*
+*    This function allocates an action info, links the action into the
+*    event timer list and returns the action identifier.
+*
+* \param tmr
+*    Pointer to timer structure
+*
+* \param startTime
+*    delta time in ticks for the first timer event
+*
+* \param cycleTime
+*    if != 0, the delta time in ticks for the cyclic timer events
+*
+* \param func
+*    pointer to the action callback function
+*
+* \param para
+*    pointer to the callback function parameter
+*
+* \param prio
+*    if != 0, the action is prioritized
+*
+* \retval  >=0    the action identifier
+* \retval  <0     an error is detected
+*
+* \internal
+*/
+int16_t COTmrAdd(CO_TMR      *tmr,
+                 uint32_t     startTime,
+                 uint32_t     cycleTime,
+                 CO_TMR_FUNC  func,
+                 void        *para,
+                 uint8_t      prio);
+
 /*! \brief INSERT TIMER
 *
 *    This function inserts an action into the used timer list. First, this
@@ -293,7 +361,8 @@ void COTmrReset(CO_TMR *tmr);
 *    the action to the existing timer info. If no timer event exists on the
 *    same time, a new timer event will be created and inserted into the used
 *    timer list in a way, that the resulting used timer list is a sorted list
-*    with precalculated delta times between the time events.
+*    with precalculated delta times between the time events. Prioritized
+*    actions are linked ahead of all not prioritized actions of the event.
 *
 * \param tmr
 *    Pointer to timer structure
@@ -30,6 +30,7 @@
 void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
 {
     int16_t  err;
+    uint8_t  n;
 
     node->If.Drv   = spec->CanDrv;
     node->SdoBuf   = spec->SdoBuf;
@@ -37,6 +38,14 @@ void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
     node->NodeId   = spec->NodeId;
     node->Error    = CO_ERR_NONE;
     node->Nmt.Tmr  = -1;
+    node->Nmt.HbTmr = -1;
+    node->Nmt.Mst   = 0;
+    node->Lss.Mst   = 0;
+    node->ParaTask  = 0;
+    node->SdoDefer  = 0;
+#if CO_PDO_PIMG > 0
+    node->Pimg      = 0;
+#endif
     err = COLssLoad(&node->Baudrate, &node->NodeId);
     if (err != CO_ERR_NONE) {
         node->Error = CO_ERR_LSS_LOAD;
@@ -45,6 +54,7 @@ void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
     COTmrInit(&node->Tmr, node, spec->TmrMem, spec->TmrNum);
     COIfInit(&node->If, node);
     COIfEnable(&node->If, node->Baudrate);
+    node->Dict.Val = spec->DictVal;
     err = CODictInit(&node->Dict, node, spec->Dict, spec->DictLen);
     if (err < 0) {
         return;
@@ -52,9 +62,17 @@ void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
     CONodeParaLoad(node, CO_RESET_COM);
     CONodeParaLoad(node, CO_RESET_NODE);
     CONmtInit(&node->Nmt, node);
+    for (n = 0; n < CO_SDOS_N; n++) {
+        node->Sdo[n].Blk.SegMax = CO_SDO_BUF_SEG;
+    }
     COSdoInit(node->Sdo, node);
     COTPdoClear(node->TPdo, node);
     CORPdoClear(node->RPdo, node);
+    node->Emcy.Tx.Tmr = -1;
+    node->Emcy.Tx.Num = 0;
+    node->Emcy.Cons   = 0;
+    node->Emcy.Root   = 0;
+    node->Emcy.Node   = node;
     if (spec->EmcyCode != 0) {
         COEmcyInit(&node->Emcy, node, spec->EmcyCode); 
     }
@@ -128,6 +146,7 @@ int16_t CONodeParaLoad(CO_NODE *node, CO_NMT_RESET type)
                     node->Error = CO_ERR_PARA_LOAD;
                     result      = -1;
                 }
+                COParaLoaded(pg, node, err);
             }
         }
     }
@@ -144,13 +163,23 @@ void CONodeProcess(CO_NODE *node)
     CO_SDO   *srv;
     int16_t   err;
     uint8_t   allowed;
+    uint8_t   received;
     int16_t   num;
 
-    err = COIfRead(&node->If, &frm);
+    COParaTaskCheck(node->ParaTask);
+#if CO_PDO_PIMG > 0
+    COPimgCheck(node->Pimg);
+#endif
+
+    received = 0;
+    err      = COIfRead(&node->If, &frm);
     if (err < 0) {
         allowed = 0;
     } else {
         allowed = node->Nmt.Allowed;
+        if (err > 0) {
+            received = 1;
+        }
     }
 
     err = COLssCheck(&node->Lss, &frm);
@@ -159,6 +188,8 @@ void CONodeProcess(CO_NODE *node)
             (void)COIfSend(&node->If, &frm);
         }
         allowed = 0;
+    } else if ((received != 0) && (COLssMstCheck(node->Lss.Mst, &frm) >= 0)) {
+        allowed = 0;
     }
 
     if ((allowed & CO_SDO_ALLOWED) != 0) {
@@ -169,13 +200,28 @@ void CONodeProcess(CO_NODE *node)
                 (void)COIfSend(&node->If, &frm);
             }
             allowed = 0;
+        } else if (node->Nmt.Mst != 0) {
+            if (CONmtBootCheck(node->Nmt.Mst->Boot, &frm) >= 0) {
+                allowed = 0;
+            }
         }
     }
 
     if ((allowed & CO_NMT_ALLOWED) != 0) {
         if (CONmtCheck(&node->Nmt, &frm) >= 0) {
             allowed = 0;
-        } else if (CONmtHbConsCheck(&node->Nmt, &frm) >= 0) {
+        } else {
+            if (CONmtMstCheck(node->Nmt.Mst, &frm) >= 0) {
+                allowed = 0;
+            }
+            if (CONmtHbConsCheck(&node->Nmt, &frm) >= 0) {
+                allowed = 0;
+            }
+        }
+    }
+
+    if ((allowed & CO_EMCY_ALLOWED) != 0) {
+        if (COEmcyConsCheck(node->Emcy.Cons, &frm) >= 0) {
             allowed = 0;
         }
     }
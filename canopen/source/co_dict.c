@@ -165,6 +165,59 @@ int16_t CODictRdLong(CO_DICT *cod, uint32_t key, uint32_t *val)
     return(result);
 }
 
+/*
+* see function definition
+*/
+int16_t CODictRdQuad(CO_DICT *cod, uint32_t key, uint64_t *val)
+{
+    uint32_t sz;
+    int16_t  result = CO_ERR_OBJ_NOT_FOUND;
+    uint8_t  nodeid;
+    CO_OBJ  *obj;
+
+    if ((cod == 0) || (val == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    obj = CODictFind(cod, key);
+    if (obj != 0) {
+        sz = COObjGetSize(obj, cod->Node, (uint32_t)CO_QUAD);
+        if (sz != (uint32_t)CO_QUAD) {
+            cod->Node->Error = CO_ERR_OBJ_SIZE;
+            result           = CO_ERR_OBJ_SIZE;
+        } else {
+            nodeid = cod->Node->NodeId;
+            result = COObjRdValue(obj, cod->Node, (void *)val, CO_QUAD, nodeid);
+            if (result != CO_ERR_NONE) {
+                cod->Node->Error = CO_ERR_OBJ_READ;
+            }
+        }
+    }
+
+    return(result);
+}
+
+/*
+* see function definition
+*/
+int16_t CODictRdDouble(CO_DICT *cod, uint32_t key, double *val)
+{
+    union {
+        uint64_t Quad;
+        double   Real;
+    } num;
+    int16_t  result;
+
+    if (val == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    result = CODictRdQuad(cod, key, &num.Quad);
+    if (result == CO_ERR_NONE) {
+        *val = num.Real;
+    }
+
+    return(result);
+}
+
 /*
 * see function definition
 */
@@ -260,6 +313,53 @@ int16_t CODictWrLong(CO_DICT *cod, uint32_t key, uint32_t val)
     return(result);
 }
 
+/*
+* see function definition
+*/
+int16_t CODictWrQuad(CO_DICT *cod, uint32_t key, uint64_t val)
+{
+    uint32_t sz;
+    int16_t  result = CO_ERR_OBJ_NOT_FOUND;
+    uint8_t  nodeid;
+    CO_OBJ  *obj;
+
+    if (cod == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    obj = CODictFind(cod, key);
+    if (obj != 0) {
+        sz = COObjGetSize(obj, cod->Node, (uint32_t)CO_QUAD);
+        if (sz != (uint32_t)CO_QUAD) {
+            cod->Node->Error = CO_ERR_OBJ_SIZE;
+            result           = CO_ERR_OBJ_SIZE;
+        } else {
+            nodeid = cod->Node->NodeId;
+            result = COObjWrValue(obj, cod->Node, (void *)&val, CO_QUAD, nodeid);
+            if (result != CO_ERR_NONE) {
+                cod->Node->Error = CO_ERR_OBJ_WRITE;
+            }
+        }
+    }
+
+    return(result);
+}
+
+/*
+* see function definition
+*/
+int16_t CODictWrDouble(CO_DICT *cod, uint32_t key, double val)
+{
+    union {
+        uint64_t Quad;
+        double   Real;
+    } num;
+
+    num.Real = val;
+
+    return (CODictWrQuad(cod, key, num.Quad));
+}
+
 /*
 * see function definition
 */
@@ -303,6 +403,232 @@ int16_t CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len)
     return(result);
 }
 
+/*
+* see function definition
+*/
+int16_t CODictImport(CO_DICT *cod, uint8_t *img, uint32_t len, uint32_t *num)
+{
+    CO_OBJ   *obj;
+    uint32_t  pos    = 0;
+    uint32_t  cnt    = 0;
+    uint32_t  key;
+    uint32_t  sz;
+    uint32_t  size;
+    uint64_t  val;
+    int16_t   result = CO_ERR_NONE;
+    CO_ERR    err;
+    uint8_t   nodeid;
+    uint8_t   n;
+
+    if ((cod == 0) || (img == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    nodeid = cod->Node->NodeId;
+    while ((pos < len) && (result == CO_ERR_NONE)) {
+        if ((len - pos) < CO_DICT_IMG_HDR) {
+            result = CO_ERR_BAD_ARG;
+            break;
+        }
+        key  = CO_DEV(((uint16_t)img[pos + 1] << 8) | img[pos], img[pos + 2]);
+        size = ((uint32_t)img[pos + 3]      ) |
+               ((uint32_t)img[pos + 4] <<  8) |
+               ((uint32_t)img[pos + 5] << 16) |
+               ((uint32_t)img[pos + 6] << 24);
+        pos += CO_DICT_IMG_HDR;
+        if ((size == 0) || (size > (len - pos))) {
+            result = CO_ERR_BAD_ARG;
+            break;
+        }
+
+        err = cod->Node->Error;
+        obj = CODictFind(cod, key);
+        if (obj == 0) {
+            cod->Node->Error = err;       /* reported with return value only */
+            result           = CO_ERR_OBJ_NOT_FOUND;
+        } else if (CO_IS_WRITE(obj->Key) == 0) {
+            result = CO_ERR_OBJ_ACC;
+        } else {
+            sz = COObjGetSize(obj, cod->Node, size);
+            if (sz != size) {
+                result = CO_ERR_OBJ_SIZE;
+            } else if ((size <= (uint32_t)CO_LONG) || (CODictIsQuad(obj, size) != 0)) {
+                val = 0;
+                for (n = 0; n < (uint8_t)size; n++) {
+                    val |= (uint64_t)img[pos + n] << (8 * n);
+                }
+                result = COObjWrValue(obj, cod->Node, (void *)&val, CO_QUAD, nodeid);
+            } else {
+                result = COObjWrBufStart(obj, cod->Node, &img[pos], 0);
+                if (result == CO_ERR_NONE) {
+                    result = COObjWrBufCont(obj, cod->Node, &img[pos], size);
+                }
+            }
+        }
+        if (result == CO_ERR_NONE) {
+            pos += size;
+            cnt++;
+        }
+    }
+    if (num != 0) {
+        *num = cnt;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t CODictExport(CO_DICT *cod, uint16_t first, uint16_t last, uint8_t *img, uint32_t *len)
+{
+    CO_OBJ   *obj;
+    uint32_t  pos    = 0;
+    uint32_t  size;
+    uint64_t  val;
+    int16_t   result = CO_ERR_NONE;
+    uint16_t  idx;
+    uint16_t  i;
+    uint8_t   nodeid;
+    uint8_t   n;
+
+    if ((cod == 0) || (img == 0) || (len == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    nodeid = cod->Node->NodeId;
+    obj    = cod->Root;
+    for (i = 0; i < cod->Num; i++, obj++) {
+        idx = CO_GET_IDX(obj->Key);
+        if ((idx < first) || (idx > last) ||
+            (CO_IS_READ(obj->Key) == 0) || (CO_IS_WRITE(obj->Key) == 0)) {
+            continue;
+        }
+        size = COObjGetSize(obj, cod->Node, 0);
+        if (size == 0) {
+            continue;
+        }
+        if ((*len - pos) < (CO_DICT_IMG_HDR + size)) {
+            result = CO_ERR_OBJ_SIZE;
+            break;
+        }
+        img[pos    ] = (uint8_t)(idx     );
+        img[pos + 1] = (uint8_t)(idx >> 8);
+        img[pos + 2] = CO_GET_SUB(obj->Key);
+        img[pos + 3] = (uint8_t)(size      );
+        img[pos + 4] = (uint8_t)(size >>  8);
+        img[pos + 5] = (uint8_t)(size >> 16);
+        img[pos + 6] = (uint8_t)(size >> 24);
+        pos += CO_DICT_IMG_HDR;
+        if ((size <= (uint32_t)CO_LONG) || (CODictIsQuad(obj, size) != 0)) {
+            result = COObjRdValue(obj, cod->Node, (void *)&val, CO_QUAD, nodeid);
+            for (n = 0; n < (uint8_t)size; n++) {
+                img[pos + n] = (uint8_t)(val >> (8 * n));
+            }
+        } else {
+            result = COObjRdBufStart(obj, cod->Node, &img[pos], 0);
+            if (result == CO_ERR_NONE) {
+                result = COObjRdBufCont(obj, cod->Node, &img[pos], size);
+            }
+        }
+        if (result != CO_ERR_NONE) {
+            cod->Node->Error = CO_ERR_OBJ_READ;
+            pos             -= CO_DICT_IMG_HDR;
+            break;
+        }
+        pos += size;
+    }
+    *len = pos;
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t CODictSubscribe(CO_DICT *cod, CO_DICT_SUB *sub, uint32_t first, uint32_t last, CO_DICT_SUB_FUNC func)
+{
+    CO_DICT_SUB *cur;
+
+    if ((cod == 0) || (sub == 0) || (func == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    first = CO_GET_DEV(first);
+    last  = CO_GET_DEV(last);
+    if (first > last) {
+        return (CO_ERR_BAD_ARG);
+    }
+    cur = cod->Sub;
+    while (cur != 0) {
+        if (cur == sub) {
+            return (CO_ERR_BAD_ARG);
+        }
+        cur = cur->Next;
+    }
+    sub->First = first;
+    sub->Last  = last;
+    sub->Func  = func;
+    sub->Next  = cod->Sub;
+    cod->Sub   = sub;
+
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+void CODictUnsubscribe(CO_DICT *cod, CO_DICT_SUB *sub)
+{
+    CO_DICT_SUB **ref;
+
+    if ((cod == 0) || (sub == 0)) {
+        return;
+    }
+    ref = &cod->Sub;
+    while (*ref != 0) {
+        if (*ref == sub) {
+            *ref      = sub->Next;
+            sub->Next = 0;
+            return;
+        }
+        ref = &((*ref)->Next);
+    }
+}
+
+/*
+* see function definition
+*/
+void CODictSubNotify(CO_DICT *cod, CO_OBJ *obj)
+{
+    CO_DICT_SUB *sub;
+    CO_DICT_SUB *next;
+    uint32_t     dev;
+
+    dev = CO_GET_DEV(obj->Key);
+    sub = cod->Sub;
+    while (sub != 0) {
+        /* the callback may unsubscribe itself */
+        next = sub->Next;
+        if ((dev >= sub->First) && (dev <= sub->Last)) {
+            sub->Func(sub, cod->Node, obj);
+        }
+        sub = next;
+    }
+}
+
+/*
+* see function definition
+*/
+uint8_t CODictIsQuad(CO_OBJ *obj, uint32_t size)
+{
+    uint8_t result = 0;
+
+    if ((size == (uint32_t)CO_QUAD) &&
+        ((obj->Type == 0) || (obj->Type->Size == 0))) {
+        result = 1;
+    }
+
+    return (result);
+}
+
 /*
 * see function definition
 */
@@ -310,6 +636,9 @@ int16_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
 {
     CO_OBJ   *obj;
     uint16_t  num = 0;
+#if CO_PARA_TRACK_N > 0
+    uint8_t   n;
+#endif
 
     if ((cod == 0) || (node == 0) || (root == 0)) {
         CONodeFatalError();
@@ -319,8 +648,33 @@ int16_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
         node->Error = CO_ERR_BAD_ARG;
         return (-1);
     }
+    cod->Para    = 0;
+    cod->ParaNum = 0;
+    cod->Sub     = 0;
+#if CO_PARA_TRACK_N > 0
+    for (n = 0; n < CO_PARA_TRACK_N; n++) {
+        cod->ParaState[n].DirtyStart = 0;
+        cod->ParaState[n].DirtyEnd   = 0;
+        cod->ParaState[n].Stored     = 0;
+        cod->ParaState[n].SaveStart  = 0;
+        cod->ParaState[n].SaveEnd    = 0;
+    }
+#endif
     obj = root;
     while ((obj->Key != 0) && (num < max)) {
+        /* remember the parameter groups for the change tracking */
+        if ((CO_GET_IDX(obj->Key) == 0x1010) && (CO_GET_SUB(obj->Key) > 0) &&
+            (obj->Type == CO_TPARA) && (obj->Data != 0) &&
+            (cod->ParaNum < 0x7F)) {
+            if (cod->ParaNum == 0) {
+                cod->Para = obj;
+            }
+            cod->ParaNum++;
+        }
+        /* direct objects keep their value in the value array */
+        if (cod->Val != 0) {
+            cod->Val[num] = obj->Data;
+        }
         num++;
         obj++;
     }
@@ -329,6 +683,7 @@ int16_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
     cod->Num   = num;
     cod->Max   = max;
     cod->Node  = node;
+    cod->Gen++;
 
     return ((int16_t)num);
 }
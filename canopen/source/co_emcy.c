@@ -21,11 +21,26 @@
 #include "co_core.h"
 #include "co_emcy.h"
 
+/******************************************************************************
+* PRIVATE CONSTANTS
+******************************************************************************/
+
+/*! \brief BIT POSITION LOOKUP
+*
+*    This table maps the de Bruijn sequence index of an isolated bit to the
+*    bit number within a 32bit word.
+*/
+static const uint8_t COEmcyBitPos[32] = {
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+};
+
 /******************************************************************************
 * GLOBAL CONSTANTS
 ******************************************************************************/
 
 const CO_OBJ_TYPE COTEmcy = { 0, 0, COTypeEmcyRead, COTypeEmcyWrite };
+const CO_OBJ_TYPE COTEmcyCfg = { 0, 0, 0, COTypeEmcyCfgWrite };
 
 /******************************************************************************
 * FUNCTIONS
@@ -34,7 +49,7 @@ const CO_OBJ_TYPE COTEmcy = { 0, 0, COTypeEmcyRead, COTypeEmcyWrite };
 /*
 * see function definition
 */
-void COEmcySet(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
+void COEmcySet(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr)
 {
     int16_t chk;
     int16_t change;
@@ -54,7 +69,7 @@ void COEmcySet(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
 /*
 * see function definition
 */
-void COEmcyClr(CO_EMCY *emcy, uint8_t err)
+void COEmcyClr(CO_EMCY *emcy, uint16_t err)
 {
     int16_t chk;
     int16_t change;
@@ -74,7 +89,7 @@ void COEmcyClr(CO_EMCY *emcy, uint8_t err)
 /*
 * see function definition
 */
-int16_t COEmcyGet(CO_EMCY *emcy, uint8_t err)
+int16_t COEmcyGet(CO_EMCY *emcy, uint16_t err)
 {
     int16_t chk;
     int16_t cur;
@@ -111,27 +126,61 @@ int16_t COEmcyCnt(CO_EMCY *emcy)
     return (result);
 }
 
+/*
+* see function definition
+*/
+int16_t COEmcyNext(CO_EMCY *emcy, uint16_t start)
+{
+    uint32_t word;
+    uint16_t idx;
+    int16_t  chk;
+
+    chk = COEmcyCheck(emcy);
+    if (chk < 0) {
+        return (-1);
+    }
+    if (start >= CO_EMCY_N) {
+        return (-1);
+    }
+
+    idx  = start >> 5;
+    word = emcy->Err[idx] & ~(((uint32_t)1 << (start & 0x1F)) - 1);
+    while (word == 0) {
+        idx++;
+        if (idx >= CO_EMCY_STORAGE) {
+            return (-1);
+        }
+        word = emcy->Err[idx];
+    }
+
+    return ((int16_t)((idx << 5) + COEmcyFfs(word)));
+}
+
 /*
 * see function definition
 */
 void COEmcyReset(CO_EMCY *emcy, uint8_t silent)
 {
-    int16_t change;
-    int16_t chk;
-    uint8_t n;
+    int16_t  chk;
+    uint32_t word;
+    uint16_t idx;
+    uint16_t err;
 
     chk = COEmcyCheck(emcy);
     if (chk < 0) {
         return;
     }
 
-    for (n=0; n < CO_EMCY_N; n++) {
-        if (silent == 0) {
-            COEmcyClr(emcy, n);
-        } else {
-            change = COEmcySetErr(emcy, n, 0);
-            if (change > 0) {
-                COEmcyUpdate(emcy, n, 0, 0);
+    for (idx = 0; idx < CO_EMCY_STORAGE; idx++) {
+        word = emcy->Err[idx];
+        while (word != 0) {
+            err   = (uint16_t)((idx << 5) + COEmcyFfs(word));
+            word &= word - 1;
+            if (silent == 0) {
+                COEmcyClr(emcy, err);
+            } else {
+                (void)COEmcySetErr(emcy, err, 0);
+                COEmcyUpdate(emcy, err, 0, 0);
             }
         }
     }
@@ -142,36 +191,20 @@ void COEmcyReset(CO_EMCY *emcy, uint8_t silent)
 */
 void COEmcyHistReset(CO_EMCY *emcy)
 {
-    CO_NODE    *node;
-    CO_DICT     *cod;
-    CO_OBJ     *obj;
-    uint32_t    val32;
-    int16_t     chk;
-    uint8_t     sub;
-    uint8_t     val08;
+    uint8_t  val08;
+    int16_t  chk;
 
     chk = COEmcyCheck(emcy);
     if (chk < 0) {
         return;
     }
-    node = emcy->Node;
-    cod  = &node->Dict;
-
-    val08 = 0;
-    obj = CODictFind(cod, CO_DEV(0x1003, 0));
-    if (obj == 0) {
-        node->Error = CO_ERR_NONE;
+    if (emcy->Hist.Sub0 == 0) {
         return;
     }
-    (void)COObjWrDirect(obj, &val08, 1);
 
-    val32 = 0;
-    for (sub = 1; sub <= emcy->Hist.Max; sub++) {
-        obj = CODictFind(cod, CO_DEV(0x1003, sub));
-        (void)COObjWrDirect(obj, &val32, 4);
-    }
+    val08 = 0;
+    (void)COObjWrDirect(emcy->Hist.Sub0, emcy->Node, &val08, 1);
 
-    emcy->Hist.Max = sub - 1;
     emcy->Hist.Off = 0;
     emcy->Hist.Num = 0;
 }
@@ -207,6 +240,7 @@ void COEmcyInit(CO_EMCY *emcy, CO_NODE *node, CO_EMCY_TBL *root)
             node->Error = CO_ERR_CFG_1014_0;
         }
     }
+    emcy->Reg = 0;
     obj = CODictFind(&node->Dict, CO_DEV(0x1001,0));
     if (obj == 0) {
         node->Error = CO_ERR_CFG_1001_0;
@@ -214,9 +248,12 @@ void COEmcyInit(CO_EMCY *emcy, CO_NODE *node, CO_EMCY_TBL *root)
         size = COObjGetSize(obj, node, CO_BYTE);
         if (size == 0) {
             node->Error = CO_ERR_CFG_1001_0;
+        } else {
+            emcy->Reg = obj;
         }
     }
 
+    COEmcyTxInit(emcy);
     COEmcyHistInit(emcy);
 }
 
@@ -249,19 +286,29 @@ int16_t COEmcyCheck(CO_EMCY *emcy)
 /*
 * see function definition
 */
-int16_t COEmcyGetErr(CO_EMCY *emcy, uint8_t err)
+uint8_t COEmcyFfs(uint32_t word)
 {
-    uint8_t result;
-    uint8_t byte;
-    uint8_t mask;
+    word &= (~word) + 1;
+
+    return (COEmcyBitPos[(uint32_t)(word * 0x077CB531u) >> 27]);
+}
+
+/*
+* see function definition
+*/
+int16_t COEmcyGetErr(CO_EMCY *emcy, uint16_t err)
+{
+    uint8_t  result;
+    uint16_t idx;
+    uint32_t mask;
 
     if (err >= CO_EMCY_N) {
         err = CO_EMCY_N - 1;
     }
 
-    byte = err >> 3;
-    mask = (uint8_t)1 << (err & 0x7);
-    if ((emcy->Err[byte] & mask) == 0) {
+    idx  = err >> 5;
+    mask = (uint32_t)1 << (err & 0x1F);
+    if ((emcy->Err[idx] & mask) == 0) {
         result = 0;
     } else {
         result = 1;
@@ -273,30 +320,30 @@ int16_t COEmcyGetErr(CO_EMCY *emcy, uint8_t err)
 /*
 * see function definition
 */
-int16_t COEmcySetErr(CO_EMCY *emcy, uint8_t err, uint8_t state)
+int16_t COEmcySetErr(CO_EMCY *emcy, uint16_t err, uint8_t state)
 {
-    uint8_t result;
-    uint8_t byte;
-    uint8_t mask;
+    uint8_t  result;
+    uint16_t idx;
+    uint32_t mask;
 
     if (err >= CO_EMCY_N) {
         err = CO_EMCY_N - 1;
     }
-    byte = err >> 3;
-    mask = (uint8_t)1 << (err & 0x7);
-    if ((emcy->Err[byte] & mask) == 0) {
+    idx  = err >> 5;
+    mask = (uint32_t)1 << (err & 0x1F);
+    if ((emcy->Err[idx] & mask) == 0) {
         if (state != 0) {
-            emcy->Err[byte] |= mask;
-            result           = 1;
+            emcy->Err[idx] |= mask;
+            result          = 1;
         } else {
-            result           = 0;
+            result          = 0;
         }
     } else {
         if (state == 0) {
-            emcy->Err[byte] &= ~mask;
-            result           = 1;
+            emcy->Err[idx] &= ~mask;
+            result          = 1;
         } else {
-            result           = 0;
+            result          = 0;
         }
     }
     return (result);
@@ -305,11 +352,10 @@ int16_t COEmcySetErr(CO_EMCY *emcy, uint8_t err, uint8_t state)
 /*
 * see function definition
 */
-void COEmcySend(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t state)
+void COEmcySend(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr, uint8_t state)
 {
-    CO_IF_FRM    frm; 
+    CO_EMCY_MSG  msg;
     CO_NODE     *node;
-    CO_DICT      *dir;
     CO_EMCY_TBL *data;
     uint8_t      n;
 
@@ -317,52 +363,210 @@ void COEmcySend(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t state)
     if ((node->Nmt.Allowed & CO_EMCY_ALLOWED) == 0) {
        return;
     }
+    if ((COEmcyTxCobId(emcy) & CO_EMCY_COBID_OFF) != 0) {
+        return;
+    }
     if (err >= CO_EMCY_N) {
         err = CO_EMCY_N - 1;
     }
-    dir  = &node->Dict;
     data = &emcy->Root[err];
 
-    (void)CODictRdLong(dir, CO_DEV(0x1014,0),
-                      &frm.Identifier);
-    frm.DLC = 8;
+    msg.Err   = err;
+    msg.State = state;
     if (state == 1) {
-        frm.Data[0] = (uint8_t)(data->Code);
-        frm.Data[1] = (uint8_t)(data->Code >> 8);
+        msg.Data[0] = (uint8_t)(data->Code);
+        msg.Data[1] = (uint8_t)(data->Code >> 8);
     } else {
-        frm.Data[0] = (uint8_t)0;
-        frm.Data[1] = (uint8_t)0;
+        msg.Data[0] = (uint8_t)0;
+        msg.Data[1] = (uint8_t)0;
+    }
+    msg.Data[2] = 0;
+    if (emcy->Reg != 0) {
+        (void)COObjRdValue(emcy->Reg, node, &msg.Data[2], CO_BYTE, 0);
     }
-    (void)CODictRdByte(dir, CO_DEV(0x1001,0), &frm.Data[2]);
     for (n=0; n<5; n++) {
-        frm.Data[3+n] = 0;
+        msg.Data[3+n] = 0;
     }
     if (usr != 0) {
         for (n=0; n<5; n++) {
-            frm.Data[3+n] = usr->Emcy[n];
+            msg.Data[3+n] = usr->Emcy[n];
+        }
+    }
+
+    if (emcy->Tx.Tmr >= 0) {
+        COEmcyTxQueue(emcy, &msg);
+    } else {
+        COEmcyTxSend(emcy, msg.Data);
+    }
+}
+
+/*
+* see function definition
+*/
+void COEmcyTxInit(CO_EMCY *emcy)
+{
+    CO_NODE    *node;
+    CO_DICT    *cod;
+    CO_OBJ     *obj;
+    CO_ERR      err;
+    uint16_t    inhibit = 0;
+
+    node = emcy->Node;
+    cod  = &node->Dict;
+
+    emcy->Tx.Tmr  = -1;
+    emcy->Tx.Head = 0;
+    emcy->Tx.Num  = 0;
+    emcy->Tx.Lost = 0;
+
+    emcy->CobId = CO_EMCY_COBID_OFF;
+    err = node->Error;
+    obj = CODictFind(cod, CO_DEV(0x1014, 0));
+    if (obj != 0) {
+        (void)COObjRdValue(obj, node, &emcy->CobId, CO_LONG, node->NodeId);
+    }
+    emcy->Cob = obj;
+    obj = CODictFind(cod, CO_DEV(0x1015, 0));
+    if (obj != 0) {
+        (void)COObjRdValue(obj, node, &inhibit, CO_WORD, 0);
+    }
+    node->Error = err;
+
+    emcy->Tx.Inhibit = CO_EMCY_INHIBIT(inhibit);
+}
+
+/*
+* see function definition
+*/
+uint32_t COEmcyTxCobId(CO_EMCY *emcy)
+{
+    CO_NODE *node;
+    CO_ERR   err;
+
+    if ((emcy->Cob != 0) && (emcy->Cob->Type != CO_TEMCY_CFG)) {
+        node = emcy->Node;
+        err  = node->Error;
+        (void)COObjRdValue(emcy->Cob, node, &emcy->CobId, CO_LONG, node->NodeId);
+        node->Error = err;
+    }
+    return (emcy->CobId);
+}
+
+/*
+* see function definition
+*/
+void COEmcyTxQueue(CO_EMCY *emcy, CO_EMCY_MSG *msg)
+{
+    CO_EMCY_TX *tx;
+    uint8_t     pos;
+#if CO_EMCY_COALESCE > 0
+    uint8_t     src;
+    uint8_t     n;
+#endif
+
+    tx = &emcy->Tx;
+#if CO_EMCY_COALESCE > 0
+    /* search the newest queued message of this error */
+    for (n = tx->Num; n > 0; n--) {
+        pos = (uint8_t)((tx->Head + n - 1) % CO_EMCY_QUEUE_N);
+        if (tx->Msg[pos].Err == msg->Err) {
+            if (tx->Msg[pos].State != msg->State) {
+                /* state change is reverted: discard both messages */
+                for (; n < tx->Num; n++) {
+                    src = (uint8_t)((tx->Head + n) % CO_EMCY_QUEUE_N);
+                    tx->Msg[pos] = tx->Msg[src];
+                    pos = src;
+                }
+                tx->Num--;
+                return;
+            }
+            break;
+        }
+    }
+#endif
+    if (tx->Num >= CO_EMCY_QUEUE_N) {
+        if (tx->Lost < 0xFFFF) {
+            tx->Lost++;
+        }
+        return;
+    }
+    pos = (uint8_t)((tx->Head + tx->Num) % CO_EMCY_QUEUE_N);
+    tx->Msg[pos] = *msg;
+    tx->Num++;
+}
+
+/*
+* see function definition
+*/
+void COEmcyTxSend(CO_EMCY *emcy, uint8_t *data)
+{
+    CO_IF_FRM  frm;
+    CO_NODE   *node;
+    uint8_t    n;
+
+    node = emcy->Node;
+    frm.Identifier = emcy->CobId;
+    frm.DLC        = 8;
+    for (n=0; n<8; n++) {
+        frm.Data[n] = data[n];
+    }
+    (void)COIfSend(&node->If, &frm);
+
+    if (emcy->Tx.Inhibit > 0) {
+        emcy->Tx.Tmr = COTmrCreate(&node->Tmr,
+                                   emcy->Tx.Inhibit,
+                                   0,
+                                   COEmcyTxNext,
+                                   emcy);
+        if (emcy->Tx.Tmr < 0) {
+            node->Error = CO_ERR_TMR_CREATE;
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+void COEmcyTxNext(void *parg)
+{
+    CO_EMCY     *emcy;
+    CO_EMCY_TX  *tx;
+    CO_EMCY_MSG *msg;
+
+    emcy    = (CO_EMCY *)parg;
+    tx      = &emcy->Tx;
+    tx->Tmr = -1;
+
+    while (tx->Num > 0) {
+        msg      = &tx->Msg[tx->Head];
+        tx->Head = (uint8_t)((tx->Head + 1) % CO_EMCY_QUEUE_N);
+        tx->Num--;
+        if (((emcy->Node->Nmt.Allowed & CO_EMCY_ALLOWED) != 0) &&
+            ((COEmcyTxCobId(emcy) & CO_EMCY_COBID_OFF) == 0)) {
+            COEmcyTxSend(emcy, msg->Data);
+            break;
         }
     }
-    (void)COIfSend(&emcy->Node->If, &frm);
 }
 
 /*
 * see function definition
 */
-void COEmcyUpdate(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t state)
+void COEmcyUpdate(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr, uint8_t state)
 {
-    CO_DICT  *dir;
     uint8_t  regbit;
     uint8_t  regmask;
-    uint8_t  reg;
+    uint8_t  reg = 0;
 
     if (err >= CO_EMCY_N) {
         err = CO_EMCY_N - 1;
     }
-    dir     = &emcy->Node->Dict;
     regbit  =  emcy->Root[err].Reg;
     regmask =  (uint8_t)(1u << regbit);
 
-    (void)CODictRdByte(dir, CO_DEV(0x1001,0), &reg);
+    if (emcy->Reg != 0) {
+        (void)COObjRdValue(emcy->Reg, emcy->Node, &reg, CO_BYTE, 0);
+    }
 
     if (state != 0) { /* set error */
         if ((reg & regmask) == 0) {
@@ -384,7 +588,9 @@ void COEmcyUpdate(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t state)
             }
         }
     }
-    (void)CODictWrByte(dir, CO_DEV(0x1001,0), reg);
+    if (emcy->Reg != 0) {
+        (void)COObjWrValue(emcy->Reg, emcy->Node, &reg, CO_BYTE, 0);
+    }
 }
 
 /*
@@ -397,9 +603,11 @@ void COEmcyHistInit(CO_EMCY *emcy)
     CO_OBJ   *obj;
     uint8_t   sub;
 
-    emcy->Hist.Max = 0;
-    emcy->Hist.Num = 0;
-    emcy->Hist.Off = 0;
+    emcy->Hist.Max  = 0;
+    emcy->Hist.Num  = 0;
+    emcy->Hist.Off  = 0;
+    emcy->Hist.Sub0 = 0;
+    emcy->Hist.Sub1 = 0;
 
     node = emcy->Node;
     cod  = &node->Dict;
@@ -408,17 +616,21 @@ void COEmcyHistInit(CO_EMCY *emcy)
         node->Error = CO_ERR_NONE;
         return;
     }
+    emcy->Hist.Sub0 = obj;
     obj  = CODictFind(cod, CO_DEV(0x1003, 1));
     if (obj == 0) {
+        emcy->Hist.Sub0 = 0;
         node->Error = CO_ERR_CFG_1003_1;
         return;
     }
+    emcy->Hist.Sub1 = obj;
     sub = 2;
-    while (obj != 0) {
+    while (sub < 0xFF) {
         obj = CODictFind(cod, CO_DEV(0x1003, sub));
-        if (obj != 0) {
-            sub++;
+        if (obj != &emcy->Hist.Sub1[sub - 1]) {
+            break;
         }
+        sub++;
     }
     (void)CONodeGetErr(cod->Node);
 
@@ -429,19 +641,14 @@ void COEmcyHistInit(CO_EMCY *emcy)
 /*
 * see function definition
 */
-void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
+void COEmcyHistAdd(CO_EMCY *emcy, uint16_t err, CO_EMCY_USR *usr)
 {
-    CO_NODE *node;
-    CO_DICT  *cod;
-    CO_OBJ  *obj;
     uint32_t val = 0;
     uint8_t  sub;
 
     if (emcy->Hist.Max == 0) {
         return;
     }
-    node = emcy->Node;
-    cod  = &node->Dict;
     emcy->Hist.Off++;
     if (emcy->Hist.Off > emcy->Hist.Max) {
         emcy->Hist.Off = 1;
@@ -451,15 +658,13 @@ void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
     if (usr != 0) {
         val |= (((uint32_t)usr->Hist) << 16);
     }
-    obj = CODictFind(cod, CO_DEV(0x1003, sub));
-    COObjWrDirect(obj, &val, 4);
+    (void)COObjWrDirect(&emcy->Hist.Sub1[sub - 1], emcy->Node, &val, 4);
 
     emcy->Hist.Num++;
     if (emcy->Hist.Num > emcy->Hist.Max) {
         emcy->Hist.Num = emcy->Hist.Max;
     } else {
-        obj = CODictFind(cod, CO_DEV(0x1003, 0));
-        COObjWrDirect(obj, &(emcy->Hist.Num), 1);
+        (void)COObjWrDirect(emcy->Hist.Sub0, emcy->Node, &(emcy->Hist.Num), 1);
     }
 }
 
@@ -468,18 +673,17 @@ void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
 */
 int16_t COTypeEmcyRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len)
 {
-    CO_DICT  *cod;
     CO_EMCY *emcy;
     int16_t  result = CO_ERR_NONE;
+    uint32_t n;
     uint8_t  sub;
     uint8_t  map;
 
-    cod  = &node->Dict;
     emcy = &node->Emcy;
     sub  = CO_GET_SUB(obj->Key);
 
     if (sub == 0) {
-        result = COObjRdDirect(obj, buf, len);
+        result = COObjRdDirect(obj, node, buf, len);
     } else {
         if (sub <= emcy->Hist.Num) {
             if (sub <= emcy->Hist.Off) {
@@ -488,8 +692,11 @@ int16_t COTypeEmcyRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t
                 map = (emcy->Hist.Max - (sub - 1)) +
                        emcy->Hist.Off;
             }
-            obj = CODictFind(cod, CO_DEV(0x1003, map));
-            result = COObjRdDirect(obj, buf, len);
+            result = COObjRdDirect(&emcy->Hist.Sub1[map - 1], node, buf, len);
+        } else {
+            for (n = 0; n < len; n++) {
+                ((uint8_t *)buf)[n] = 0;
+            }
         }
     }
 
@@ -520,3 +727,45 @@ int16_t COTypeEmcyWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t
 
     return (result);
 }
+
+/*
+* see function definition
+*/
+int16_t COTypeEmcyCfgWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len)
+{
+    CO_EMCY  *emcy;
+    int16_t   result = CO_ERR_TYPE_WR;
+    uint32_t  newid;
+    uint32_t  curid;
+    uint16_t  inhibit;
+
+    if (len != CO_LONG) {
+        return (CO_ERR_BAD_ARG);
+    }
+    emcy = &node->Emcy;
+
+    if (CO_GET_IDX(obj->Key) == 0x1014) {
+        newid = *(uint32_t *)buf;
+        if ((newid & (CO_EMCY_COBID_RSV | CO_EMCY_COBID_EXT)) != 0) {
+            return (CO_ERR_OBJ_RANGE);
+        }
+        (void)COObjRdDirect(obj, node, &curid, CO_LONG);
+        if (((curid & CO_EMCY_COBID_OFF) == 0) &&
+            ((newid & CO_EMCY_COBID_OFF) == 0) &&
+            (newid != curid)) {
+            return (CO_ERR_OBJ_RANGE);
+        }
+        result = COObjWrDirect(obj, node, buf, CO_LONG);
+        if (result == CO_ERR_NONE) {
+            (void)COObjRdValue(obj, node, &emcy->CobId, CO_LONG, node->NodeId);
+        }
+    } else if (CO_GET_IDX(obj->Key) == 0x1015) {
+        inhibit = (uint16_t)(*(uint32_t *)buf);
+        result  = COObjWrDirect(obj, node, &inhibit, CO_WORD);
+        if (result == CO_ERR_NONE) {
+            emcy->Tx.Inhibit = CO_EMCY_INHIBIT(inhibit);
+        }
+    }
+
+    return (result);
+}
@@ -0,0 +1,256 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_emcy_cons.h"
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_EMCY_CONS_BASE    0x80u    /*!< default EMCY COB-ID base          */
+#define CO_EMCY_CONS_OFF     0x80000000u /*!< COB-ID: EMCY is not consumed   */
+
+/*! \brief TICKS PER MINUTE
+*
+*    The rate estimation is based on this window: a single EMCY message per
+*    window results in the lowest rate of 1 message per minute.
+*/
+#define CO_EMCY_CONS_MIN     ((uint32_t)CO_TMR_TICKS_PER_SEC * 60u)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  FIND EMCY PRODUCER
+*
+*    This function returns the EMCY producer, which is consumed with the
+*    given COB-ID. The default COB-ID is resolved via the Node-ID table;
+*    the producers with a configured non-default COB-ID are searched.
+*
+* \param cons
+*    reference to EMCY consumer structure
+*
+* \param cobid
+*    received COB-ID
+*
+* \return  reference to EMCY producer, or 0 if the COB-ID is not consumed
+*/
+static CO_EMCY_PROD *COEmcyConsFind(CO_EMCY_CONS *cons, uint32_t cobid)
+{
+    CO_EMCY_PROD *prod;
+    uint8_t       n;
+
+    if ((cobid > CO_EMCY_CONS_BASE) &&
+        (cobid < (CO_EMCY_CONS_BASE + CO_HBCONS_NODE_N))) {
+        prod = COEmcyConsGet(cons, (uint8_t)(cobid - CO_EMCY_CONS_BASE));
+        if ((prod != 0) && (prod->CobId == cobid)) {
+            return (prod);
+        }
+    }
+    if (cons->Ext > 0) {
+        for (n = 0; n < cons->Num; n++) {
+            prod = &cons->Prod[n];
+            if (prod->CobId == cobid) {
+                return (prod);
+            }
+        }
+    }
+    return (0);
+}
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COEmcyConsInit(CO_EMCY_CONS      *cons,
+                       struct CO_NODE_T  *node,
+                       CO_EMCY_PROD      *prod,
+                       uint8_t            num,
+                       CO_EMCY_CONS_FUNC  func)
+{
+    CO_OBJ  *obj;
+    CO_ERR   err;
+    uint8_t  id;
+    uint8_t  n;
+
+    if ((cons == 0) || (node == 0) || ((prod == 0) && (num > 0))) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    node->Emcy.Cons = 0;
+    cons->Node      = node;
+    cons->Prod      = prod;
+    cons->Func      = func;
+    cons->Num       = 0;
+    cons->Ext       = 0;
+    cons->Mask      = 0;
+    cons->Match     = 0;
+    for (id = 0; id < CO_HBCONS_NODE_N; id++) {
+        cons->Idx[id] = 0;
+    }
+    for (n = 0; n < num; n++) {
+        id = prod[n].NodeId;
+        if ((id == 0) || (id >= CO_HBCONS_NODE_N) || (cons->Idx[id] != 0)) {
+            node->Error = CO_ERR_BAD_ARG;
+            return (CO_ERR_BAD_ARG);
+        }
+        cons->Idx[id] = n + 1;
+
+        prod[n].CobId = CO_EMCY_CONS_BASE + id;
+        err = node->Error;
+        obj = CODictFind(&node->Dict, CO_DEV(0x1028, id));
+        if (obj != 0) {
+            (void)COObjRdValue(obj, node, &prod[n].CobId, CO_LONG, 0);
+        }
+        node->Error = err;
+        if (prod[n].CobId != (CO_EMCY_CONS_BASE + id)) {
+            cons->Ext++;
+        }
+        prod[n].Num  = 0;
+        prod[n].Err  = 0;
+        prod[n].Code = 0;
+        prod[n].Reg  = 0;
+        prod[n].Last = 0;
+        prod[n].Ival = 0;
+    }
+    cons->Num = num;
+
+    node->Emcy.Cons = cons;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+void COEmcyConsSetFilter(CO_EMCY_CONS *cons, uint16_t mask, uint16_t match)
+{
+    if (cons == 0) {
+        CONodeFatalError();
+        return;
+    }
+    cons->Mask  = mask;
+    cons->Match = match & mask;
+}
+
+/*
+* see function definition
+*/
+CO_EMCY_PROD *COEmcyConsGet(CO_EMCY_CONS *cons, uint8_t nodeId)
+{
+    CO_EMCY_PROD *result = 0;
+
+    if (cons == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    if ((nodeId > 0) && (nodeId < CO_HBCONS_NODE_N)) {
+        if (cons->Idx[nodeId] != 0) {
+            result = &cons->Prod[cons->Idx[nodeId] - 1];
+        }
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+uint32_t COEmcyConsRate(CO_EMCY_CONS *cons, uint8_t nodeId)
+{
+    CO_EMCY_PROD *prod;
+    uint32_t      ival;
+    uint32_t      idle;
+
+    prod = COEmcyConsGet(cons, nodeId);
+    if ((prod == 0) || (prod->Num == 0)) {
+        return (0);
+    }
+    ival = prod->Ival;
+    idle = cons->Node->Tmr.Ticks - prod->Last;
+    if (idle > CO_EMCY_CONS_MIN) {
+        idle = CO_EMCY_CONS_MIN;
+    }
+    if ((idle * 16u) > ival) {
+        ival = idle * 16u;
+    }
+    if (ival == 0) {
+        ival = 1;
+    }
+    return ((CO_EMCY_CONS_MIN * 16u) / ival);
+}
+
+/*
+* see function definition
+*/
+int16_t COEmcyConsCheck(CO_EMCY_CONS *cons, CO_IF_FRM *frm)
+{
+    CO_EMCY_PROD *prod;
+    uint32_t      now;
+    uint32_t      dt;
+    uint8_t       n;
+
+    if (cons == 0) {
+        return (-1);
+    }
+    if ((frm->DLC != 8) || ((frm->Identifier & CO_EMCY_CONS_OFF) != 0)) {
+        return (-1);
+    }
+    prod = COEmcyConsFind(cons, frm->Identifier);
+    if (prod == 0) {
+        return (-1);
+    }
+
+    now = cons->Node->Tmr.Ticks;
+    dt  = now - prod->Last;
+    if (dt > CO_EMCY_CONS_MIN) {
+        dt = CO_EMCY_CONS_MIN;
+    }
+    if (prod->Num == 0) {
+        /* no interval measured: assume a single message per minute */
+        prod->Ival = CO_EMCY_CONS_MIN * 16u;
+    } else if (prod->Num == 1) {
+        prod->Ival = dt * 16u;
+    } else {
+        /* moving average with weight 1/8 of the new interval */
+        prod->Ival = prod->Ival - (prod->Ival / 8u) + (dt * 2u);
+    }
+    prod->Last = now;
+    if (prod->Num < 0xFFFFFFFFu) {
+        prod->Num++;
+    }
+
+    prod->Code = (uint16_t)frm->Data[0] | ((uint16_t)frm->Data[1] << 8);
+    prod->Reg  = frm->Data[2];
+    for (n = 0; n < 5; n++) {
+        prod->Usr[n] = frm->Data[3 + n];
+    }
+    if ((prod->Code != 0) && (prod->Err < 0xFFFFFFFFu)) {
+        prod->Err++;
+    }
+
+    if ((cons->Func != 0) && ((prod->Code & cons->Mask) == cons->Match)) {
+        cons->Func(cons, prod->NodeId, prod);
+    }
+    return ((int16_t)prod->NodeId);
+}
@@ -24,28 +24,30 @@
 * GLOBAL CONSTANTS
 ******************************************************************************/
 
-const CO_LSS_MAP COLssServices[CO_LSS_MAX_SID] = {
-    {   4 , CO_LSS_WAIT | CO_LSS_CONF, COLssSwitchStateGlobal },
-    {  64 , CO_LSS_WAIT              , COLssSwitchStateSelective_Vendor },
-    {  65 , CO_LSS_WAIT              , COLssSwitchStateSelective_Product },
-    {  66 , CO_LSS_WAIT              , COLssSwitchStateSelective_Revision },
-    {  67 , CO_LSS_WAIT              , COLssSwitchStateSelective_Serial },
-    {  21 ,               CO_LSS_CONF, COLssActivateBitTiming },
-    {  19 ,               CO_LSS_CONF, COLssConfigureBitTiming },
-    {  17 ,               CO_LSS_CONF, COLssConfigureNodeId },
-    {  23 ,               CO_LSS_CONF, COLssStoreConfiguration },
-    {  90 ,               CO_LSS_CONF, COLssInquireAddress_Vendor },
-    {  91 ,               CO_LSS_CONF, COLssInquireAddress_Product },
-    {  92 ,               CO_LSS_CONF, COLssInquireAddress_Revision },
-    {  93 ,               CO_LSS_CONF, COLssInquireAddress_Serial },
-    {  94 ,               CO_LSS_CONF, COLssInquireNodeId },
-    {  70 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_Vendor },
-    {  71 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_Product },
-    {  72 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_RevMin },
-    {  73 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_RevMax },
-    {  74 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_SerMin },
-    {  75 , CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_SerMax },
-    {  76 , CO_LSS_WAIT | CO_LSS_CONF, COLssNonConfiguredRemoteSlave }
+/* service table, indexed with the LSS command specifier */
+const CO_LSS_MAP COLssServices[CO_LSS_MAX_CMD] = {
+    [  4] = { CO_LSS_WAIT | CO_LSS_CONF, COLssSwitchStateGlobal },
+    [ 64] = { CO_LSS_WAIT              , COLssSwitchStateSelective_Vendor },
+    [ 65] = { CO_LSS_WAIT              , COLssSwitchStateSelective_Product },
+    [ 66] = { CO_LSS_WAIT              , COLssSwitchStateSelective_Revision },
+    [ 67] = { CO_LSS_WAIT              , COLssSwitchStateSelective_Serial },
+    [ 21] = {               CO_LSS_CONF, COLssActivateBitTiming },
+    [ 19] = {               CO_LSS_CONF, COLssConfigureBitTiming },
+    [ 17] = {               CO_LSS_CONF, COLssConfigureNodeId },
+    [ 23] = {               CO_LSS_CONF, COLssStoreConfiguration },
+    [ 90] = {               CO_LSS_CONF, COLssInquireAddress_Vendor },
+    [ 91] = {               CO_LSS_CONF, COLssInquireAddress_Product },
+    [ 92] = {               CO_LSS_CONF, COLssInquireAddress_Revision },
+    [ 93] = {               CO_LSS_CONF, COLssInquireAddress_Serial },
+    [ 94] = {               CO_LSS_CONF, COLssInquireNodeId },
+    [ 70] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_Vendor },
+    [ 71] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_Product },
+    [ 72] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_RevMin },
+    [ 73] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_RevMax },
+    [ 74] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_SerMin },
+    [ 75] = { CO_LSS_WAIT | CO_LSS_CONF, COLssIdentifyRemoteSlave_SerMax },
+    [ 76] = { CO_LSS_WAIT | CO_LSS_CONF, COLssNonConfiguredRemoteSlave },
+    [ 81] = { CO_LSS_WAIT              , COLssFastscan }
 };
 
 const uint32_t CO_LssBaudTbl[CO_LSS_MAX_BAUD] = {
@@ -83,6 +85,7 @@ void COLssInit (CO_LSS *lss, CO_NODE *node)
     lss->CfgBaudrate = 0;
     lss->CfgNodeId   = 0;
     lss->Step        = CO_LSS_SEL_VENDOR;
+    lss->FsPos       = CO_LSS_FS_IDLE;
 
     for (subidx = 1; subidx <= 4; subidx++) {
         obj = CODictFind(&node->Dict, CO_DEV(0x1018, subidx));
@@ -105,20 +108,12 @@ int16_t COLssCheck (CO_LSS *lss, CO_IF_FRM *frm)
 {
     int16_t           result = 0;
     const CO_LSS_MAP *map;
-    uint8_t           sid;
-    uint8_t           cmd;
 
     if (CO_GET_ID(frm) == CO_LSS_RX_ID) {
         result = -1;
-        cmd    = CO_GET_BYTE(frm, 0);
-        for (sid = 0; sid < CO_LSS_MAX_SID; sid++) {
-            map = &COLssServices[sid];
-            if (map->Request == cmd) {
-                if ((map->Allowed & lss->Mode) > 0) {
-                    result = map->Service(lss, frm);
-                }
-                break;
-            }
+        map    = &COLssServices[CO_GET_BYTE(frm, 0)];
+        if ((map->Allowed & lss->Mode) > 0) {
+            result = map->Service(lss, frm);
         }
     }
 
@@ -504,3 +499,51 @@ int16_t COLssNonConfiguredRemoteSlave(CO_LSS *lss, CO_IF_FRM *frm)
     }
     return result;
 }
+
+int16_t COLssFastscan(CO_LSS *lss, CO_IF_FRM *frm)
+{
+    CO_NODE *node;
+    uint32_t select;
+    uint32_t ident;
+    uint8_t  bit;
+    uint8_t  sub;
+    uint8_t  next;
+    int16_t  result = -1;
+    int16_t  err;
+
+    /* only slaves without active and without pending node ID take part */
+    node = lss->Node;
+    if ((node->NodeId != (uint8_t)0xff) ||
+        ((lss->CfgNodeId >= 1) && (lss->CfgNodeId <= 127))) {
+        return -1;
+    }
+
+    select = CO_GET_LONG(frm, 1);
+    bit    = CO_GET_BYTE(frm, 5);
+    sub    = CO_GET_BYTE(frm, 6);
+    next   = CO_GET_BYTE(frm, 7);
+    if (bit == CO_LSS_FS_RESET) {
+        lss->FsPos = CO_LSS_SEL_VENDOR;
+        result     = 1;
+    } else if ((bit < 32) && (sub == lss->FsPos) && (next <= CO_LSS_SEL_SERIAL)) {
+        err = CODictRdLong(&node->Dict, CO_DEV(0x1018, sub + 1), &ident);
+        if ((err == CO_ERR_NONE) &&
+            (((select ^ ident) & (0xFFFFFFFFuL << bit)) == 0)) {
+            result = 1;
+            if (bit == 0) {
+                lss->FsPos = next;
+                if (next < sub) {
+                    lss->FsPos = CO_LSS_FS_IDLE;
+                    lss->Mode  = CO_LSS_CONF;
+                }
+            }
+        }
+    }
+    if (result > 0) {
+        CO_SET_LONG(frm, 0L, 0);
+        CO_SET_LONG(frm, 0L, 4);
+        CO_SET_BYTE(frm, CO_LSS_RES_SLAVE, 0);
+        CO_SET_ID(frm, CO_LSS_TX_ID);
+    }
+    return result;
+}
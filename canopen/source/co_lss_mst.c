@@ -0,0 +1,327 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_lss_mst.h"
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_LSS_MST_CS_SWITCH      4u  /*!< switch state global               */
+#define CO_LSS_MST_CS_NODE_ID    17u  /*!< configure node ID                 */
+#define CO_LSS_MST_CS_FASTSCAN   81u  /*!< fastscan                          */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SEND LSS REQUEST
+*
+*    This function sends a LSS request with the given command specifier,
+*    the 32bit value in byte 1..4 and the bytes 5..7.
+*
+* \param mst
+*    reference to LSS master structure
+*
+* \param cmd
+*    LSS command specifier
+*
+* \param val
+*    32bit value in byte 1..4
+*
+* \param b5
+*    value of byte 5
+*
+* \param b6
+*    value of byte 6
+*
+* \param b7
+*    value of byte 7
+*/
+static void COLssMstSend(CO_LSS_MST *mst,
+                         uint8_t     cmd,
+                         uint32_t    val,
+                         uint8_t     b5,
+                         uint8_t     b6,
+                         uint8_t     b7)
+{
+    CO_IF_FRM frm;
+
+    CO_SET_ID  (&frm, CO_LSS_RX_ID);
+    CO_SET_DLC (&frm, 8);
+    CO_SET_BYTE(&frm, cmd, 0);
+    CO_SET_LONG(&frm, val, 1);
+    CO_SET_BYTE(&frm, b5, 5);
+    CO_SET_BYTE(&frm, b6, 6);
+    CO_SET_BYTE(&frm, b7, 7);
+    (void)COIfSend(&mst->Node->If, &frm);
+}
+
+/*! \brief  FINISH LSS MASTER SERVICE
+*
+*    This function finishes the running LSS master service and reports the
+*    given event.
+*
+* \param mst
+*    reference to LSS master structure
+*
+* \param event
+*    reported LSS master event
+*/
+static void COLssMstFinish(CO_LSS_MST *mst, CO_LSS_MST_EVENT event)
+{
+    if (mst->Tmr >= 0) {
+        (void)COTmrDelete(&mst->Node->Tmr, mst->Tmr);
+        mst->Tmr = -1;
+    }
+    mst->State = CO_LSS_MST_IDLE;
+    mst->Time  = mst->Node->Tmr.Ticks - mst->Start;
+    if (mst->Func != 0) {
+        mst->Func(mst, event);
+    }
+}
+
+/*! \brief  TIMEOUT CALLBACK
+*
+*    This timer callback function evaluates the responses of the current
+*    step at the end of the response timeout.
+*
+* \param parg
+*    reference to LSS master structure
+*/
+static void COLssMstTimeout(void *parg);
+
+/*! \brief  START LSS MASTER STEP
+*
+*    This function sends the request of the current step and starts the
+*    response timeout.
+*
+* \param mst
+*    reference to LSS master structure
+*/
+static void COLssMstStep(CO_LSS_MST *mst)
+{
+    uint32_t ticks;
+    uint8_t  sub;
+
+    sub = mst->Sub;
+    switch (mst->State) {
+        case CO_LSS_MST_RESET:
+            COLssMstSend(mst, CO_LSS_MST_CS_FASTSCAN, 0, CO_LSS_FS_RESET, 0, 0);
+            break;
+        case CO_LSS_MST_SCAN:
+            COLssMstSend(mst, CO_LSS_MST_CS_FASTSCAN, mst->Id[sub], mst->Bit, sub, sub);
+            break;
+        case CO_LSS_MST_CONFIRM:
+            COLssMstSend(mst, CO_LSS_MST_CS_FASTSCAN, mst->Id[sub], 0, sub,
+                         (uint8_t)((sub + 1u) & 3u));
+            break;
+        case CO_LSS_MST_NODE_ID:
+            COLssMstSend(mst, CO_LSS_MST_CS_NODE_ID, mst->NodeId, 0, 0, 0);
+            break;
+        default:
+            return;
+    }
+
+    mst->Resp = 0;
+    ticks     = CO_TMR_TICKS((uint32_t)mst->Timeout +
+                             (1000u / CO_TMR_TICKS_PER_SEC) - 1u);
+    if (ticks == 0) {
+        ticks = 1;
+    }
+    mst->Tmr = COTmrCreate(&mst->Node->Tmr, ticks, 0, COLssMstTimeout, mst);
+    if (mst->Tmr < 0) {
+        mst->Node->Error = CO_ERR_TMR_CREATE;
+        mst->State       = CO_LSS_MST_IDLE;
+    }
+}
+
+static void COLssMstTimeout(void *parg)
+{
+    CO_LSS_MST *mst;
+
+    mst      = (CO_LSS_MST *)parg;
+    mst->Tmr = -1;
+    switch (mst->State) {
+        case CO_LSS_MST_RESET:
+            if (mst->Resp == 0) {
+                COLssMstFinish(mst, CO_LSS_MST_NONE);
+                return;
+            }
+            mst->Id[0] = 0;
+            mst->Id[1] = 0;
+            mst->Id[2] = 0;
+            mst->Id[3] = 0;
+            mst->Sub   = 0;
+            mst->Bit   = 31;
+            mst->State = CO_LSS_MST_SCAN;
+            break;
+        case CO_LSS_MST_SCAN:
+            /* no response: all remaining slaves have this bit set */
+            if (mst->Resp == 0) {
+                mst->Id[mst->Sub] |= ((uint32_t)1 << mst->Bit);
+            }
+            if (mst->Bit > 0) {
+                mst->Bit--;
+            } else {
+                mst->State = CO_LSS_MST_CONFIRM;
+            }
+            break;
+        case CO_LSS_MST_CONFIRM:
+            if (mst->Resp == 0) {
+                COLssMstFinish(mst, CO_LSS_MST_LOST);
+                return;
+            }
+            if (mst->Sub == CO_LSS_SEL_SERIAL) {
+                COLssMstFinish(mst, CO_LSS_MST_FOUND);
+                return;
+            }
+            mst->Sub++;
+            mst->Bit   = 31;
+            mst->State = CO_LSS_MST_SCAN;
+            break;
+        case CO_LSS_MST_NODE_ID:
+            COLssMstFinish(mst, CO_LSS_MST_NODE_ID_ERR);
+            return;
+        default:
+            return;
+    }
+    COLssMstStep(mst);
+}
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COLssMstInit(CO_LSS_MST       *mst,
+                     struct CO_NODE_T *node,
+                     uint16_t          timeout,
+                     CO_LSS_MST_FUNC   func)
+{
+    if ((mst == 0) || (node == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    node->Lss.Mst = 0;
+    mst->Node     = node;
+    mst->Func     = func;
+    mst->Id[0]    = 0;
+    mst->Id[1]    = 0;
+    mst->Id[2]    = 0;
+    mst->Id[3]    = 0;
+    mst->Start    = 0;
+    mst->Time     = 0;
+    mst->Timeout  = timeout;
+    mst->Tmr      = -1;
+    mst->State    = CO_LSS_MST_IDLE;
+    mst->Sub      = 0;
+    mst->Bit      = 0;
+    mst->Resp     = 0;
+    mst->NodeId   = 0;
+
+    node->Lss.Mst = mst;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COLssMstFastscan(CO_LSS_MST *mst)
+{
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if (mst->State != CO_LSS_MST_IDLE) {
+        return (CO_ERR_BAD_ARG);
+    }
+    mst->Start = mst->Node->Tmr.Ticks;
+    mst->State = CO_LSS_MST_RESET;
+    COLssMstStep(mst);
+    if (mst->State == CO_LSS_MST_IDLE) {
+        return (CO_ERR_TMR_CREATE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COLssMstNodeId(CO_LSS_MST *mst, uint8_t nodeId)
+{
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((nodeId < 1) || (nodeId > 127) || (mst->State != CO_LSS_MST_IDLE)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    mst->Start  = mst->Node->Tmr.Ticks;
+    mst->NodeId = nodeId;
+    mst->State  = CO_LSS_MST_NODE_ID;
+    COLssMstStep(mst);
+    if (mst->State == CO_LSS_MST_IDLE) {
+        return (CO_ERR_TMR_CREATE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COLssMstCheck(CO_LSS_MST *mst, CO_IF_FRM *frm)
+{
+    uint8_t cmd;
+
+    if ((mst == 0) || (mst->State == CO_LSS_MST_IDLE)) {
+        return (-1);
+    }
+    if (CO_GET_ID(frm) != CO_LSS_TX_ID) {
+        return (-1);
+    }
+
+    cmd = CO_GET_BYTE(frm, 0);
+    if (mst->State == CO_LSS_MST_NODE_ID) {
+        if (cmd != CO_LSS_MST_CS_NODE_ID) {
+            return (-1);
+        }
+        if (CO_GET_BYTE(frm, 1) == 0) {
+            COLssMstSend(mst, CO_LSS_MST_CS_SWITCH, CO_LSS_CMD_WAIT, 0, 0, 0);
+            COLssMstFinish(mst, CO_LSS_MST_NODE_ID_OK);
+        } else {
+            COLssMstFinish(mst, CO_LSS_MST_NODE_ID_ERR);
+        }
+        return (0);
+    }
+
+    /* fastscan: count the responses until the end of the timeout */
+    if (cmd != CO_LSS_RES_SLAVE) {
+        return (-1);
+    }
+    if (mst->Resp < 0xFF) {
+        mst->Resp++;
+    }
+    return (0);
+}
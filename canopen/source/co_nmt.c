@@ -22,6 +22,24 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE MACROS
+******************************************************************************/
+
+/*! \brief HEARTBEAT CONSUMER MONITOR TICKS
+*
+*    This macro calculates the monitor ticks for a given consumer time in
+*    ms. The monitor needs at least a single tick.
+*/
+#define CO_HBCONS_TICKS(ms)  ((CO_TMR_TICKS(ms) > 0) ? CO_TMR_TICKS(ms) : 1)
+
+/*! \brief HEARTBEAT CONSUMER IDLE DEADLINE
+*
+*    This macro calculates the deadline, which is used when no consumer
+*    monitoring is started. The deadline is the farthest future tick.
+*/
+#define CO_HBCONS_IDLE(t)    ((uint32_t)(t) + 0x7FFFFFFFu)
+
 /******************************************************************************
 * PRIVATE CONSTANTS
 ******************************************************************************/
@@ -81,8 +99,13 @@ const CO_OBJ_TYPE COTNmtHbProd = { 0, 0, 0, COTypeNmtHbProdWrite };
 */
 void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
 {
-    uint8_t nobootup = 1;
-    int16_t err;
+    CO_NMT_BOOT  *boot;
+    CO_EMCY_CONS *cons;
+    CO_LSS_MST   *lss;
+    uint16_t      mask;
+    uint16_t      match;
+    uint8_t       nobootup = 1;
+    int16_t       err;
 
     if (nmt == 0) {
         CONodeFatalError();
@@ -106,10 +129,36 @@ void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
         }
         COLssInit(&nmt->Node->Lss, nmt->Node);
         COTmrClear(&nmt->Node->Tmr);
+        if (nmt->Node->Lss.Mst != 0) {
+            lss = nmt->Node->Lss.Mst;
+            (void)COLssMstInit(lss, nmt->Node, lss->Timeout, lss->Func);
+        }
         CONmtInit(nmt, nmt->Node);
+        if (nmt->Mst != 0) {
+            boot = nmt->Mst->Boot;
+            (void)CONmtMstInit(nmt->Mst, nmt->Node, nmt->Mst->Slave,
+                               nmt->Mst->Num, nmt->Mst->Func);
+            if (boot != 0) {
+                (void)CONmtBootInit(boot, nmt->Mst, boot->Cfg, boot->Num,
+                                    boot->Par, boot->Budget);
+            }
+        }
         COSdoInit(nmt->Node->Sdo, nmt->Node);
         COIfReset(&nmt->Node->If);
-        COEmcyReset(&nmt->Node->Emcy, 1);
+        if (nmt->Node->Emcy.Root != 0) {
+            COEmcyTxInit(&nmt->Node->Emcy);
+        }
+        if (nmt->Node->Emcy.Cons != 0) {
+            cons  = nmt->Node->Emcy.Cons;
+            mask  = cons->Mask;
+            match = cons->Match;
+            (void)COEmcyConsInit(cons, nmt->Node, cons->Prod, cons->Num,
+                                 cons->Func);
+            COEmcyConsSetFilter(cons, mask, match);
+        }
+        if (nmt->Node->Emcy.Root != 0) {
+            COEmcyReset(&nmt->Node->Emcy, 1);
+        }
         COSyncInit(&nmt->Node->Sync, nmt->Node);
         if (nobootup == 0) {
             CONmtBootup(nmt);
@@ -236,13 +285,13 @@ int16_t CONmtGetHbEvents(CO_NMT *nmt, uint8_t nodeId)
         return (result);
     }
 
-    hbc = nmt->HbCons;
-    while (hbc != 0) {
-        if (nodeId == hbc->NodeId) {
-            result     = (int16_t)hbc->Event;
-            hbc->Event = 0;
-        }
-        hbc = hbc->Next;
+    if (nodeId >= CO_HBCONS_NODE_N) {
+        return (result);
+    }
+    hbc = nmt->HbTbl[nodeId];
+    if (hbc != 0) {
+        result     = (int16_t)hbc->Event;
+        hbc->Event = 0;
     }
 
     return (result);
@@ -261,12 +310,12 @@ CO_MODE CONmtLastHbState(CO_NMT *nmt, uint8_t nodeId)
         return (result);
     }
 
-    hbc = nmt->HbCons;
-    while (hbc != 0) {
-        if (nodeId == hbc->NodeId) {
-            result = hbc->State;
-        }
-        hbc = hbc->Next;
+    if (nodeId >= CO_HBCONS_NODE_N) {
+        return (result);
+    }
+    hbc = nmt->HbTbl[nodeId];
+    if (hbc != 0) {
+        result = hbc->State;
     }
 
     return (result);
@@ -283,12 +332,22 @@ void CONmtHbConsInit(CO_NMT *nmt)
     CO_HBCONS *hbc;
     CO_NODE   *node;
     CO_ERR     act;
+    uint8_t    id;
 
     if (nmt == 0) {
         CONodeFatalError();
         return;
     }
     nmt->HbCons = 0;
+    for (id = 0; id < CO_HBCONS_NODE_N; id++) {
+        nmt->HbTbl[id] = 0;
+    }
+    if (nmt->HbTmr >= 0) {
+        (void)COTmrDelete(&nmt->Node->Tmr, nmt->HbTmr);
+        nmt->HbTmr = -1;
+    }
+    nmt->HbTick = 0;
+    nmt->HbDue  = CO_HBCONS_IDLE(0);
 
     node = nmt->Node;
     obj  = CODictFind(&node->Dict, CO_DEV(0x1016, 0));
@@ -334,53 +393,61 @@ CO_ERR CONmtHbConsActivate(CO_NMT    *nmt,
     CO_HBCONS  *prev;
     CO_HBCONS  *found = 0;
 
-    prev = 0;
-    act  = nmt->HbCons;
-    while (act != 0) {
-        if (act->NodeId == nodeid) {
-            found = act;
-            break;
-        }
-        prev = act;
-        act  = act->Next;
+    if (nodeid < CO_HBCONS_NODE_N) {
+        found = nmt->HbTbl[nodeid];
+    } else if (time > 0) {
+        return (CO_ERR_OBJ_RANGE);
+    }
+    if ((found != 0) && (time > 0)) {
+        return (CO_ERR_OBJ_INCOMPATIBLE);
     }
 
-    if (found != 0) {
-        if (time > 0) {
-            result = CO_ERR_OBJ_INCOMPATIBLE;
+    if ((hbc->NodeId < CO_HBCONS_NODE_N) &&
+        (nmt->HbTbl[hbc->NodeId] == hbc)) {
+        prev = 0;
+        act  = nmt->HbCons;
+        while ((act != 0) && (act != hbc)) {
+            prev = act;
+            act  = act->Next;
+        }
+        if (prev == 0) {
+            nmt->HbCons = hbc->Next;
         } else {
-            if (hbc->Tmr >= 0) {
-                err = COTmrDelete(&nmt->Node->Tmr, hbc->Tmr);
-                if (err < 0) {
-                    result = CO_ERR_TMR_DELETE;
-                }
-            }
-            hbc->Time   = time;
-            hbc->NodeId = nodeid;
-            hbc->Tmr    = -1;
-            hbc->Event  = 0;
-            hbc->State  = CO_INVALID;
-            hbc->Node   = nmt->Node;
-            if (prev == 0) {
-                nmt->HbCons = hbc->Next;
-            } else {
-                prev->Next  = hbc->Next;
+            prev->Next  = hbc->Next;
+        }
+        nmt->HbTbl[hbc->NodeId] = 0;
+        if ((nmt->HbCons == 0) && (nmt->HbTmr >= 0)) {
+            err = COTmrDelete(&nmt->Node->Tmr, nmt->HbTmr);
+            if (err < 0) {
+                result = CO_ERR_TMR_DELETE;
             }
-            hbc->Next   = 0;
+            nmt->HbTmr = -1;
         }
-    } else {
-        hbc->Time   = time;
-        hbc->NodeId = nodeid;
-        hbc->Tmr    = -1;
-        hbc->Event  = 0;
-        hbc->State  = CO_INVALID;
-        hbc->Node   = nmt->Node;
-
-        if (time > 0) {
-            hbc->Next   = nmt->HbCons;
-            nmt->HbCons = hbc;
-        } else {
-            hbc->Next   = 0;
+    }
+
+    hbc->Time   = time;
+    hbc->NodeId = nodeid;
+    hbc->Due    = 0;
+    hbc->Run    = 0;
+    hbc->Event  = 0;
+    hbc->State  = CO_INVALID;
+    hbc->Node   = nmt->Node;
+    hbc->Next   = 0;
+    if (time > 0) {
+        hbc->Next           = nmt->HbCons;
+        nmt->HbCons         = hbc;
+        nmt->HbTbl[nodeid]  = hbc;
+        if (nmt->HbTmr < 0) {
+            nmt->HbTick = 0;
+            nmt->HbDue  = CO_HBCONS_IDLE(0);
+            nmt->HbTmr  = COTmrCreate(&nmt->Node->Tmr,
+                1,
+                1,
+                CONmtHbConsMonitor,
+                nmt);
+            if (nmt->HbTmr < 0) {
+                result = CO_ERR_TMR_CREATE;
+            }
         }
     }
 
@@ -399,40 +466,27 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
     CO_HBCONS *hbc;
 
     cobid  = frm->Identifier;
-    hbc    = nmt->HbCons;
-    if (hbc == 0) {
-        return (result);
-    }
     if ((cobid >= 1792) &&
         (cobid <= 1792 + 127)) {
         nodeid = (uint8_t)(cobid - 1792);
     } else {
         return (result);
     }
-    while (hbc != 0) {
-        if (hbc->NodeId != nodeid) {
-            hbc = hbc->Next;
-        } else {
-            if (hbc->Tmr >= 0) {
-                COTmrDelete(&nmt->Node->Tmr, hbc->Tmr);
-            } 
-            hbc->Tmr = COTmrCreate(&nmt->Node->Tmr,
-                CO_TMR_TICKS(hbc->Time),
-                0,
-                CONmtHbConsMonitor,
-                hbc);
-            if (hbc->Tmr < 0) {
-                nmt->Node->Error = CO_ERR_TMR_CREATE;
-            }
-            state = CONmtModeDecode(frm->Data[0]);
-            if (hbc->State != state) {
-                CONmtHbConsChange(nmt, hbc->NodeId, state);
-            }
-            hbc->State = state;
-            result     = (int16_t)hbc->NodeId;
-            break;
-        }
+    hbc = nmt->HbTbl[nodeid];
+    if (hbc == 0) {
+        return (result);
+    }
+    hbc->Due = nmt->HbTick + CO_HBCONS_TICKS(hbc->Time);
+    hbc->Run = 1;
+    if ((int32_t)(hbc->Due - nmt->HbDue) < 0) {
+        nmt->HbDue = hbc->Due;
     }
+    state = CONmtModeDecode(frm->Data[0]);
+    if (hbc->State != state) {
+        CONmtHbConsChange(nmt, hbc->NodeId, state);
+    }
+    hbc->State = state;
+    result     = (int16_t)hbc->NodeId;
 
     return (result);
 }
@@ -442,24 +496,36 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
 */
 void CONmtHbConsMonitor(void *parg)
 {
-    CO_NODE   *node;
+    CO_NMT    *nmt;
     CO_HBCONS *hbc;
+    CO_HBCONS *next;
+    uint32_t   due;
 
-    hbc  = (CO_HBCONS *)parg;
-    node = hbc->Node;
-
-    hbc->Tmr = COTmrCreate(&node->Tmr,
-        CO_TMR_TICKS(hbc->Time),
-        0,
-        CONmtHbConsMonitor,
-        hbc);
-    if (hbc->Tmr < 0) {
-        node->Error = CO_ERR_TMR_CREATE;
+    nmt = (CO_NMT *)parg;
+    nmt->HbTick++;
+    if ((int32_t)(nmt->HbTick - nmt->HbDue) < 0) {
+        return;
     }
-    if (hbc->Event < 0xFFu) {
-        hbc->Event++;
+
+    due = CO_HBCONS_IDLE(nmt->HbTick);
+    hbc = nmt->HbCons;
+    while (hbc != 0) {
+        next = hbc->Next;
+        if (hbc->Run != 0) {
+            if ((int32_t)(nmt->HbTick - hbc->Due) >= 0) {
+                hbc->Due = nmt->HbTick + CO_HBCONS_TICKS(hbc->Time);
+                if (hbc->Event < 0xFFu) {
+                    hbc->Event++;
+                }
+                CONmtHbConsEvent(nmt, hbc->NodeId);
+            }
+            if ((int32_t)(hbc->Due - due) < 0) {
+                due = hbc->Due;
+            }
+        }
+        hbc = next;
     }
-    CONmtHbConsEvent(&node->Nmt, hbc->NodeId);
+    nmt->HbDue = due;
 }
 
 /*
@@ -546,8 +612,10 @@ void CONmtHbProdInit(CO_NMT *nmt)
         }
     }
 
+    nmt->HbStat.Cycle = CO_TMR_TICKS(cycTime);
+    CONmtHbStatReset(nmt);
     if (cycTime > 0) {
-        nmt->Tmr = COTmrCreate(&node->Tmr,
+        nmt->Tmr = COTmrCreatePrio(&node->Tmr,
             CO_TMR_TICKS(cycTime),
             CO_TMR_TICKS(cycTime),
             CONmtHbProdSend,
@@ -565,15 +633,32 @@ void CONmtHbProdInit(CO_NMT *nmt)
 */
 void CONmtHbProdSend(void *parg)
 {
-    CO_IF_FRM  frm;
-    CO_NMT    *nmt;
-    uint8_t    state;
+    CO_IF_FRM       frm;
+    CO_NMT         *nmt;
+    CO_NMT_HB_STAT *stat;
+    uint32_t        now;
+    uint32_t        period;
+    uint8_t         state;
 
     nmt = (CO_NMT *)parg;
     if ((nmt->Allowed & CO_NMT_ALLOWED) == 0) {
         return;
     }
 
+    stat = &nmt->HbStat;
+    now  = nmt->Node->Tmr.Ticks;
+    if (stat->Num > 0) {
+        period = now - stat->Last;
+        if (period < stat->Min) {
+            stat->Min = period;
+        }
+        if (period > stat->Max) {
+            stat->Max = period;
+        }
+    }
+    stat->Last = now;
+    stat->Num++;
+
     state = CONmtModeEncode(nmt->Mode);
 
     CO_SET_ID(&frm, 1792 + nmt->Node->NodeId);
@@ -583,6 +668,48 @@ void CONmtHbProdSend(void *parg)
     (void)COIfSend(&nmt->Node->If, &frm);
 }
 
+/*
+* see function definition
+*/
+uint32_t CONmtHbJitter(CO_NMT *nmt)
+{
+    CO_NMT_HB_STAT *stat;
+    uint32_t        result = 0;
+
+    if (nmt == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    stat = &nmt->HbStat;
+    if (stat->Num < 2) {
+        return (result);
+    }
+    if (stat->Max > stat->Cycle) {
+        result = stat->Max - stat->Cycle;
+    }
+    if ((stat->Min < stat->Cycle) && ((stat->Cycle - stat->Min) > result)) {
+        result = stat->Cycle - stat->Min;
+    }
+    result = (result * 1000u) / CO_TMR_TICKS_PER_SEC;
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+void CONmtHbStatReset(CO_NMT *nmt)
+{
+    if (nmt == 0) {
+        CONodeFatalError();
+        return;
+    }
+    nmt->HbStat.Num  = 0;
+    nmt->HbStat.Last = 0;
+    nmt->HbStat.Min  = 0xFFFFFFFFu;
+    nmt->HbStat.Max  = 0;
+}
+
 /*
 * see function definition
 */
@@ -675,8 +802,10 @@ int16_t COTypeNmtHbProdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uin
         }
         node->Nmt.Tmr = -1;
     }
+    node->Nmt.HbStat.Cycle = CO_TMR_TICKS(cycTime);
+    CONmtHbStatReset(&node->Nmt);
     if (cycTime > 0) {
-        node->Nmt.Tmr = COTmrCreate(&node->Tmr,
+        node->Nmt.Tmr = COTmrCreatePrio(&node->Tmr,
             CO_TMR_TICKS(cycTime),
             CO_TMR_TICKS(cycTime),
             CONmtHbProdSend,
@@ -687,7 +816,7 @@ int16_t COTypeNmtHbProdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uin
     } else {
         node->Nmt.Tmr = -1;
     }
-    result = COObjWrDirect(obj, (void *)&cycTime, CO_WORD);
+    result = COObjWrDirect(obj, node, (void *)&cycTime, CO_WORD);
 
     return (result);
 }
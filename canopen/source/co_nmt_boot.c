@@ -0,0 +1,482 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_nmt_boot.h"
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_NMT_BOOT_INIT     0    /*!< step: initiate download of record     */
+#define CO_NMT_BOOT_SEG      1    /*!< step: download segment of record      */
+
+#define CO_NMT_BOOT_ABORT_TIMEOUT  0x05040000  /*!< SDO protocol timed out   */
+#define CO_NMT_BOOT_ABORT_CMD      0x05040001  /*!< invalid command          */
+#define CO_NMT_BOOT_ABORT_IMG      0x08000000  /*!< general error            */
+
+/******************************************************************************
+* PRIVATE MACROS
+******************************************************************************/
+
+/*! \brief SDO RESPONSE TIMEOUT TICKS
+*
+*    This macro calculates the monitor ticks for the SDO response timeout.
+*    The timeout needs at least a single tick.
+*/
+#define CO_NMT_BOOT_TICKS   \
+    ((CO_TMR_TICKS(CO_NMT_BOOT_TIMEOUT) > 0) ? CO_TMR_TICKS(CO_NMT_BOOT_TIMEOUT) : 1)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  GET RECORD VALUE LENGTH
+*
+*    This function returns the value length of the current record in the
+*    configuration image.
+*
+* \param cfg
+*    reference to slave configuration
+*
+* \return  value length in bytes, or 0 if the record is truncated or empty
+*/
+static uint32_t CONmtBootRecLen(CO_NMT_CFG *cfg)
+{
+    uint8_t  *rec;
+    uint32_t  len;
+
+    if ((cfg->Len - cfg->Pos) < CO_DICT_IMG_HDR) {
+        return (0);
+    }
+    rec = &cfg->Img[cfg->Pos];
+    len = ((uint32_t)rec[3])       |
+          ((uint32_t)rec[4] <<  8) |
+          ((uint32_t)rec[5] << 16) |
+          ((uint32_t)rec[6] << 24);
+    if (len > (cfg->Len - cfg->Pos - CO_DICT_IMG_HDR)) {
+        len = 0;
+    }
+    return (len);
+}
+
+/*! \brief  SEND SDO ABORT
+*
+*    This function sends the SDO abort for the current record of the given
+*    slave configuration.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param cfg
+*    reference to slave configuration
+*
+* \param code
+*    SDO abort code
+*/
+static void CONmtBootAbort(CO_NMT_BOOT *boot, CO_NMT_CFG *cfg, uint32_t code)
+{
+    CO_IF_FRM frm;
+    uint8_t  *rec;
+
+    rec = &cfg->Img[cfg->Pos];
+    frm.Identifier = 0x600u + cfg->NodeId;
+    frm.DLC        = 8;
+    frm.Data[0]    = 0x80;
+    frm.Data[1]    = rec[0];
+    frm.Data[2]    = rec[1];
+    frm.Data[3]    = rec[2];
+    frm.Data[4]    = (uint8_t)(code);
+    frm.Data[5]    = (uint8_t)(code >>  8);
+    frm.Data[6]    = (uint8_t)(code >> 16);
+    frm.Data[7]    = (uint8_t)(code >> 24);
+    (void)COIfSend(&boot->Mst->Node->If, &frm);
+}
+
+/*! \brief  FINISH SLAVE CONFIGURATION
+*
+*    This function finishes the configuration of the given slave with the
+*    given SDO abort code and reports the result to the NMT master.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param cfg
+*    reference to slave configuration
+*
+* \param code
+*    SDO abort code (or 0 for a successful configuration)
+*/
+static void CONmtBootFinish(CO_NMT_BOOT *boot, CO_NMT_CFG *cfg, uint32_t code)
+{
+    CO_NMT_MST   *mst = boot->Mst;
+    CO_NMT_SLAVE *slave;
+
+    cfg->Req   = 0;
+    cfg->Abort = code;
+    cfg->Time  = ((mst->Tick - cfg->Start) * 1000u) / CO_TMR_TICKS_PER_SEC;
+    boot->Busy--;
+    if (code != 0) {
+        cfg->State = CO_NMT_CFG_ERROR;
+        if (mst->Func != 0) {
+            mst->Func(mst, cfg->NodeId, CO_NMT_MST_CONFIG_ERR);
+        }
+        return;
+    }
+
+    cfg->State = CO_NMT_CFG_DONE;
+    if (mst->Func != 0) {
+        mst->Func(mst, cfg->NodeId, CO_NMT_MST_CONFIG);
+    }
+    slave = &mst->Slave[mst->Idx[cfg->NodeId] - 1];
+    if ((slave->Flags & CO_NMT_MST_START) != 0) {
+        (void)CONmtMstSetNodeMode(mst, cfg->NodeId, CO_OPERATIONAL);
+    }
+}
+
+/*! \brief  SEND SDO REQUEST
+*
+*    This function sends the next SDO download request of the given slave
+*    configuration.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param cfg
+*    reference to slave configuration
+*/
+static void CONmtBootSend(CO_NMT_BOOT *boot, CO_NMT_CFG *cfg)
+{
+    CO_IF_FRM frm;
+    uint8_t  *rec;
+    uint32_t  len;
+    uint8_t   num;
+    uint8_t   n;
+
+    rec = &cfg->Img[cfg->Pos];
+    len = CONmtBootRecLen(cfg);
+    frm.Identifier = 0x600u + cfg->NodeId;
+    frm.DLC        = 8;
+    for (n = 0; n < 8; n++) {
+        frm.Data[n] = 0;
+    }
+    if (cfg->Step == CO_NMT_BOOT_INIT) {
+        frm.Data[1] = rec[0];
+        frm.Data[2] = rec[1];
+        frm.Data[3] = rec[2];
+        if (len <= 4) {
+            frm.Data[0] = (uint8_t)(0x23u | ((4u - len) << 2));
+            for (n = 0; n < len; n++) {
+                frm.Data[4 + n] = rec[CO_DICT_IMG_HDR + n];
+            }
+        } else {
+            frm.Data[0] = 0x21;
+            for (n = 0; n < 4; n++) {
+                frm.Data[4 + n] = rec[3 + n];
+            }
+        }
+    } else {
+        num = 7;
+        if ((len - cfg->Seg) < 7) {
+            num = (uint8_t)(len - cfg->Seg);
+        }
+        frm.Data[0] = (uint8_t)((cfg->Toggle << 4) | ((7u - num) << 1));
+        if ((cfg->Seg + num) == len) {
+            frm.Data[0] |= 0x01;
+        }
+        for (n = 0; n < num; n++) {
+            frm.Data[1 + n] = rec[CO_DICT_IMG_HDR + cfg->Seg + n];
+        }
+    }
+
+    cfg->Req = 0;
+    cfg->Due = boot->Mst->Tick + CO_NMT_BOOT_TICKS;
+    boot->Sent++;
+    (void)COIfSend(&boot->Mst->Node->If, &frm);
+}
+
+/*! \brief  REQUEST NEXT TRANSFER
+*
+*    This function requests the next SDO transfer of the given slave
+*    configuration. The request is sent immediately within the bus-load
+*    budget of the current tick, otherwise with one of the next ticks.
+*
+* \param boot
+*    reference to NMT boot engine structure
+*
+* \param cfg
+*    reference to slave configuration
+*/
+static void CONmtBootNext(CO_NMT_BOOT *boot, CO_NMT_CFG *cfg)
+{
+    if (cfg->Pos >= cfg->Len) {
+        CONmtBootFinish(boot, cfg, 0);
+        return;
+    }
+    if (CONmtBootRecLen(cfg) == 0) {
+        CONmtBootFinish(boot, cfg, CO_NMT_BOOT_ABORT_IMG);
+        return;
+    }
+    cfg->Req = 1;
+    if (boot->Sent < boot->Budget) {
+        CONmtBootSend(boot, cfg);
+    }
+}
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CONmtBootInit(CO_NMT_BOOT         *boot,
+                      struct CO_NMT_MST_T *mst,
+                      CO_NMT_CFG          *cfg,
+                      uint8_t              num,
+                      uint8_t              par,
+                      uint8_t              budget)
+{
+    uint8_t id;
+    uint8_t n;
+
+    if ((boot == 0) || (mst == 0) || ((cfg == 0) && (num > 0))) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    mst->Boot    = 0;
+    boot->Mst    = mst;
+    boot->Cfg    = cfg;
+    boot->Num    = 0;
+    boot->Par    = par;
+    boot->Budget = budget;
+    boot->Busy   = 0;
+    boot->Sent   = 0;
+    boot->Next   = 0;
+    for (id = 0; id < CO_HBCONS_NODE_N; id++) {
+        boot->Idx[id] = 0;
+    }
+    if ((par == 0) || (budget == 0)) {
+        mst->Node->Error = CO_ERR_BAD_ARG;
+        return (CO_ERR_BAD_ARG);
+    }
+    for (n = 0; n < num; n++) {
+        id = cfg[n].NodeId;
+        if ((id >= CO_HBCONS_NODE_N) || (mst->Idx[id] == 0) ||
+            (boot->Idx[id] != 0)) {
+            mst->Node->Error = CO_ERR_BAD_ARG;
+            return (CO_ERR_BAD_ARG);
+        }
+        boot->Idx[id] = n + 1;
+        cfg[n].State  = CO_NMT_CFG_WAIT;
+        cfg[n].Req    = 0;
+        cfg[n].Abort  = 0;
+        cfg[n].Time   = 0;
+    }
+    boot->Num = num;
+    mst->Boot = boot;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+uint8_t CONmtBootProgress(CO_NMT_BOOT *boot, uint8_t nodeId)
+{
+    CO_NMT_CFG *cfg;
+    uint8_t     result = 0;
+
+    if (boot == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    if ((nodeId < CO_HBCONS_NODE_N) && (boot->Idx[nodeId] != 0)) {
+        cfg = &boot->Cfg[boot->Idx[nodeId] - 1];
+        if (cfg->State == CO_NMT_CFG_DONE) {
+            result = 100;
+        } else if (cfg->State == CO_NMT_CFG_BUSY) {
+            result = (uint8_t)(((uint64_t)cfg->Pos * 100u) / cfg->Len);
+        }
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+uint8_t CONmtBootPending(CO_NMT_BOOT *boot)
+{
+    uint8_t result = 0;
+    uint8_t n;
+
+    if (boot == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    for (n = 0; n < boot->Num; n++) {
+        if (boot->Cfg[n].State <= CO_NMT_CFG_BUSY) {
+            result++;
+        }
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+uint8_t CONmtBootRestart(CO_NMT_BOOT *boot, uint8_t nodeId)
+{
+    CO_NMT_CFG *cfg;
+
+    if ((boot == 0) || (boot->Idx[nodeId] == 0)) {
+        return (0);
+    }
+    cfg = &boot->Cfg[boot->Idx[nodeId] - 1];
+    if (cfg->State == CO_NMT_CFG_BUSY) {
+        boot->Busy--;
+    }
+    cfg->State = CO_NMT_CFG_WAIT;
+    cfg->Req   = 0;
+    return (1);
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtBootCheck(CO_NMT_BOOT *boot, CO_IF_FRM *frm)
+{
+    CO_NMT_CFG *cfg;
+    uint32_t    cobid;
+    uint32_t    len;
+    uint32_t    code;
+    uint8_t     nodeid;
+    uint8_t     cmd;
+
+    if (boot == 0) {
+        return (-1);
+    }
+    cobid = frm->Identifier;
+    if ((cobid < 0x580) || (cobid > 0x580 + 127) || (frm->DLC != 8)) {
+        return (-1);
+    }
+    nodeid = (uint8_t)(cobid - 0x580);
+    if (boot->Idx[nodeid] == 0) {
+        return (-1);
+    }
+    cfg = &boot->Cfg[boot->Idx[nodeid] - 1];
+    if ((cfg->State != CO_NMT_CFG_BUSY) || (cfg->Req != 0)) {
+        return (-1);
+    }
+
+    cmd = frm->Data[0];
+    if (cmd == 0x80) {
+        code = ((uint32_t)frm->Data[4])       |
+               ((uint32_t)frm->Data[5] <<  8) |
+               ((uint32_t)frm->Data[6] << 16) |
+               ((uint32_t)frm->Data[7] << 24);
+        CONmtBootFinish(boot, cfg, code);
+        return ((int16_t)nodeid);
+    }
+
+    len = CONmtBootRecLen(cfg);
+    if (cfg->Step == CO_NMT_BOOT_INIT) {
+        if ((cmd != 0x60) ||
+            (frm->Data[1] != cfg->Img[cfg->Pos])     ||
+            (frm->Data[2] != cfg->Img[cfg->Pos + 1]) ||
+            (frm->Data[3] != cfg->Img[cfg->Pos + 2])) {
+            CONmtBootAbort(boot, cfg, CO_NMT_BOOT_ABORT_CMD);
+            CONmtBootFinish(boot, cfg, CO_NMT_BOOT_ABORT_CMD);
+            return ((int16_t)nodeid);
+        }
+        if (len > 4) {
+            cfg->Step   = CO_NMT_BOOT_SEG;
+            cfg->Seg    = 0;
+            cfg->Toggle = 0;
+        } else {
+            cfg->Seg    = len;
+        }
+    } else {
+        if (cmd != (uint8_t)(0x20u | (cfg->Toggle << 4))) {
+            CONmtBootAbort(boot, cfg, CO_NMT_BOOT_ABORT_CMD);
+            CONmtBootFinish(boot, cfg, CO_NMT_BOOT_ABORT_CMD);
+            return ((int16_t)nodeid);
+        }
+        cfg->Seg    += ((len - cfg->Seg) < 7) ? (len - cfg->Seg) : 7;
+        cfg->Toggle ^= 1;
+    }
+
+    if ((cfg->Step == CO_NMT_BOOT_INIT) || (cfg->Seg == len)) {
+        cfg->Pos  += CO_DICT_IMG_HDR + len;
+        cfg->Num++;
+        cfg->Step  = CO_NMT_BOOT_INIT;
+    }
+    CONmtBootNext(boot, cfg);
+    return ((int16_t)nodeid);
+}
+
+/*
+* see function definition
+*/
+void CONmtBootProcess(CO_NMT_BOOT *boot)
+{
+    CO_NMT_CFG *cfg;
+    uint8_t     n;
+    uint8_t     i;
+
+    if ((boot == 0) || (boot->Num == 0)) {
+        return;
+    }
+    boot->Sent = 0;
+
+    for (n = 0; n < boot->Num; n++) {
+        cfg = &boot->Cfg[n];
+        if ((cfg->State == CO_NMT_CFG_BUSY) && (cfg->Req == 0) &&
+            ((int32_t)(boot->Mst->Tick - cfg->Due) >= 0)) {
+            CONmtBootAbort(boot, cfg, CO_NMT_BOOT_ABORT_TIMEOUT);
+            CONmtBootFinish(boot, cfg, CO_NMT_BOOT_ABORT_TIMEOUT);
+        }
+    }
+
+    i = boot->Next;
+    for (n = 0; n < boot->Num; n++) {
+        cfg = &boot->Cfg[i];
+        if ((cfg->State == CO_NMT_CFG_WAIT) && (boot->Busy < boot->Par) &&
+            (CONmtMstGetMode(boot->Mst, cfg->NodeId) == CO_PREOP)) {
+            cfg->State = CO_NMT_CFG_BUSY;
+            cfg->Step  = CO_NMT_BOOT_INIT;
+            cfg->Pos   = 0;
+            cfg->Seg   = 0;
+            cfg->Num   = 0;
+            cfg->Abort = 0;
+            cfg->Start = boot->Mst->Tick;
+            boot->Busy++;
+            CONmtBootNext(boot, cfg);
+        } else if ((cfg->State == CO_NMT_CFG_BUSY) && (cfg->Req != 0) &&
+                   (boot->Sent < boot->Budget)) {
+            CONmtBootSend(boot, cfg);
+        }
+        i++;
+        if (i >= boot->Num) {
+            i = 0;
+        }
+    }
+    boot->Next = (uint8_t)((boot->Next + 1u) % boot->Num);
+}
@@ -0,0 +1,438 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_nmt_mst.h"
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_NMT_MST_CS_START     1u    /*!< command: start remote node        */
+#define CO_NMT_MST_CS_STOP      2u    /*!< command: stop remote node         */
+#define CO_NMT_MST_CS_PREOP   128u    /*!< command: enter pre-operational    */
+#define CO_NMT_MST_CS_RESET   129u    /*!< command: reset node               */
+#define CO_NMT_MST_CS_COM     130u    /*!< command: reset communication      */
+
+/******************************************************************************
+* PRIVATE MACROS
+******************************************************************************/
+
+/*! \brief SLAVE MONITOR TICKS
+*
+*    This macro calculates the monitor ticks for a given heartbeat time in
+*    ms. The monitor needs at least a single tick.
+*/
+#define CO_NMT_MST_TICKS(ms)  ((CO_TMR_TICKS(ms) > 0) ? CO_TMR_TICKS(ms) : 1)
+
+/*! \brief SLAVE MONITOR IDLE DEADLINE
+*
+*    This macro calculates the deadline, which is used when no slave is
+*    monitored. The deadline is the farthest future tick.
+*/
+#define CO_NMT_MST_IDLE(t)    ((uint32_t)(t) + 0x7FFFFFFFu)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  GET NMT COMMAND FOR STATE
+*
+*    This function returns the NMT command specifier, which requests the
+*    given state.
+*
+* \param mode
+*    requested state
+*
+* \return  NMT command specifier, or 0 if the state can't be requested
+*/
+static uint8_t CONmtMstCmd(CO_MODE mode)
+{
+    uint8_t result = 0;
+
+    if (mode == CO_OPERATIONAL) {
+        result = CO_NMT_MST_CS_START;
+    } else if (mode == CO_STOP) {
+        result = CO_NMT_MST_CS_STOP;
+    } else if (mode == CO_PREOP) {
+        result = CO_NMT_MST_CS_PREOP;
+    }
+    return (result);
+}
+
+/*! \brief  GET SLAVE
+*
+*    This function returns the slave assignment of the given Node-ID.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \return  reference to slave assignment, or 0 if not in slave table
+*/
+static CO_NMT_SLAVE *CONmtMstSlave(CO_NMT_MST *mst, uint8_t nodeId)
+{
+    CO_NMT_SLAVE *result = 0;
+
+    if ((nodeId > 0) && (nodeId < CO_HBCONS_NODE_N)) {
+        if (mst->Idx[nodeId] != 0) {
+            result = &mst->Slave[mst->Idx[nodeId] - 1];
+        }
+    }
+    return (result);
+}
+
+/*! \brief  REPORT SLAVE EVENT
+*
+*    This function calls the event callback function of the NMT master, if
+*    configured.
+*
+* \param mst
+*    reference to NMT master structure
+*
+* \param nodeId
+*    Node-ID of the slave
+*
+* \param event
+*    slave event
+*/
+static void CONmtMstEvent(CO_NMT_MST *mst, uint8_t nodeId, CO_NMT_MST_EVENT event)
+{
+    if (mst->Func != 0) {
+        mst->Func(mst, nodeId, event);
+    }
+}
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CONmtMstInit(CO_NMT_MST       *mst,
+                     struct CO_NODE_T *node,
+                     CO_NMT_SLAVE     *slave,
+                     uint8_t           num,
+                     CO_NMT_MST_FUNC   func)
+{
+    uint8_t id;
+    uint8_t n;
+
+    if ((mst == 0) || (node == 0) || ((slave == 0) && (num > 0))) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((node->Nmt.Mst == mst) && (mst->Tmr >= 0)) {
+        (void)COTmrDelete(&node->Tmr, mst->Tmr);
+    }
+    node->Nmt.Mst = 0;
+    mst->Node     = node;
+    mst->Slave    = slave;
+    mst->Boot     = 0;
+    mst->Func     = func;
+    mst->Num      = 0;
+    mst->Tmr      = -1;
+    mst->Tick     = 0;
+    mst->Due      = CO_NMT_MST_IDLE(0);
+    for (id = 0; id < CO_HBCONS_NODE_N; id++) {
+        mst->Idx[id] = 0;
+    }
+    for (n = 0; n < num; n++) {
+        id = slave[n].NodeId;
+        if ((id == 0) || (id >= CO_HBCONS_NODE_N) || (mst->Idx[id] != 0)) {
+            node->Error = CO_ERR_BAD_ARG;
+            return (CO_ERR_BAD_ARG);
+        }
+        mst->Idx[id]    = n + 1;
+        slave[n].State  = CO_INVALID;
+        slave[n].Target = CO_PREOP;
+        slave[n].Due    = 0;
+        slave[n].Lost   = 0;
+    }
+    mst->Num = num;
+
+    mst->Tmr = COTmrCreate(&node->Tmr, 1, 1, CONmtMstMonitor, mst);
+    if (mst->Tmr < 0) {
+        node->Error = CO_ERR_TMR_CREATE;
+        return (CO_ERR_TMR_CREATE);
+    }
+    node->Nmt.Mst = mst;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstBoot(CO_NMT_MST *mst)
+{
+    uint8_t n;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    for (n = 0; n < mst->Num; n++) {
+        mst->Slave[n].Target = CO_PREOP;
+    }
+    return (CONmtMstReset(mst, 0, CO_RESET_COM));
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstSetMode(CO_NMT_MST *mst, CO_MODE mode)
+{
+    CO_NMT_SLAVE *slave;
+    uint8_t       cmd;
+    uint8_t       num;
+    uint8_t       id;
+    uint8_t       n;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    cmd = CONmtMstCmd(mode);
+    if (cmd == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    num = 0;
+    id  = 0;
+    for (n = 0; n < mst->Num; n++) {
+        slave         = &mst->Slave[n];
+        slave->Target = mode;
+        if (slave->State != mode) {
+            id = slave->NodeId;
+            num++;
+        }
+    }
+    if (num == 0) {
+        return (CO_ERR_NONE);
+    }
+    if (num > 1) {
+        id = 0;
+    }
+    return (CONmtMstSend(mst, cmd, id));
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstSetNodeMode(CO_NMT_MST *mst, uint8_t nodeId, CO_MODE mode)
+{
+    CO_NMT_SLAVE *slave;
+    uint8_t       cmd;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    cmd   = CONmtMstCmd(mode);
+    slave = CONmtMstSlave(mst, nodeId);
+    if ((cmd == 0) || (slave == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    slave->Target = mode;
+    return (CONmtMstSend(mst, cmd, nodeId));
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstReset(CO_NMT_MST *mst, uint8_t nodeId, CO_NMT_RESET type)
+{
+    CO_NMT_SLAVE *slave;
+    uint8_t       cmd;
+    uint8_t       n;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if (type == CO_RESET_NODE) {
+        cmd = CO_NMT_MST_CS_RESET;
+    } else if (type == CO_RESET_COM) {
+        cmd = CO_NMT_MST_CS_COM;
+    } else {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    if (nodeId == 0) {
+        for (n = 0; n < mst->Num; n++) {
+            mst->Slave[n].State = CO_INVALID;
+        }
+    } else {
+        slave = CONmtMstSlave(mst, nodeId);
+        if (slave == 0) {
+            return (CO_ERR_BAD_ARG);
+        }
+        slave->State = CO_INVALID;
+    }
+    return (CONmtMstSend(mst, cmd, nodeId));
+}
+
+/*
+* see function definition
+*/
+CO_MODE CONmtMstGetMode(CO_NMT_MST *mst, uint8_t nodeId)
+{
+    CO_NMT_SLAVE *slave;
+    CO_MODE       result = CO_INVALID;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    slave = CONmtMstSlave(mst, nodeId);
+    if (slave != 0) {
+        result = slave->State;
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+uint8_t CONmtMstPending(CO_NMT_MST *mst, uint8_t mandatory)
+{
+    CO_NMT_SLAVE *slave;
+    uint8_t       result = 0;
+    uint8_t       n;
+
+    if (mst == 0) {
+        CONodeFatalError();
+        return (result);
+    }
+    for (n = 0; n < mst->Num; n++) {
+        slave = &mst->Slave[n];
+        if ((mandatory != 0) &&
+            ((slave->Flags & CO_NMT_MST_MANDATORY) == 0)) {
+            continue;
+        }
+        if (slave->State != slave->Target) {
+            result++;
+        }
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstSend(CO_NMT_MST *mst, uint8_t cmd, uint8_t nodeId)
+{
+    CO_IF_FRM frm;
+
+    frm.Identifier = 0;
+    frm.DLC        = 2;
+    frm.Data[0]    = cmd;
+    frm.Data[1]    = nodeId;
+    if (COIfSend(&mst->Node->If, &frm) < 0) {
+        return (CO_ERR_IF_SEND);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t CONmtMstCheck(CO_NMT_MST *mst, CO_IF_FRM *frm)
+{
+    CO_NMT_SLAVE *slave;
+    CO_MODE       state;
+    uint32_t      cobid;
+    uint8_t       nodeid;
+
+    if (mst == 0) {
+        return (-1);
+    }
+    cobid = frm->Identifier;
+    if ((cobid < 1792) || (cobid > 1792 + 127) || (frm->DLC < 1)) {
+        return (-1);
+    }
+    nodeid = (uint8_t)(cobid - 1792);
+    slave  = CONmtMstSlave(mst, nodeid);
+    if (slave == 0) {
+        return (-1);
+    }
+
+    if (slave->Time > 0) {
+        slave->Due = mst->Tick + CO_NMT_MST_TICKS(slave->Time);
+        if ((int32_t)(slave->Due - mst->Due) < 0) {
+            mst->Due = slave->Due;
+        }
+    }
+    state = CONmtModeDecode(frm->Data[0] & 0x7Fu);
+    if (state == CO_INIT) {
+        slave->State = CO_PREOP;
+        CONmtMstEvent(mst, nodeid, CO_NMT_MST_BOOTUP);
+        if (CONmtBootRestart(mst->Boot, nodeid) != 0) {
+            /* slave is started after configuration */
+        } else if (((slave->Flags & CO_NMT_MST_START) != 0) &&
+                   (slave->Target == CO_OPERATIONAL)) {
+            (void)CONmtMstSend(mst, CO_NMT_MST_CS_START, nodeid);
+        }
+    } else if (slave->State != state) {
+        slave->State = state;
+        CONmtMstEvent(mst, nodeid, CO_NMT_MST_STATE);
+    }
+    return ((int16_t)nodeid);
+}
+
+/*
+* see function definition
+*/
+void CONmtMstMonitor(void *parg)
+{
+    CO_NMT_MST   *mst;
+    CO_NMT_SLAVE *slave;
+    uint32_t      due;
+    uint8_t       n;
+
+    mst = (CO_NMT_MST *)parg;
+    mst->Tick++;
+    CONmtBootProcess(mst->Boot);
+    if ((int32_t)(mst->Tick - mst->Due) < 0) {
+        return;
+    }
+
+    due = CO_NMT_MST_IDLE(mst->Tick);
+    for (n = 0; n < mst->Num; n++) {
+        slave = &mst->Slave[n];
+        if ((slave->Time == 0) || (slave->State == CO_INVALID)) {
+            continue;
+        }
+        if ((int32_t)(mst->Tick - slave->Due) >= 0) {
+            slave->State = CO_INVALID;
+            if (slave->Lost < 0xFFu) {
+                slave->Lost++;
+            }
+            CONmtMstEvent(mst, slave->NodeId, CO_NMT_MST_LOST);
+        } else if ((int32_t)(slave->Due - due) < 0) {
+            due = slave->Due;
+        }
+    }
+    mst->Due = due;
+}
@@ -26,6 +26,7 @@
 
 const CO_OBJ_TYPE COTString = { COTypeStringSize, COTypeStringCtrl, COTypeStringRead, 0 };
 const CO_OBJ_TYPE COTDomain = { COTypeDomainSize, COTypeDomainCtrl, COTypeDomainRead, COTypeDomainWrite };
+const CO_OBJ_TYPE COTStream = { COTypeStreamSize, COTypeStreamCtrl, COTypeStreamRead, COTypeStreamWrite };
 
 /******************************************************************************
 * FUNCTIONS
@@ -62,26 +63,40 @@ uint32_t COObjGetSize(CO_OBJ *obj, CO_NODE *node, uint32_t width)
 int16_t COObjRdValue(CO_OBJ *obj, struct CO_NODE_T *node, void *value, uint8_t width, uint8_t nodeid)
 {
     CO_OBJ_TYPE *type;
-    int16_t      err = 0;
-    uint32_t     val = 0;
+    int16_t      err   = 0;
+    uint32_t     val   = 0;
+    uint64_t     val64 = 0;
 
     if ((obj == 0) || (value == 0)) {
         return (CO_ERR_BAD_ARG);
     }
     type = obj->Type;
-    if (type != 0) {
-        err = COObjRdType(obj, node, (void *)&val, CO_LONG, 0);
+    if (CO_GET_SIZE(obj->Key) == CO_QUAD) {
+        if (type != 0) {
+            err = COObjRdType(obj, node, (void *)&val64, CO_QUAD, 0);
+        } else {
+            err = COObjRdDirect(obj, node, (void *)&val64, CO_QUAD);
+        }
         if (err != CO_ERR_NONE) {
             return(err);
         }
+        if (CO_IS_NODEID(obj->Key) != 0) {
+            val64 = (val64 + nodeid);
+        }
+        val = (uint32_t)val64;
     } else {
-        err = COObjRdDirect(obj, (void *)&val, CO_LONG);
+        if (type != 0) {
+            err = COObjRdType(obj, node, (void *)&val, CO_LONG, 0);
+        } else {
+            err = COObjRdDirect(obj, node, (void *)&val, CO_LONG);
+        }
         if (err != CO_ERR_NONE) {
             return(err);
         }
-    }
-    if (CO_IS_NODEID(obj->Key) != 0) {
-        val = (val + nodeid);
+        if (CO_IS_NODEID(obj->Key) != 0) {
+            val = (val + nodeid);
+        }
+        val64 = (uint64_t)val;
     }
     if (width == 1) {
         *((uint8_t *)value) = (uint8_t)val;
@@ -89,6 +104,8 @@ int16_t COObjRdValue(CO_OBJ *obj, struct CO_NODE_T *node, void *value, uint8_t w
         *((uint16_t *)value) = (uint16_t)val;
     } else if (width == 4) {
         *((uint32_t *)value) = (uint32_t)val;
+    } else if (width == 8) {
+        *((uint64_t *)value) = val64;
     }
 
     return(CO_ERR_NONE);
@@ -101,33 +118,63 @@ int16_t COObjWrValue(CO_OBJ *obj, struct CO_NODE_T *node, void *value, uint8_t w
 {
     CO_OBJ_TYPE *type;
     uint32_t     val    = 0;
+    uint64_t     val64  = 0;
+    void        *src;
+    uint32_t     len;
     int16_t      result = CO_ERR_NONE;
     int16_t      status = 0;
 
     if ((obj == 0) || (value == 0)) {
         return (CO_ERR_BAD_ARG);
     }
-    if (width == 1) {
-        val = *((uint8_t *)value) & 0xFF;
-    } else if (width == 2) {
-        val = *((uint16_t *)value) & 0xFFFF;
-    } else if (width == 4) {
-        val = *((uint32_t *)value);
+    if (CO_GET_SIZE(obj->Key) == CO_QUAD) {
+        if (width == 1) {
+            val64 = *((uint8_t *)value) & 0xFF;
+        } else if (width == 2) {
+            val64 = *((uint16_t *)value) & 0xFFFF;
+        } else if (width == 4) {
+            val64 = *((uint32_t *)value);
+        } else if (width == 8) {
+            val64 = *((uint64_t *)value);
+        } else {
+            return (CO_ERR_BAD_ARG);
+        }
+        if (CO_IS_NODEID(obj->Key) != 0) {
+            val64 = (val64 - nodeid);
+        }
+        src = (void *)&val64;
+        len = CO_QUAD;
     } else {
-        return (CO_ERR_BAD_ARG);
-    }
-    if (CO_IS_NODEID(obj->Key) != 0) {
-        val = (val - nodeid);
+        if (width == 1) {
+            val = *((uint8_t *)value) & 0xFF;
+        } else if (width == 2) {
+            val = *((uint16_t *)value) & 0xFFFF;
+        } else if (width == 4) {
+            val = *((uint32_t *)value);
+        } else if (width == 8) {
+            val = (uint32_t)(*((uint64_t *)value));
+        } else {
+            return (CO_ERR_BAD_ARG);
+        }
+        if (CO_IS_NODEID(obj->Key) != 0) {
+            val = (val - nodeid);
+        }
+        src = (void *)&val;
+        len = CO_LONG;
     }
 
-    if (CO_IS_PDOMAP(obj->Key) != 0) {
-        status = COObjCmp(obj, (void *)&val);
+    if ((CO_IS_PDOMAP(obj->Key) != 0) ||
+        ((node != 0) && (node->Dict.Sub != 0))) {
+        status = COObjCmp(obj, node, src);
     }
     type = obj->Type;
     if (type != 0) {
-        result = COObjWrType(obj, node, (void *)&val, CO_LONG, 0);
+        result = COObjWrType(obj, node, src, len, 0);
     } else {
-        result = COObjWrDirect(obj, (void *)&val, CO_LONG);
+        result = COObjWrDirect(obj, node, src, len);
+    }
+    if ((result == CO_ERR_NONE) && (node != 0)) {
+        COParaObjChanged(obj, node);
     }
 
     if (status != 0) {
@@ -135,6 +182,9 @@ int16_t COObjWrValue(CO_OBJ *obj, struct CO_NODE_T *node, void *value, uint8_t w
         if (type == CO_TASYNC) {
             (void)obj->Type->Ctrl(obj, node, CO_TPDO_ASYNC, 0);
         }
+        if ((result == CO_ERR_NONE) && (node != 0) && (node->Dict.Sub != 0)) {
+            CODictSubNotify(&node->Dict, obj);
+        }
     }
 
     return (result);
@@ -197,6 +247,9 @@ int16_t COObjWrBufStart(CO_OBJ *obj, struct CO_NODE_T *node, uint8_t *buffer, ui
     if (type != 0) {
         result = COObjWrType(obj, node, (void *)buffer, len, 0);
     }
+    if ((result == CO_ERR_NONE) && (node != 0)) {
+        COParaObjChanged(obj, node);
+    }
 
     return (result);
 }
@@ -219,6 +272,9 @@ int16_t COObjWrBufCont(CO_OBJ *obj, struct CO_NODE_T *node, uint8_t *buffer, uin
             result = type->Write(obj, node, buffer, len);
         }
     }
+    if ((result == CO_ERR_NONE) && (node != 0)) {
+        COParaObjChanged(obj, node);
+    }
 
     return (result);
 }
@@ -239,22 +295,44 @@ void COObjInit (CO_OBJ *obj)
 /*
 * see function definition
 */
-int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len)
+uintptr_t *COObjDirectRef(CO_OBJ *obj, struct CO_NODE_T *node)
+{
+    CO_DICT *cod;
+
+    if (node != 0) {
+        cod = &node->Dict;
+        if ((cod->Val != 0) &&
+            (obj >= cod->Root) && (obj < &cod->Root[cod->Num])) {
+            return (&cod->Val[obj - cod->Root]);
+        }
+    }
+
+    return (&obj->Data);
+}
+
+/*
+* see function definition
+*/
+int16_t COObjRdDirect(CO_OBJ *obj, struct CO_NODE_T *node, void *val, uint32_t len)
 {
-    uint8_t sz;
-    int16_t result = CO_ERR_NONE;
+    uintptr_t *data;
+    uint8_t    sz;
+    int16_t    result = CO_ERR_NONE;
 
     if ((obj == 0) || (val == 0)) {
         return (CO_ERR_BAD_ARG);
     }
 
     if (CO_IS_DIRECT(obj->Key) != 0) {
+        data = COObjDirectRef(obj, node);
         if (len == CO_BYTE) {
-            *((uint8_t *)val) = (uint8_t)((obj->Data)&0xff);
+            *((uint8_t *)val) = (uint8_t)((*data)&0xff);
         } else if (len == CO_WORD) {
-            *((uint16_t *)val) = (uint16_t)((obj->Data)&0xffff);
+            *((uint16_t *)val) = (uint16_t)((*data)&0xffff);
         } else if (len == CO_LONG) {
-            *((uint32_t *)val) = (uint32_t)(obj->Data);
+            *((uint32_t *)val) = (uint32_t)(*data);
+        } else if (len == CO_QUAD) {
+            *((uint64_t *)val) = (uint64_t)(*data);
         } else {
             result = CO_ERR_BAD_ARG;
         }
@@ -262,6 +340,8 @@ int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len)
         sz = CO_GET_SIZE(obj->Key);
         if (obj->Data == 0) {
             result = CO_ERR_OBJ_ACC;
+        } else if ((len == CO_QUAD) || (sz == CO_QUAD)) {
+            result = COObjRdDirectQuad(obj, val, len);
         } else if (len == CO_BYTE) {
             if (sz == CO_BYTE) {
                 *((uint8_t *)val) = (uint8_t)(*((uint8_t*)(obj->Data))&0xff);
@@ -301,15 +381,45 @@ int16_t COObjRdDirect(CO_OBJ *obj, void *val, uint32_t len)
 /*
 * see function definition
 */
-int16_t COObjCmp(CO_OBJ *obj, void *val)
+int16_t COObjCmp(CO_OBJ *obj, struct CO_NODE_T *node, void *val)
 {
-    uint32_t newval = 0;
-    uint32_t oldval = 0;
-    int16_t  result = 0;
-    int16_t  err;
+    CO_OBJ_TYPE *type;
+    uint64_t     newval64;
+    uint64_t     oldval64 = 0;
+    uint32_t     newval   = 0;
+    uint32_t     oldval   = 0;
+    int16_t      result   = 0;
+    int16_t      err;
+
+    type = obj->Type;
+    if (type == CO_TSTREAM) {
+        /* reading a stream is not free of side effects */
+        return (1);
+    }
+    if (CO_GET_SIZE(obj->Key) == CO_QUAD) {
+        newval64 = *((uint64_t *)val);
+        if (type != 0) {
+            err = COObjRdType(obj, node, &oldval64, CO_QUAD, 0);
+        } else {
+            err = COObjRdDirect(obj, node, &oldval64, CO_QUAD);
+        }
+        if (err != CO_ERR_NONE) {
+            return (err);
+        }
+        if (newval64 < oldval64) {
+            result = -1;
+        } else if (newval64 > oldval64) {
+            result = 1;
+        }
+        return (result);
+    }
 
     newval = *((uint32_t *)val);
-    err    = COObjRdDirect(obj, &oldval, CO_LONG);
+    if (type != 0) {
+        err = COObjRdType(obj, node, &oldval, CO_LONG, 0);
+    } else {
+        err = COObjRdDirect(obj, node, &oldval, CO_LONG);
+    }
     if (err != CO_ERR_NONE) {
         return (err);
     }
@@ -342,7 +452,7 @@ int16_t COObjRdType(CO_OBJ *obj, struct CO_NODE_T *node, void *dst, uint32_t len
             }
             result = type->Read(obj, node, dst, len);
         } else {
-            result = COObjRdDirect(obj, (void *)dst, len);
+            result = COObjRdDirect(obj, node, (void *)dst, len);
         }
     }
 
@@ -352,22 +462,31 @@ int16_t COObjRdType(CO_OBJ *obj, struct CO_NODE_T *node, void *dst, uint32_t len
 /*
 * see function definition
 */
-int16_t COObjWrDirect(CO_OBJ *obj, void *val, uint32_t len)
+int16_t COObjWrDirect(CO_OBJ *obj, struct CO_NODE_T *node, void *val, uint32_t len)
 {
-    uint8_t sz;
-    int16_t result = CO_ERR_NONE;
+    uintptr_t *data;
+    uint8_t    sz;
+    int16_t    result = CO_ERR_NONE;
 
     if ((obj == 0) || (val == 0)) {
         return (CO_ERR_BAD_ARG);
     }
 
     if (CO_IS_DIRECT(obj->Key) != 0) {
+        data = COObjDirectRef(obj, node);
         if (len == CO_BYTE) {
-            obj->Data = (uint32_t)(*((uint8_t*)val)&0xff);
+            *data = (uint32_t)(*((uint8_t*)val)&0xff);
         } else if (len == CO_WORD) {
-            obj->Data = (uint32_t)(*((uint16_t*)val)&0xffff);
+            *data = (uint32_t)(*((uint16_t*)val)&0xffff);
         } else if (len == CO_LONG) {
-            obj->Data = (uint32_t)(*((uint32_t *)val));
+            *data = (uint32_t)(*((uint32_t *)val));
+        } else if (len == CO_QUAD) {
+            if ((uint64_t)((uintptr_t)(*((uint64_t *)val))) != *((uint64_t *)val)) {
+                /* value exceeds the data member of this platform */
+                result = CO_ERR_OBJ_RANGE;
+            } else {
+                *data = (uintptr_t)(*((uint64_t *)val));
+            }
         } else {
             result = CO_ERR_BAD_ARG;
         }
@@ -375,6 +494,8 @@ int16_t COObjWrDirect(CO_OBJ *obj, void *val, uint32_t len)
         sz = CO_GET_SIZE(obj->Key);
         if (obj->Data == 0) {
             result = CO_ERR_OBJ_ACC;
+        } else if ((len == CO_QUAD) || (sz == CO_QUAD)) {
+            result = COObjWrDirectQuad(obj, val, len);
         } else if (sz == CO_BYTE) {
             if (len == CO_BYTE) {
                 *((uint8_t *)(obj->Data)) = (uint8_t)(*((uint8_t*)(val))&0xff);
@@ -411,6 +532,74 @@ int16_t COObjWrDirect(CO_OBJ *obj, void *val, uint32_t len)
     return (result);
 }
 
+/*
+* see function definition
+*/
+int16_t COObjRdDirectQuad(CO_OBJ *obj, void *val, uint32_t len)
+{
+    uint64_t data;
+    uint8_t  sz;
+    int16_t  result = CO_ERR_NONE;
+
+    sz = CO_GET_SIZE(obj->Key);
+    if (sz == CO_BYTE) {
+        data = (uint64_t)(*((uint8_t *)(obj->Data)));
+    } else if (sz == CO_WORD) {
+        data = (uint64_t)(*((uint16_t *)(obj->Data)));
+    } else if (sz == CO_LONG) {
+        data = (uint64_t)(*((uint32_t *)(obj->Data)));
+    } else {
+        data = *((uint64_t *)(obj->Data));
+    }
+    if (len == CO_BYTE) {
+        *((uint8_t *)val) = (uint8_t)(data & 0xff);
+    } else if (len == CO_WORD) {
+        *((uint16_t *)val) = (uint16_t)(data & 0xffff);
+    } else if (len == CO_LONG) {
+        *((uint32_t *)val) = (uint32_t)(data);
+    } else if (len == CO_QUAD) {
+        *((uint64_t *)val) = data;
+    } else {
+        result = CO_ERR_BAD_ARG;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COObjWrDirectQuad(CO_OBJ *obj, void *val, uint32_t len)
+{
+    uint64_t data;
+    uint8_t  sz;
+    int16_t  result = CO_ERR_NONE;
+
+    if (len == CO_BYTE) {
+        data = (uint64_t)(*((uint8_t *)val));
+    } else if (len == CO_WORD) {
+        data = (uint64_t)(*((uint16_t *)val));
+    } else if (len == CO_LONG) {
+        data = (uint64_t)(*((uint32_t *)val));
+    } else if (len == CO_QUAD) {
+        data = *((uint64_t *)val);
+    } else {
+        return (CO_ERR_BAD_ARG);
+    }
+    sz = CO_GET_SIZE(obj->Key);
+    if (sz == CO_BYTE) {
+        *((uint8_t *)(obj->Data)) = (uint8_t)(data & 0xff);
+    } else if (sz == CO_WORD) {
+        *((uint16_t *)(obj->Data)) = (uint16_t)(data & 0xffff);
+    } else if (sz == CO_LONG) {
+        *((uint32_t *)(obj->Data)) = (uint32_t)(data);
+    } else {
+        *((uint64_t *)(obj->Data)) = data;
+    }
+
+    return (result);
+}
+
 /*
 * see function definition
 */
@@ -430,7 +619,7 @@ int16_t COObjWrType(CO_OBJ *obj, CO_NODE *node, void *src, uint32_t len, uint32_
             }
             result = type->Write(obj, node, src, len);
         } else {
-            result = COObjWrDirect(obj, (void *)src, len);
+            result = COObjWrDirect(obj, node, (void *)src, len);
         }
     }
 
@@ -592,3 +781,110 @@ int16_t COTypeDomainWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32
 
     return (result);
 }
+
+/*
+* see function definition
+*/
+uint32_t COTypeStreamSize(CO_OBJ *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    CO_OBJ_STREAM *stream;
+    uint32_t       result = 0;
+
+    (void)node;
+    if (obj->Data == 0) {
+        return (result);
+    }
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if ((width > 0) && (width < stream->Size)) {
+        result = width;
+    } else {
+        result = stream->Size;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COTypeStreamCtrl(CO_OBJ *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para)
+{
+    CO_OBJ_STREAM *stream;
+    int16_t        result = CO_ERR_TYPE_CTRL;
+
+    (void)node;
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if (stream == 0) {
+        return (CO_ERR_TYPE_CTRL);
+    }
+    if (func == CO_CTRL_SET_OFF) {
+        stream->Offset = para;
+        result = CO_ERR_NONE;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COTypeStreamRead(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len)
+{
+    CO_OBJ_STREAM *stream;
+    int16_t        result = CO_ERR_NONE;
+    uint32_t       num;
+
+    (void)node;
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if (stream == 0) {
+        return (CO_ERR_TYPE_RD);
+    }
+    if (stream->Read == 0) {
+        return (CO_ERR_TYPE_RD);
+    }
+    num = stream->Size - stream->Offset;
+    if (len < num) {
+        num = len;
+    }
+    if (num > 0) {
+        result = stream->Read(stream->Context, stream->Offset, (uint8_t *)buf, num);
+        if (result != CO_ERR_NONE) {
+            return (CO_ERR_TYPE_RD);
+        }
+        stream->Offset += num;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COTypeStreamWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t len)
+{
+    CO_OBJ_STREAM *stream;
+    int16_t        result = CO_ERR_NONE;
+    uint32_t       num;
+
+    (void)node;
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if (stream == 0) {
+        return (CO_ERR_TYPE_WR);
+    }
+    if (stream->Write == 0) {
+        return (CO_ERR_TYPE_WR);
+    }
+    num = stream->Size - stream->Offset;
+    if (len < num) {
+        num = len;
+    }
+    if (num > 0) {
+        result = stream->Write(stream->Context, stream->Offset, (uint8_t *)buf, num);
+        if (result != CO_ERR_NONE) {
+            return (CO_ERR_TYPE_WR);
+        }
+        stream->Offset += num;
+    }
+
+    return (result);
+}
@@ -27,12 +27,286 @@
 #define CO_PARA_STORE_SIG    0x65766173     /*!< store parameter signature   */
 #define CO_PARA_RESTORE_SIG  0x64616F6c     /*!< restore parameter signature */
 
+#ifdef CO_BARRIER
+#define CO_PARA_BARRIER()    CO_BARRIER()   /*!< order task data and state   */
+#else
+#define CO_PARA_BARRIER()                   /*!< no barrier for toolchain    */
+#endif
+
 /******************************************************************************
 * GLOBAL CONSTANTS
 ******************************************************************************/
 
 const CO_OBJ_TYPE COTPara = { 0, 0, COTypeParaRead, COTypeParaWrite };
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief FIND CHANGE STATE
+*
+*    This function searches the change state of a tracked parameter group.
+*    The change states are kept in the object dictionary for the first
+*    CO_PARA_TRACK_N parameter groups of the object entry 0x1010.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    Ptr to node info
+*
+* \return
+*    Ptr to change state, or 0 for a parameter group without tracking
+*/
+static CO_DICT_PARA *COParaState(CO_PARA *pg, struct CO_NODE_T *node)
+{
+#if CO_PARA_TRACK_N > 0
+    CO_DICT *cod;
+    uint8_t  n;
+
+    if ((pg == 0) || (node == 0)) {
+        return ((CO_DICT_PARA *)0);
+    }
+    cod = &node->Dict;
+    for (n = 0; (n < cod->ParaNum) && (n < CO_PARA_TRACK_N); n++) {
+        if ((CO_PARA *)cod->Para[n].Data == pg) {
+            return (&cod->ParaState[n]);
+        }
+    }
+#else
+    (void)pg;
+    (void)node;
+#endif
+    return ((CO_DICT_PARA *)0);
+}
+
+/*! \brief TAKE CHANGED RANGE
+*
+*    This function takes the changed range of a parameter group into the
+*    range of the following store and clears the changed range. The
+*    function is called within the node processing.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    Ptr to node info
+*/
+static void COParaSaveBegin(CO_PARA *pg, struct CO_NODE_T *node)
+{
+    CO_DICT_PARA *st;
+
+    st = COParaState(pg, node);
+    if (st == 0) {
+        return;
+    }
+    st->SaveStart  = st->DirtyStart;
+    st->SaveEnd    = st->DirtyEnd;
+    st->DirtyStart = 0;
+    st->DirtyEnd   = 0;
+}
+
+/*! \brief RETURN CHANGED RANGE
+*
+*    This function merges the range of a not stored parameter group back
+*    into the changed range. The function is called within the node
+*    processing.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    Ptr to node info
+*/
+static void COParaSaveEnd(CO_PARA *pg, struct CO_NODE_T *node)
+{
+    CO_DICT_PARA *st;
+
+    st = COParaState(pg, node);
+    if (st == 0) {
+        return;
+    }
+    if (st->SaveStart < st->SaveEnd) {
+        COParaChanged(pg, node, &pg->Start[st->SaveStart], st->SaveEnd - st->SaveStart);
+    }
+    st->SaveStart = 0;
+    st->SaveEnd   = 0;
+}
+
+/*! \brief SAVE PARAMETER GROUP
+*
+*    This function stores a parameter group by calling the user callback
+*    function \ref COParaSave(). A tracked parameter group is stored only,
+*    when the range taken with \ref COParaSaveBegin() in front of this
+*    function is not empty; a stored range is cleared.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param node
+*    Ptr to node info
+*
+* \retval  =CO_ERR_NONE          parameter group is stored or unchanged
+* \retval  =CO_ERR_PARA_STORE    error in user callback function
+*/
+static int16_t COParaSaveGroup(CO_PARA *pg, struct CO_NODE_T *node)
+{
+    CO_DICT_PARA *st;
+    int16_t       err;
+
+    if ((pg->Value & CO_PARA___E) == 0) {
+        return (CO_ERR_NONE);
+    }
+    st = COParaState(pg, node);
+    if (st != 0) {
+        st->Stored = 0;
+        if (st->SaveStart >= st->SaveEnd) {
+            return (CO_ERR_NONE);
+        }
+    }
+    err = COParaSave(pg);
+    if (err != CO_ERR_NONE) {
+        return (CO_ERR_PARA_STORE);
+    }
+    if (st != 0) {
+        st->Stored    = st->SaveEnd - st->SaveStart;
+        st->SaveStart = 0;
+        st->SaveEnd   = 0;
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief DEFAULT PARAMETER GROUP
+*
+*    This function restores the default values of a parameter group in NVM
+*    by calling the user callback function \ref COParaDefault().
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \retval  =CO_ERR_NONE            parameter group default is restored
+* \retval  =CO_ERR_PARA_RESTORE    error in user callback function
+*/
+static int16_t COParaDefaultGroup(CO_PARA *pg)
+{
+    int16_t err;
+
+    if ((pg->Value & CO_PARA___E) == 0) {
+        return (CO_ERR_NONE);
+    }
+    err = COParaDefault(pg);
+    if (err != CO_ERR_NONE) {
+        return (CO_ERR_PARA_RESTORE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief EXECUTE PARAMETER REQUEST
+*
+*    This function stores (0x1010) or restores (0x1011) the parameter groups
+*    of the given consecutive parameter object entries.
+*
+* \param obj
+*    Ptr to first parameter object entry
+*
+* \param num
+*    Number of parameter object entries
+*
+* \param node
+*    Ptr to node info
+*
+* \retval  =CO_ERR_NONE    all parameter groups are executed
+* \retval !=CO_ERR_NONE    error in a user callback function
+*/
+static int16_t COParaExec(CO_OBJ *obj, uint8_t num, struct CO_NODE_T *node)
+{
+    CO_PARA *pg;
+    int16_t  err;
+    int16_t  result = CO_ERR_NONE;
+
+    while (num > 0) {
+        pg = (CO_PARA *)obj->Data;
+        if (pg != 0) {
+            if (CO_GET_IDX(obj->Key) == 0x1011) {
+                err = COParaDefaultGroup(pg);
+            } else {
+                err = COParaSaveGroup(pg, node);
+            }
+            if (err != CO_ERR_NONE) {
+                result = err;
+            }
+        }
+        obj++;
+        num--;
+    }
+    return (result);
+}
+
+/*! \brief PREPARE PARAMETER REQUEST
+*
+*    This function takes the changed ranges of the parameter groups, which
+*    are stored (0x1010) with the following \ref COParaExec(). The
+*    function is called within the node processing.
+*
+* \param obj
+*    Ptr to first parameter object entry
+*
+* \param num
+*    Number of parameter object entries
+*
+* \param node
+*    Ptr to node info
+*/
+static void COParaExecBegin(CO_OBJ *obj, uint8_t num, struct CO_NODE_T *node)
+{
+    CO_PARA *pg;
+
+    while (num > 0) {
+        pg = (CO_PARA *)obj->Data;
+        if ((pg != 0) && (CO_GET_IDX(obj->Key) == 0x1010)) {
+            COParaSaveBegin(pg, node);
+        }
+        obj++;
+        num--;
+    }
+}
+
+/*! \brief FINISH PARAMETER REQUEST
+*
+*    This function updates the changed ranges of the parameter groups
+*    after \ref COParaExec(): the range of a not stored group (0x1010) is
+*    merged back, a group with restored defaults (0x1011) differs from NVM
+*    in the whole group. The function is called within the node processing.
+*
+* \param obj
+*    Ptr to first parameter object entry
+*
+* \param num
+*    Number of parameter object entries
+*
+* \param node
+*    Ptr to node info
+*/
+static void COParaExecEnd(CO_OBJ *obj, uint8_t num, struct CO_NODE_T *node)
+{
+    CO_PARA *pg;
+
+    while (num > 0) {
+        pg = (CO_PARA *)obj->Data;
+        if (pg != 0) {
+            if (CO_GET_IDX(obj->Key) == 0x1011) {
+                if ((pg->Value & CO_PARA___E) != 0) {
+                    COParaChanged(pg, node, pg->Start, pg->Size);
+                }
+            } else {
+                COParaSaveEnd(pg, node);
+            }
+        }
+        obj++;
+        num--;
+    }
+}
+
 /******************************************************************************
 * FUNCTIONS
 ******************************************************************************/
@@ -48,12 +322,12 @@ void COParaStore(CO_PARA *pg, CO_NODE *node)
     if ((pg == 0) || (node == 0)) {
         return;
     }
-    /* call save callback function */
-    if ((pg->Value & CO_PARA___E) != 0) {
-        err = COParaSave(pg);
-        if (err != CO_ERR_NONE) {
-            node->Error = CO_ERR_PARA_STORE;
-        }
+    /* call save callback function (tracked parameter groups: changed only) */
+    COParaSaveBegin(pg, node);
+    err = COParaSaveGroup(pg, node);
+    COParaSaveEnd(pg, node);
+    if (err != CO_ERR_NONE) {
+        node->Error = (CO_ERR)err;
     }
 }
 
@@ -70,11 +344,113 @@ void COParaRestore(CO_PARA *pg, CO_NODE *node)
     }
 
     /* call default callback function */
+    err = COParaDefaultGroup(pg);
     if ((pg->Value & CO_PARA___E) != 0) {
-        err = COParaDefault(pg);
-        if (err != CO_ERR_NONE) {
-            node->Error = CO_ERR_PARA_RESTORE;
+        /* NVM differs from the parameter memory in the whole group */
+        COParaChanged(pg, node, pg->Start, pg->Size);
+    }
+    if (err != CO_ERR_NONE) {
+        node->Error = (CO_ERR)err;
+    }
+}
+
+/*
+* see function definition
+*/
+void COParaChanged(CO_PARA *pg, struct CO_NODE_T *node, void *addr, uint32_t size)
+{
+    CO_DICT_PARA *st;
+    uint32_t      start;
+    uint32_t      end;
+
+    /* argument checks */
+    if ((pg == 0) || (pg->Start == 0) || (size == 0)) {
+        return;
+    }
+    st = COParaState(pg, node);
+    if (st == 0) {
+        return;
+    }
+    if (((uint8_t *)addr < pg->Start) ||
+        ((uint8_t *)addr >= &pg->Start[pg->Size])) {
+        return;
+    }
+
+    start = (uint32_t)((uint8_t *)addr - pg->Start);
+    end   = start + size;
+    if (end > pg->Size) {
+        end = pg->Size;
+    }
+    if (st->DirtyStart >= st->DirtyEnd) {
+        st->DirtyStart = start;
+        st->DirtyEnd   = end;
+    } else {
+        if (start < st->DirtyStart) {
+            st->DirtyStart = start;
+        }
+        if (end > st->DirtyEnd) {
+            st->DirtyEnd = end;
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+void COParaObjChanged(CO_OBJ *obj, struct CO_NODE_T *node)
+{
+    CO_DICT    *cod;
+    CO_OBJ     *pwo;
+    CO_OBJ_DOM *dom;
+    void       *addr;
+    uint32_t    size;
+    uint8_t     n;
+
+    cod = &node->Dict;
+    if ((CO_PARA_TRACK_N == 0) || (cod->ParaNum == 0) ||
+        (CO_IS_DIRECT(obj->Key) != 0)) {
+        return;
+    }
+    if (obj->Type == CO_TDOMAIN) {
+        /* the domain content is written in parts: take the whole domain */
+        dom = (CO_OBJ_DOM *)obj->Data;
+        if (dom == 0) {
+            return;
         }
+        addr = (void *)dom->Start;
+        size = dom->Size;
+    } else if ((obj->Type == CO_TSTREAM) || (obj->Type == CO_TSTRING)) {
+        /* stream content is not in memory, strings are read-only */
+        return;
+    } else {
+        addr = (void *)obj->Data;
+        size = CO_GET_SIZE(obj->Key);
+    }
+
+    /* the parameter objects are a contiguous range in the dictionary */
+    pwo = cod->Para;
+    for (n = 0; n < cod->ParaNum; n++) {
+        COParaChanged((CO_PARA *)pwo->Data, node, addr, size);
+        pwo++;
+    }
+}
+
+/*
+* see function definition
+*/
+void COParaLoaded(CO_PARA *pg, struct CO_NODE_T *node, int16_t err)
+{
+    CO_DICT_PARA *st;
+
+    st = COParaState(pg, node);
+    if (st == 0) {
+        return;
+    }
+    st->DirtyStart = 0;
+    st->DirtyEnd   = 0;
+    if (err != CO_ERR_NONE) {
+        /* parameter memory is not in NVM: store all values */
+        st->DirtyEnd = pg->Size;
     }
 }
 
@@ -178,45 +554,129 @@ int16_t COTypeParaRead(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_t
 */
 int16_t COTypeParaWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_t size)
 {
-    CO_DICT  *cod;
-    CO_OBJ  *pwo;
-    CO_PARA *pg;
-    int16_t  select;
-    uint16_t idx;
-    uint8_t  num;
-    uint8_t  sub;
+    CO_PARA_TASK *task;
+    CO_OBJ       *first;
+    int16_t       select;
+    uint16_t      idx;
+    uint8_t       num;
+    uint8_t       sub;
+    uint8_t       n;
     
     /* check parameter and configuration */
     select = COParaCheck(obj, node, buf, size);
     if (select != CO_ERR_NONE) {
         return (select);
     }
-    cod = &node->Dict;
     idx = CO_GET_IDX(obj->Key);
     sub = CO_GET_SUB(obj->Key);
-    (void)CODictRdByte(cod, CO_DEV(idx,0), &num);
+    (void)CODictRdByte(&node->Dict, CO_DEV(idx,0), &num);
 
-    /* all parameter groups */
+    /* all parameter groups: the following sorted object entries */
+    first = obj;
+    n     = 1;
     if ((sub == 1) && (num > 1)) {
-        for (sub = 2; sub < num; sub++) {
-            pwo = CODictFind(cod, CO_DEV(idx, sub));
-            if (pwo != 0) {
-                pg = (CO_PARA *)pwo->Data;
-                if (idx == 0x1011) {
-                    COParaRestore(pg, node);
-                } else {
-                    COParaStore(pg, node);
-                }
-            }
+        first++;
+        n = 0;
+        while ((CO_GET_IDX(first[n].Key) == idx) &&
+               (CO_GET_SUB(first[n].Key) <= num)) {
+            n++;
         }
-    } else {
-        /* save addressed para group */
-        pg = (CO_PARA *)obj->Data;
-        if (idx == 0x1011) {
-            COParaRestore(pg, node);
-        } else {
-            COParaStore(pg, node);
+    }
+
+    /* synchronous execution without parameter store task */
+    task = node->ParaTask;
+    if (task == 0) {
+        COParaExecBegin(first, n, node);
+        select = COParaExec(first, n, node);
+        COParaExecEnd(first, n, node);
+        if (select != CO_ERR_NONE) {
+            node->Error = (CO_ERR)select;
         }
+        return (CO_ERR_NONE);
+    }
+
+    /* enqueue request for the parameter store task */
+    if (task->State != CO_PARA_TASK_IDLE) {
+        return (CO_ERR_OBJ_ACC);
+    }
+    CO_PARA_BARRIER();
+    task->Srv    = node->SdoDefer;
+    task->Obj    = first;
+    task->Num    = n;
+    task->Idx    = idx;
+    task->Sub    = sub;
+    task->Result = CO_ERR_NONE;
+    COParaExecBegin(first, n, node);
+    CO_PARA_BARRIER();
+    task->State  = CO_PARA_TASK_PEND;
+    if (task->Srv != 0) {
+        return (CO_ERR_SDO_DEFER);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COParaTaskInit(CO_PARA_TASK *task, struct CO_NODE_T *node)
+{
+    if ((task == 0) || (node == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
     }
+    node->ParaTask = 0;
+    task->Node     = node;
+    task->Srv      = 0;
+    task->Obj      = 0;
+    task->Idx      = 0;
+    task->Sub      = 0;
+    task->Num      = 0;
+    task->Result   = CO_ERR_NONE;
+    task->State    = CO_PARA_TASK_IDLE;
+
+    node->ParaTask = task;
     return (CO_ERR_NONE);
 }
+
+/*
+* see function definition
+*/
+int16_t COParaTaskProcess(CO_PARA_TASK *task)
+{
+    if (task == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if (task->State != CO_PARA_TASK_PEND) {
+        return (0);
+    }
+    CO_PARA_BARRIER();
+    task->Result = COParaExec(task->Obj, task->Num, task->Node);
+    CO_PARA_BARRIER();
+    task->State  = CO_PARA_TASK_DONE;
+    return (1);
+}
+
+/*
+* see function definition
+*/
+void COParaTaskCheck(CO_PARA_TASK *task)
+{
+    uint32_t err = 0;
+
+    if ((task == 0) || (task->State != CO_PARA_TASK_DONE)) {
+        return;
+    }
+    CO_PARA_BARRIER();
+    COParaExecEnd(task->Obj, task->Num, task->Node);
+    if (task->Result != CO_ERR_NONE) {
+        task->Node->Error = (CO_ERR)task->Result;
+        err               = CO_SDO_ERR_TOS;
+    }
+    if (task->Srv != 0) {
+        COSdoDeferred(task->Srv, task->Idx, task->Sub, err);
+    }
+    task->Srv   = 0;
+    CO_PARA_BARRIER();
+    task->State = CO_PARA_TASK_IDLE;
+}
@@ -0,0 +1,901 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_para_log.h"
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_PARA_LOG_MAGIC    0x4C504F43u /*!< sector header signature 'COPL' */
+
+#define CO_PARA_LOG_DATA     0x01u    /*!< record: parameter group data      */
+#define CO_PARA_LOG_DEF      0x02u    /*!< record: restore default values    */
+#define CO_PARA_LOG_COMMIT   0x03u    /*!< record: snapshot is complete      */
+
+#define CO_PARA_LOG_NONE     0xFFu    /*!< no parameter group                */
+
+#define CO_PARA_LOG_END      0        /*!< no further record in sector       */
+#define CO_PARA_LOG_REC      1        /*!< valid record header               */
+#define CO_PARA_LOG_BAD      2        /*!< garbage in sector                 */
+
+#define CO_PARA_LOG_CHUNK    16u      /*!< size of local read buffers        */
+
+/*! \brief RECORD SIZE
+*
+*    The size of a record in flash memory with the given data length. The
+*    data is padded to the flash programming granularity.
+*/
+#define CO_PARA_LOG_SIZE(len) \
+    ((uint32_t)CO_PARA_LOG_HDR + (((uint32_t)(len) + (CO_PARA_LOG_ALIGN - 1u)) & \
+                                  ~((uint32_t)CO_PARA_LOG_ALIGN - 1u)))
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CRC-16 CALCULATION
+*
+*    This function continues the CRC-16 (CCITT polynom 0x1021) calculation
+*    with the given bytes.
+*
+* \param crc
+*    CRC of the previous bytes (0xFFFF for start)
+*
+* \param buf
+*    reference to bytes
+*
+* \param len
+*    number of bytes
+*
+* \return  CRC including the given bytes
+*/
+static uint16_t COParaLogCrc(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+    uint8_t bit;
+
+    while (len > 0) {
+        crc ^= (uint16_t)((uint16_t)*buf << 8);
+        for (bit = 0; bit < 8; bit++) {
+            if ((crc & 0x8000u) != 0) {
+                crc = (uint16_t)((crc << 1) ^ 0x1021u);
+            } else {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+        buf++;
+        len--;
+    }
+    return (crc);
+}
+
+/*! \brief  GET SECTOR ADDRESS
+*
+*    This function returns the flash address of the given sector of the log.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param k
+*    sector of the log (0 = oldest sector)
+*
+* \return  flash address of sector
+*/
+static uint32_t COParaLogAddr(CO_PARA_LOG *log, uint8_t k)
+{
+    uint8_t sec;
+
+    sec = (uint8_t)(((uint16_t)log->Base + k) % log->Drv->SecNum);
+    return ((uint32_t)sec * log->Drv->SecSize);
+}
+
+/*! \brief  FIND PARAMETER GROUP
+*
+*    This function returns the index of the given parameter group in the
+*    parameter group table.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param pg
+*    reference to parameter group
+*
+* \return  index of the parameter group, or CO_PARA_LOG_NONE
+*/
+static uint8_t COParaLogFind(CO_PARA_LOG *log, CO_PARA *pg)
+{
+    uint8_t g;
+
+    for (g = 0; g < log->Num; g++) {
+        if (log->Grp[g] == pg) {
+            return (g);
+        }
+    }
+    return (CO_PARA_LOG_NONE);
+}
+
+/*! \brief  READ RECORD HEADER
+*
+*    This function reads the record header at the given position of a
+*    sector and moves the position behind the record.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param addr
+*    flash address of sector
+*
+* \param pos
+*    reference to position in sector
+*
+* \param hdr
+*    reference to record header buffer
+*
+* \retval   =CO_PARA_LOG_REC    valid record header
+* \retval   =CO_PARA_LOG_END    erased flash memory at position
+* \retval   =CO_PARA_LOG_BAD    invalid record header at position
+* \retval   <0                  flash read error
+*/
+static int16_t COParaLogRdHdr(CO_PARA_LOG *log,
+                              uint32_t     addr,
+                              uint32_t    *pos,
+                              uint8_t     *hdr)
+{
+    uint16_t len;
+    uint16_t off;
+    uint8_t  n;
+
+    if (log->Drv->Read(addr + *pos, hdr, CO_PARA_LOG_HDR) < 0) {
+        return (-1);
+    }
+    for (n = 0; n < CO_PARA_LOG_HDR; n++) {
+        if (hdr[n] != 0xFFu) {
+            break;
+        }
+    }
+    if (n == CO_PARA_LOG_HDR) {
+        return (CO_PARA_LOG_END);
+    }
+
+    len = (uint16_t)hdr[0] | ((uint16_t)hdr[1] << 8);
+    off = (uint16_t)hdr[2] | ((uint16_t)hdr[3] << 8);
+    if ((*pos + CO_PARA_LOG_SIZE(len)) > log->Drv->SecSize) {
+        return (CO_PARA_LOG_BAD);
+    }
+    if (hdr[5] == CO_PARA_LOG_COMMIT) {
+        if ((hdr[4] != CO_PARA_LOG_NONE) || (len != 4)) {
+            return (CO_PARA_LOG_BAD);
+        }
+    } else if ((hdr[5] == CO_PARA_LOG_DATA) || (hdr[5] == CO_PARA_LOG_DEF)) {
+        if (hdr[4] >= log->Num) {
+            return (CO_PARA_LOG_BAD);
+        }
+        if (((uint32_t)off + len) > log->Grp[hdr[4]]->Size) {
+            return (CO_PARA_LOG_BAD);
+        }
+    } else {
+        return (CO_PARA_LOG_BAD);
+    }
+    *pos += CO_PARA_LOG_SIZE(len);
+    return (CO_PARA_LOG_REC);
+}
+
+/*! \brief  CHECK RECORD
+*
+*    This function checks the CRC of the record at the given flash address.
+*    A record with a bad CRC is the result of an interrupted programming.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param addr
+*    flash address of record
+*
+* \param hdr
+*    reference to record header
+*
+* \retval   =1    record is valid
+* \retval   =0    record is corrupted
+* \retval   <0    flash read error
+*/
+static int16_t COParaLogCheck(CO_PARA_LOG *log, uint32_t addr, uint8_t *hdr)
+{
+    uint8_t  buf[CO_PARA_LOG_CHUNK];
+    uint32_t len;
+    uint32_t num;
+    uint16_t crc;
+
+    crc  = COParaLogCrc(0xFFFFu, hdr, 6);
+    len  = (uint32_t)hdr[0] | ((uint32_t)hdr[1] << 8);
+    addr = addr + CO_PARA_LOG_HDR;
+    while (len > 0) {
+        num = (len > CO_PARA_LOG_CHUNK) ? CO_PARA_LOG_CHUNK : len;
+        if (log->Drv->Read(addr, buf, num) < 0) {
+            return (-1);
+        }
+        crc   = COParaLogCrc(crc, buf, num);
+        addr += num;
+        len  -= num;
+    }
+    if (crc != ((uint16_t)hdr[6] | ((uint16_t)hdr[7] << 8))) {
+        return (0);
+    }
+    return (1);
+}
+
+/*! \brief  REPLAY PARAMETER GROUP
+*
+*    This function applies all valid records of the given parameter group
+*    in the order of the log to the given memory.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param grp
+*    index of parameter group
+*
+* \param dst
+*    reference to memory with the size of the parameter group
+*
+* \param found
+*    reference to result: 1 = parameter group is stored, 0 = not stored
+*
+* \retval   =CO_ERR_NONE    replay is finished
+* \retval  !=CO_ERR_NONE    flash read error
+*/
+static int16_t COParaLogReplay(CO_PARA_LOG *log,
+                               uint8_t      grp,
+                               uint8_t     *dst,
+                               uint8_t     *found)
+{
+    CO_PARA  *pg;
+    uint8_t   hdr[CO_PARA_LOG_HDR];
+    uint32_t  addr;
+    uint32_t  end;
+    uint32_t  pos;
+    uint32_t  rec;
+    uint32_t  n;
+    uint16_t  len;
+    uint16_t  off;
+    int16_t   res;
+    uint8_t   k;
+
+    pg     = log->Grp[grp];
+    *found = 0;
+    for (k = 0; k < log->Used; k++) {
+        addr = COParaLogAddr(log, k);
+        end  = (k == (uint8_t)(log->Used - 1u)) ? log->Pos : log->Drv->SecSize;
+        pos  = CO_PARA_LOG_HDR;
+        while ((pos + CO_PARA_LOG_HDR) <= end) {
+            rec = pos;
+            res = COParaLogRdHdr(log, addr, &pos, hdr);
+            if (res < 0) {
+                return (CO_ERR_PARA_LOAD);
+            }
+            if (res != CO_PARA_LOG_REC) {
+                break;
+            }
+            if (hdr[4] != grp) {
+                continue;
+            }
+            res = COParaLogCheck(log, addr + rec, hdr);
+            if (res < 0) {
+                return (CO_ERR_PARA_LOAD);
+            }
+            if (res == 0) {
+                continue;
+            }
+            if (hdr[5] == CO_PARA_LOG_DATA) {
+                len = (uint16_t)hdr[0] | ((uint16_t)hdr[1] << 8);
+                off = (uint16_t)hdr[2] | ((uint16_t)hdr[3] << 8);
+                if (log->Drv->Read(addr + rec + CO_PARA_LOG_HDR, &dst[off], len) < 0) {
+                    return (CO_ERR_PARA_LOAD);
+                }
+                *found = 1;
+            } else if (pg->Default != 0) {
+                for (n = 0; n < pg->Size; n++) {
+                    dst[n] = pg->Default[n];
+                }
+                *found = 1;
+            } else {
+                *found = 0;
+            }
+        }
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  OPEN NEXT SECTOR
+*
+*    This function appends the next free sector to the log. A sector, which
+*    is not completely erased, is erased before use.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \retval   =CO_ERR_NONE    next sector is the head of the log
+* \retval  !=CO_ERR_NONE    flash error
+*/
+static int16_t COParaLogOpen(CO_PARA_LOG *log)
+{
+    const CO_PARA_LOG_DRV *drv;
+    uint8_t   buf[CO_PARA_LOG_CHUNK];
+    uint32_t  addr;
+    uint32_t  pos;
+    uint32_t  seq;
+    uint8_t   sec;
+    uint8_t   n;
+
+    drv  = log->Drv;
+    sec  = (uint8_t)(((uint16_t)log->Base + log->Used) % drv->SecNum);
+    addr = (uint32_t)sec * drv->SecSize;
+    for (pos = 0; pos < drv->SecSize; pos += CO_PARA_LOG_CHUNK) {
+        if (drv->Read(addr + pos, buf, CO_PARA_LOG_CHUNK) < 0) {
+            return (CO_ERR_PARA_STORE);
+        }
+        for (n = 0; n < CO_PARA_LOG_CHUNK; n++) {
+            if (buf[n] != 0xFFu) {
+                break;
+            }
+        }
+        if (n < CO_PARA_LOG_CHUNK) {
+            if (drv->Erase(sec) < 0) {
+                return (CO_ERR_PARA_STORE);
+            }
+            log->Erased++;
+            break;
+        }
+    }
+
+    seq    = log->Seq + 1u;
+    buf[0] = (uint8_t)(CO_PARA_LOG_MAGIC);
+    buf[1] = (uint8_t)(CO_PARA_LOG_MAGIC >> 8);
+    buf[2] = (uint8_t)(CO_PARA_LOG_MAGIC >> 16);
+    buf[3] = (uint8_t)(CO_PARA_LOG_MAGIC >> 24);
+    buf[4] = (uint8_t)(seq);
+    buf[5] = (uint8_t)(seq >> 8);
+    buf[6] = (uint8_t)(seq >> 16);
+    buf[7] = (uint8_t)(seq >> 24);
+    /* sequence first: a valid signature marks a complete sector header */
+    if (drv->Prog(addr + 4u, &buf[4], 4) < 0) {
+        return (CO_ERR_PARA_STORE);
+    }
+    if (drv->Prog(addr, buf, 4) < 0) {
+        return (CO_ERR_PARA_STORE);
+    }
+    log->Written += CO_PARA_LOG_HDR;
+    log->Seq      = seq;
+    log->Used++;
+    log->Pos      = CO_PARA_LOG_HDR;
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  APPEND RECORD
+*
+*    This function appends a record to the log. If the head sector is full,
+*    the next free sector is used. When the free sectors are needed for a
+*    snapshot, the log is compacted first.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param type
+*    record type
+*
+* \param grp
+*    index of parameter group (or CO_PARA_LOG_NONE)
+*
+* \param off
+*    offset of data in parameter group
+*
+* \param data
+*    reference to data
+*
+* \param len
+*    length of data
+*
+* \retval   =0    record is appended
+* \retval   =1    log is compacted with the group in storage; record is obsolete
+* \retval   <0    flash error
+*/
+static int16_t COParaLogAppend(CO_PARA_LOG   *log,
+                               uint8_t        type,
+                               uint8_t        grp,
+                               uint16_t       off,
+                               const uint8_t *data,
+                               uint16_t       len)
+{
+    const CO_PARA_LOG_DRV *drv;
+    uint8_t   hdr[CO_PARA_LOG_HDR];
+    uint8_t   pad[CO_PARA_LOG_ALIGN];
+    uint32_t  addr;
+    uint32_t  full;
+    uint16_t  crc;
+    int16_t   err;
+    uint8_t   n;
+
+    drv = log->Drv;
+    while ((log->Pos + CO_PARA_LOG_SIZE(len)) > drv->SecSize) {
+        if ((log->Compact == 0) &&
+            ((uint8_t)(drv->SecNum - log->Used - 1u) < log->Snap)) {
+            err = COParaLogCompact(log);
+            if (err != CO_ERR_NONE) {
+                return (-1);
+            }
+            if (grp == log->Act) {
+                return (1);
+            }
+        } else {
+            err = COParaLogOpen(log);
+            if (err != CO_ERR_NONE) {
+                return (-1);
+            }
+        }
+    }
+
+    hdr[0] = (uint8_t)(len);
+    hdr[1] = (uint8_t)(len >> 8);
+    hdr[2] = (uint8_t)(off);
+    hdr[3] = (uint8_t)(off >> 8);
+    hdr[4] = grp;
+    hdr[5] = type;
+    crc    = COParaLogCrc(0xFFFFu, hdr, 6);
+    crc    = COParaLogCrc(crc, data, len);
+    hdr[6] = (uint8_t)(crc);
+    hdr[7] = (uint8_t)(crc >> 8);
+
+    /* header first: an interrupted data programming results in a bad CRC */
+    addr = COParaLogAddr(log, (uint8_t)(log->Used - 1u)) + log->Pos;
+    if (drv->Prog(addr, hdr, CO_PARA_LOG_HDR) < 0) {
+        return (-1);
+    }
+    full = (uint32_t)len & ~((uint32_t)CO_PARA_LOG_ALIGN - 1u);
+    if (full > 0) {
+        if (drv->Prog(addr + CO_PARA_LOG_HDR, data, full) < 0) {
+            return (-1);
+        }
+    }
+    if (full < len) {
+        for (n = 0; n < CO_PARA_LOG_ALIGN; n++) {
+            pad[n] = ((full + n) < len) ? data[full + n] : 0xFFu;
+        }
+        if (drv->Prog(addr + CO_PARA_LOG_HDR + full, pad, CO_PARA_LOG_ALIGN) < 0) {
+            return (-1);
+        }
+    }
+    log->Pos     += CO_PARA_LOG_SIZE(len);
+    log->Written += CO_PARA_LOG_SIZE(len);
+    return (0);
+}
+
+/*! \brief  WRITE DATA RECORDS
+*
+*    This function appends the given range of a parameter group as data
+*    records. A range, which exceeds a sector, is split into several
+*    records.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \param grp
+*    index of parameter group
+*
+* \param off
+*    offset of range in parameter group
+*
+* \param data
+*    reference to range data
+*
+* \param len
+*    length of range
+*
+* \retval   =0    records are appended
+* \retval   =1    log is compacted with the group in storage
+* \retval   <0    flash error
+*/
+static int16_t COParaLogWrite(CO_PARA_LOG   *log,
+                              uint8_t        grp,
+                              uint32_t       off,
+                              const uint8_t *data,
+                              uint32_t       len)
+{
+    uint32_t max;
+    uint32_t num;
+    int16_t  res;
+
+    max = (log->Drv->SecSize - (2u * CO_PARA_LOG_HDR)) &
+          ~((uint32_t)CO_PARA_LOG_ALIGN - 1u);
+    while (len > 0) {
+        num = (len > max) ? max : len;
+        res = COParaLogAppend(log, CO_PARA_LOG_DATA, grp,
+                              (uint16_t)off, data, (uint16_t)num);
+        if (res != 0) {
+            return (res);
+        }
+        off  += num;
+        data += num;
+        len  -= num;
+    }
+    return (0);
+}
+
+/*! \brief  MOUNT PARAMETER LOG
+*
+*    This function searches the log in the flash memory. The sectors before
+*    the last complete snapshot are erased and the append position in the
+*    head sector is determined. A flash memory without log is formatted.
+*
+* \param log
+*    reference to parameter log structure
+*
+* \retval   =CO_ERR_NONE    log is mounted
+* \retval  !=CO_ERR_NONE    flash error
+*/
+static int16_t COParaLogMount(CO_PARA_LOG *log)
+{
+    const CO_PARA_LOG_DRV *drv;
+    uint8_t   hdr[CO_PARA_LOG_HDR];
+    uint32_t  magic;
+    uint32_t  seq;
+    uint32_t  start;
+    uint32_t  addr;
+    uint32_t  pos;
+    uint32_t  rec;
+    int16_t   res;
+    uint8_t   head;
+    uint8_t   prev;
+    uint8_t   sec;
+    uint8_t   k;
+
+    drv       = log->Drv;
+    head      = CO_PARA_LOG_NONE;
+    log->Seq  = 0;
+    log->Base = 0;
+    log->Used = 0;
+    log->Pos  = drv->SecSize;
+    for (sec = 0; sec < drv->SecNum; sec++) {
+        if (drv->Read((uint32_t)sec * drv->SecSize, hdr, CO_PARA_LOG_HDR) < 0) {
+            return (CO_ERR_PARA_LOAD);
+        }
+        magic = (uint32_t)hdr[0]         | ((uint32_t)hdr[1] << 8) |
+                ((uint32_t)hdr[2] << 16) | ((uint32_t)hdr[3] << 24);
+        seq   = (uint32_t)hdr[4]         | ((uint32_t)hdr[5] << 8) |
+                ((uint32_t)hdr[6] << 16) | ((uint32_t)hdr[7] << 24);
+        if ((magic == CO_PARA_LOG_MAGIC) &&
+            ((head == CO_PARA_LOG_NONE) || (seq > log->Seq))) {
+            head     = sec;
+            log->Seq = seq;
+        }
+    }
+    if (head == CO_PARA_LOG_NONE) {
+        return (COParaLogOpen(log));
+    }
+
+    /* the log is the run of sectors with decreasing sequence numbers */
+    log->Base = head;
+    log->Used = 1;
+    while (log->Used < drv->SecNum) {
+        prev = (uint8_t)(((uint16_t)log->Base + drv->SecNum - 1u) % drv->SecNum);
+        if (drv->Read((uint32_t)prev * drv->SecSize, hdr, CO_PARA_LOG_HDR) < 0) {
+            return (CO_ERR_PARA_LOAD);
+        }
+        magic = (uint32_t)hdr[0]         | ((uint32_t)hdr[1] << 8) |
+                ((uint32_t)hdr[2] << 16) | ((uint32_t)hdr[3] << 24);
+        seq   = (uint32_t)hdr[4]         | ((uint32_t)hdr[5] << 8) |
+                ((uint32_t)hdr[6] << 16) | ((uint32_t)hdr[7] << 24);
+        if ((magic != CO_PARA_LOG_MAGIC) || (seq != (log->Seq - log->Used))) {
+            break;
+        }
+        log->Base = prev;
+        log->Used++;
+    }
+
+    /* search the last complete snapshot */
+    start = 0;
+    for (k = 0; k < log->Used; k++) {
+        addr = COParaLogAddr(log, k);
+        pos  = CO_PARA_LOG_HDR;
+        while ((pos + CO_PARA_LOG_HDR) <= drv->SecSize) {
+            rec = pos;
+            res = COParaLogRdHdr(log, addr, &pos, hdr);
+            if (res < 0) {
+                return (CO_ERR_PARA_LOAD);
+            }
+            if (res != CO_PARA_LOG_REC) {
+                break;
+            }
+            if (hdr[5] == CO_PARA_LOG_COMMIT) {
+                if (COParaLogCheck(log, addr + rec, hdr) > 0) {
+                    if (drv->Read(addr + rec + CO_PARA_LOG_HDR, hdr, 4) < 0) {
+                        return (CO_ERR_PARA_LOAD);
+                    }
+                    start = (uint32_t)hdr[0]         | ((uint32_t)hdr[1] << 8) |
+                            ((uint32_t)hdr[2] << 16) | ((uint32_t)hdr[3] << 24);
+                }
+            }
+        }
+    }
+
+    /* complete an interrupted compaction */
+    while ((log->Used > 1) && (start > (log->Seq - log->Used + 1u))) {
+        if (drv->Erase(log->Base) < 0) {
+            return (CO_ERR_PARA_LOAD);
+        }
+        log->Erased++;
+        log->Base = (uint8_t)((log->Base + 1u) % drv->SecNum);
+        log->Used--;
+    }
+
+    /* drop the sectors of a compaction, which is interrupted before the
+       snapshot is complete: these sectors hold copies of stored values */
+    while ((log->Used > 1) && ((uint8_t)(drv->SecNum - log->Used) < log->Snap)) {
+        sec = (uint8_t)(((uint16_t)log->Base + log->Used - 1u) % drv->SecNum);
+        if (drv->Erase(sec) < 0) {
+            return (CO_ERR_PARA_LOAD);
+        }
+        log->Erased++;
+        log->Used--;
+        log->Seq--;
+    }
+
+    /* search the append position in the head sector */
+    addr = COParaLogAddr(log, (uint8_t)(log->Used - 1u));
+    pos  = CO_PARA_LOG_HDR;
+    res  = CO_PARA_LOG_END;
+    while ((pos + CO_PARA_LOG_HDR) <= drv->SecSize) {
+        res = COParaLogRdHdr(log, addr, &pos, hdr);
+        if (res < 0) {
+            return (CO_ERR_PARA_LOAD);
+        }
+        if (res != CO_PARA_LOG_REC) {
+            break;
+        }
+    }
+    log->Pos = (res == CO_PARA_LOG_BAD) ? drv->SecSize : pos;
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COParaLogInit(CO_PARA_LOG           *log,
+                      const CO_PARA_LOG_DRV *drv,
+                      CO_PARA              **grp,
+                      uint8_t                num,
+                      uint8_t               *buf)
+{
+    uint32_t max;
+    uint32_t pos;
+    uint32_t len;
+    uint32_t size;
+    uint16_t secs;
+    uint8_t  g;
+
+    if ((log == 0) || (drv == 0) || (grp == 0) || (buf == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((num == 0) || (num == CO_PARA_LOG_NONE) ||
+        (drv->Read == 0) || (drv->Prog == 0) || (drv->Erase == 0) ||
+        (drv->SecNum < 2) || (drv->SecSize < (4u * CO_PARA_LOG_HDR)) ||
+        ((drv->SecSize % CO_PARA_LOG_CHUNK) != 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    /* number of sectors for a snapshot and a single maximal record */
+    max  = (drv->SecSize - (2u * CO_PARA_LOG_HDR)) &
+           ~((uint32_t)CO_PARA_LOG_ALIGN - 1u);
+    pos  = drv->SecSize;
+    secs = 1;
+    for (g = 0; g < num; g++) {
+        if ((grp[g] == 0) || (grp[g]->Start == 0) || (grp[g]->Size > 0xFFFFu)) {
+            return (CO_ERR_BAD_ARG);
+        }
+        len = grp[g]->Size;
+        while (len > 0) {
+            size = (len > max) ? max : len;
+            if ((pos + CO_PARA_LOG_SIZE(size)) > drv->SecSize) {
+                secs++;
+                pos = CO_PARA_LOG_HDR;
+            }
+            pos += CO_PARA_LOG_SIZE(size);
+            len -= size;
+        }
+    }
+    if ((pos + CO_PARA_LOG_SIZE(4)) > drv->SecSize) {
+        secs++;
+    }
+    if ((2u * secs) > drv->SecNum) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    log->Drv     = drv;
+    log->Grp     = grp;
+    log->Buf     = buf;
+    log->Num     = num;
+    log->Snap    = (uint8_t)secs;
+    log->Written = 0;
+    log->Erased  = 0;
+    log->Act     = CO_PARA_LOG_NONE;
+    log->Compact = 0;
+    return (COParaLogMount(log));
+}
+
+/*
+* see function definition
+*/
+int16_t COParaLogLoad(CO_PARA_LOG *log, CO_PARA *pg)
+{
+    uint8_t found;
+    uint8_t g;
+
+    if ((log == 0) || (pg == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    g = COParaLogFind(log, pg);
+    if (g == CO_PARA_LOG_NONE) {
+        return (CO_ERR_BAD_ARG);
+    }
+    return (COParaLogReplay(log, g, pg->Start, &found));
+}
+
+/*
+* see function definition
+*/
+int16_t COParaLogSave(CO_PARA_LOG *log, CO_PARA *pg)
+{
+    uint32_t start;
+    uint32_t end;
+    uint32_t off;
+    uint32_t i;
+    int16_t  res;
+    uint8_t  found;
+    uint8_t  g;
+
+    if ((log == 0) || (pg == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    g = COParaLogFind(log, pg);
+    if (g == CO_PARA_LOG_NONE) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (COParaLogReplay(log, g, log->Buf, &found) != CO_ERR_NONE) {
+        return (CO_ERR_PARA_STORE);
+    }
+
+    log->Act = g;
+    if (found == 0) {
+        res = COParaLogWrite(log, g, 0, pg->Start, pg->Size);
+    } else {
+        res = 0;
+        off = 0;
+        while ((off < pg->Size) && (res == 0)) {
+            if (log->Buf[off] == pg->Start[off]) {
+                off++;
+                continue;
+            }
+            /* merge changes with gaps smaller than a record header */
+            start = off;
+            end   = off;
+            for (i = off; i < pg->Size; i++) {
+                if (log->Buf[i] != pg->Start[i]) {
+                    end = i + 1u;
+                } else if ((i - end) >= CO_PARA_LOG_HDR) {
+                    break;
+                }
+            }
+            res = COParaLogWrite(log, g, start, &pg->Start[start], end - start);
+            off = end;
+        }
+    }
+    log->Act = CO_PARA_LOG_NONE;
+    if (res < 0) {
+        return (CO_ERR_PARA_STORE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COParaLogDefault(CO_PARA_LOG *log, CO_PARA *pg)
+{
+    uint8_t g;
+
+    if ((log == 0) || (pg == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    g = COParaLogFind(log, pg);
+    if (g == CO_PARA_LOG_NONE) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (COParaLogAppend(log, CO_PARA_LOG_DEF, g, 0, 0, 0) < 0) {
+        return (CO_ERR_PARA_RESTORE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COParaLogCompact(CO_PARA_LOG *log)
+{
+    const uint8_t *src;
+    uint8_t        seq[4];
+    uint8_t        old;
+    uint8_t        found;
+    uint8_t        g;
+    int16_t        res;
+
+    if (log == 0) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+
+    old          = log->Used;
+    log->Compact = 1;
+    res          = COParaLogOpen(log);
+    if (res == CO_ERR_NONE) {
+        seq[0] = (uint8_t)(log->Seq);
+        seq[1] = (uint8_t)(log->Seq >> 8);
+        seq[2] = (uint8_t)(log->Seq >> 16);
+        seq[3] = (uint8_t)(log->Seq >> 24);
+        for (g = 0; (g < log->Num) && (res == CO_ERR_NONE); g++) {
+            if (g == log->Act) {
+                /* the group in storage is written with the new values */
+                src   = log->Grp[g]->Start;
+                found = 1;
+            } else {
+                src = log->Buf;
+                res = COParaLogReplay(log, g, log->Buf, &found);
+            }
+            if ((res == CO_ERR_NONE) && (found != 0)) {
+                res = COParaLogWrite(log, g, 0, src, log->Grp[g]->Size);
+            }
+        }
+    }
+    if (res == CO_ERR_NONE) {
+        res = COParaLogAppend(log, CO_PARA_LOG_COMMIT, CO_PARA_LOG_NONE, 0, seq, 4);
+    }
+    while ((res == CO_ERR_NONE) && (old > 0)) {
+        if (log->Drv->Erase(log->Base) < 0) {
+            res = -1;
+        } else {
+            log->Erased++;
+            log->Base = (uint8_t)((log->Base + 1u) % log->Drv->SecNum);
+            log->Used--;
+            old--;
+        }
+    }
+    log->Compact = 0;
+    if (res != CO_ERR_NONE) {
+        return (CO_ERR_PARA_STORE);
+    }
+    return (CO_ERR_NONE);
+}
@@ -46,7 +46,7 @@ void COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj)
     uint16_t num;
 
     if (CO_IS_PDOMAP(obj->Key) != 0) {
-        for (n=0; n < (CO_TPDO_N << 3); n++) {
+        for (n=0; n < (CO_TPDO_N * CO_PDO_MAP_N); n++) {
             if (pdo->Node->TMap[n].Obj == obj) {
                 num = pdo->Node->TMap[n].Num;
                 COTPdoTrigPdo(pdo, num);
@@ -90,8 +90,9 @@ void COTPdoClear(CO_TPDO *pdo, CO_NODE *node)
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
-        for (on = 0; on < 8; on++) {
-            pdo[num].Map[on] = 0;
+        pdo[num].Size       = 0;
+        for (on = 0; on < CO_PDO_MAP_N; on++) {
+            pdo[num].Map[on].Obj = 0;
         }
     }
 }
@@ -119,8 +120,9 @@ void COTPdoInit(CO_TPDO *pdo, CO_NODE *node)
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
-        for (on = 0; on < 8; on++) {
-            pdo[num].Map[on] = 0;
+        pdo[num].Size       = 0;
+        for (on = 0; on < CO_PDO_MAP_N; on++) {
+            pdo[num].Map[on].Obj = 0;
         }
         err = CODictRdByte(&node->Dict, CO_DEV(0x1800 + num,0),&tnum);
         if (err == CO_ERR_NONE) {
@@ -248,9 +250,10 @@ int16_t COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
     uint32_t  mapping;
     uint16_t  idx;
     uint16_t  on;
+    uint16_t  pos;
     int16_t   err;
     uint8_t   mapnum;
-    uint8_t   dlc;
+    uint8_t   len;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1A00 + num;
@@ -258,28 +261,62 @@ int16_t COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
     if (err != CO_ERR_NONE) {
         return (-1);
     }
+    if (mapnum > CO_PDO_MAP_N) {
+        return (-1);
+    }
 
     /* build mapping table */
-    dlc = 0;
+    pos = 0;
     for (on=0; on < mapnum; on++) {
         err = CODictRdLong(cod, CO_DEV(idx, 1+on), &mapping);
         if (err != CO_ERR_NONE) {
             return (-1);
         }
 
-        dlc += (uint8_t)(mapping & 0xFF) >> 3;
-        if (dlc > 8) {
+        len = CO_PDO_MAP_LEN(mapping);
+        if ((pos + len) > 64) {
             return (-1);
         }
         obj = CODictFind(&pdo->Node->Dict, mapping);
         if (obj == 0) {
             return (-1);
-        } else {
-            pdo[num].Map[on] = obj;
-            COTPdoMapAdd(pdo->Node->TMap, obj, num);
         }
+        err = COPdoMapCompile(&pdo[num].Map[on], obj, pdo->Node, (uint8_t)pos, len);
+        if (err != CO_ERR_NONE) {
+            return (-1);
+        }
+        COTPdoMapAdd(pdo->Node->TMap, obj, num);
+        pos += len;
     }
     pdo[num].ObjNum = mapnum;
+    pdo[num].Size   = (uint8_t)((pos + 7) >> 3);
+#if CO_PDO_PIMG > 0
+    COPimgTPdoMap(pdo->Node->Pimg, num);
+#endif
+
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t COPdoMapCompile(CO_PDO_MAP *map, CO_OBJ *obj, CO_NODE *node, uint8_t pos, uint8_t len)
+{
+    uint32_t sz;
+    uint64_t mask;
+
+    sz = COObjGetSize(obj, node, 0L);
+    if ((len == 0) || (sz > CO_QUAD) || ((uint32_t)len > (sz << 3))) {
+        return (-1);
+    }
+    if (len < 64) {
+        mask = ((uint64_t)1 << len) - 1;
+    } else {
+        mask = ~(uint64_t)0;
+    }
+    map->Obj   = obj;
+    map->Mask  = mask << pos;
+    map->Shift = pos;
 
     return (0);
 }
@@ -317,10 +354,11 @@ void COTPdoEndInhibit(void *parg)
 */
 void COTPdoTx (CO_TPDO *pdo)
 {
-    CO_IF_FRM frm;
-    uint32_t  sz;
-    uint32_t  data;
-    uint8_t   num;
+    CO_IF_FRM   frm;
+    CO_PDO_MAP *map;
+    uint64_t    data;
+    uint64_t    val;
+    uint8_t     num;
 
     if ((pdo->Node->Nmt.Allowed & CO_PDO_ALLOWED) == 0) {
         return;
@@ -356,23 +394,16 @@ void COTPdoTx (CO_TPDO *pdo)
             pdo->Node->Error = CO_ERR_TPDO_EVENT;
         }
     }
-    frm.Identifier = pdo->Identifier;
-    frm.DLC        = 0;
+    data = 0;
     for (num = 0; num < pdo->ObjNum; num++) {
-        sz = COObjGetSize(pdo->Map[num], pdo->Node, 0L);
-        if (sz <= (uint32_t)(8 - frm.DLC)) {
-            COObjRdValue(pdo->Map[num], pdo->Node, &data, CO_LONG, pdo->Node->NodeId);
-
-            if (sz == CO_BYTE) {
-                CO_SET_BYTE(&frm, data, frm.DLC);
-            } else if (sz == CO_WORD) {
-                CO_SET_WORD(&frm, data, frm.DLC);
-            } else if (sz == CO_LONG) {
-                CO_SET_LONG(&frm, data, frm.DLC);
-            }
-            frm.DLC += (uint8_t)sz;
-        }
+        map = &pdo->Map[num];
+        val = 0;
+        (void)COObjRdValue(map->Obj, pdo->Node, &val, CO_QUAD, pdo->Node->NodeId);
+        data |= (val << map->Shift) & map->Mask;
     }
+    frm.Identifier = pdo->Identifier;
+    frm.DLC        = pdo->Size;
+    CO_SET_QUAD(&frm, data, 0);
 
     COPdoTransmit(&frm);
     (void)COIfSend(&pdo->Node->If, &frm);
@@ -385,7 +416,7 @@ void COTPdoMapClear(CO_TPDO_LINK *map)
 {
     uint16_t id;
 
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
+    for (id = 0; id < (CO_TPDO_N * CO_PDO_MAP_N); id++) {
         map[id].Obj  = 0;
         map[id].Num  = 0xFFFF;
     }
@@ -398,7 +429,7 @@ void COTPdoMapAdd(CO_TPDO_LINK *map, CO_OBJ *obj, uint16_t num)
 {
     uint16_t id;
     
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
+    for (id = 0; id < (CO_TPDO_N * CO_PDO_MAP_N); id++) {
         if (map[id].Obj == 0) {
             map[id].Obj = obj;
             map[id].Num = num;
@@ -414,7 +445,7 @@ void COTPdoMapDelNum(CO_TPDO_LINK *map, uint16_t num)
 {
     uint16_t id;
     
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
+    for (id = 0; id < (CO_TPDO_N * CO_PDO_MAP_N); id++) {
         if (map[id].Num == num) {
             map[id].Obj = 0;
             map[id].Num = 0xFFFF;
@@ -429,7 +460,7 @@ void COTPdoMapDelSig(CO_TPDO_LINK *map, CO_OBJ *obj)
 {
     uint16_t id;
 
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
+    for (id = 0; id < (CO_TPDO_N * CO_PDO_MAP_N); id++) {
         if (map[id].Obj == obj) {
             map[id].Obj = 0;
             map[id].Num = 0xFFFF;
@@ -468,7 +499,7 @@ int16_t COTypeEventWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_
     int16_t   err;
     int16_t   result = -1;
 
-    err = COObjWrDirect(obj, (void *)buf, size);
+    err = COObjWrDirect(obj, node, (void *)buf, size);
     if (err != CO_ERR_NONE) {
         return (-1);
     }
@@ -534,6 +565,10 @@ void CORPdoClear(CO_RPDO *pdo, CO_NODE *node)
         pdo[num].Node       = node;
         pdo[num].Identifier = 0;
         pdo[num].ObjNum     = 0;
+#if CO_RPDO_SNAPSHOT > 0
+        pdo[num].Seq        = 0;
+        pdo[num].Data       = 0;
+#endif
     }
 }
 
@@ -555,6 +590,10 @@ void CORPdoInit(CO_RPDO *pdo, CO_NODE *node)
         pdo[num].Node       = node;
         pdo[num].Identifier = 0;
         pdo[num].ObjNum     = 0;
+#if CO_RPDO_SNAPSHOT > 0
+        pdo[num].Seq        = 0;
+        pdo[num].Data       = 0;
+#endif
         err = CODictRdByte(&node->Dict, CO_DEV(0x1400 + num, 0), &rnum);
         if (err == CO_ERR_NONE) {
             CORPdoReset(pdo, num);
@@ -580,8 +619,8 @@ int16_t CORPdoReset(CO_RPDO *pdo, int16_t num)
     cod            = &wp->Node->Dict;
     wp->Identifier = 0;
     wp->ObjNum     = 0;
-    for (on = 0; on < 8; on++) {
-        wp->Map[on] = 0;
+    for (on = 0; on < CO_PDO_MAP_N; on++) {
+        wp->Map[on].Obj = 0;
     }
 
     if ((wp->Flag & CO_RPDO_FLG_S_) != 0) {
@@ -643,11 +682,12 @@ int16_t CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
     uint32_t  mapping;
     uint16_t  idx;
     uint16_t  link;
+    uint16_t  pos;
     int16_t   err;
     uint8_t   on;
     uint8_t   mapnum;
-    uint8_t   dlc;
-    uint8_t   dummy = 0;
+    uint8_t   len;
+    uint8_t   n = 0;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1600 + num;
@@ -655,46 +695,42 @@ int16_t CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
     if (err != CO_ERR_NONE) {
         return (-1);
     }
+    if (mapnum > CO_PDO_MAP_N) {
+        return (-1);
+    }
 
-    dlc = 0;
+    pos = 0;
     for (on = 0; on < mapnum; on++) {
         err = CODictRdLong(cod, CO_DEV(idx, 1 + on), &mapping);
         if (err != CO_ERR_NONE) {
             return (-1);
         }
 
-        dlc += (uint8_t)(mapping & 0xFF) >> 3;
-        if (dlc > 8) {
+        len = CO_PDO_MAP_LEN(mapping);
+        if ((len == 0) || ((pos + len) > 64)) {
             return (-1);
         }
-        link = mapping >> 16;
-        if ((link == 2) || (link == 5)) {
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-        } else if ((link == 3) || (link == 6)) {
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-        } else if ((link == 4) || (link == 7)) {
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-            pdo[num].Map[on + dummy] = 0;
-            dummy++;
-        } else {
-            obj = CODictFind(&pdo->Node->Dict, mapping);
-            if (obj == 0) {
-                return (-1);
-            } else {
-                pdo[num].Map[on + dummy] = obj;
-            }
+        /* dummy entries: skip the mapped bits of the payload */
+        link = (uint16_t)(mapping >> 16);
+        if (((link >= 1) && (link <= 7)) || (link == 0x15) || (link == 0x1B)) {
+            pos += len;
+            continue;
+        }
+        obj = CODictFind(&pdo->Node->Dict, mapping);
+        if (obj == 0) {
+            return (-1);
         }
+        err = COPdoMapCompile(&pdo[num].Map[n], obj, pdo->Node, (uint8_t)pos, len);
+        if (err != CO_ERR_NONE) {
+            return (-1);
+        }
+        pos += len;
+        n++;
     }
-    pdo[num].ObjNum = mapnum + dummy;
+    pdo[num].ObjNum = n;
+#if CO_PDO_PIMG > 0
+    COPimgRPdoMap(pdo->Node->Pimg, num);
+#endif
 
     return (0);
 }
@@ -743,35 +779,97 @@ int16_t CORPdoCheck(CO_RPDO *pdo, CO_IF_FRM *frm)
 */
 void CORPdoWrite(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
-    CO_OBJ  *obj;
-    uint32_t val32;
-    uint16_t val16;
-    uint8_t  val08;
-    uint8_t  on;
-    uint8_t  sz;
-    uint8_t  dlc = 0;
-
+    CO_PDO_MAP *map;
+    uint64_t    data;
+    uint64_t    val;
+    uint8_t     on;
+
+    data = CO_GET_QUAD(frm, 0);
+#if CO_RPDO_SNAPSHOT > 0
+    pdo->Seq++;
+    CO_BARRIER();
+    pdo->Data = data;
+#endif
     for (on = 0; on < pdo->ObjNum; on++) {
-        obj = pdo->Map[on];
-        if (obj != 0) {
-            sz = (uint8_t)COObjGetSize(obj, pdo->Node, 0L);
-            if (sz == CO_BYTE) {
-                val08 = CO_GET_BYTE(frm, dlc);
-                dlc++;
-                COObjWrValue(obj, pdo->Node, (void *)&val08, sz, pdo->Node->NodeId);
-            } else if (sz == CO_WORD) {
-                val16 = CO_GET_WORD(frm, dlc);
-                dlc += 2;
-                COObjWrValue(obj, pdo->Node, (void *)&val16, sz, pdo->Node->NodeId);
-            } else if (sz == CO_LONG) {
-                val32 = CO_GET_LONG(frm, dlc);
-                dlc += 4;
-                COObjWrValue(obj, pdo->Node, (void *)&val32, sz, pdo->Node->NodeId);
-            }
+        map = &pdo->Map[on];
+        val = (data & map->Mask) >> map->Shift;
+        (void)COObjWrValue(map->Obj, pdo->Node, (void *)&val, CO_QUAD, pdo->Node->NodeId);
+    }
+#if CO_RPDO_SNAPSHOT > 0
+    CO_BARRIER();
+    pdo->Seq++;
+#endif
+#if CO_PDO_PIMG > 0
+    COPimgRPdoPush(pdo->Node->Pimg, pdo, data);
+#endif
+}
+
+#if CO_RPDO_SNAPSHOT > 0
+
+/*
+* see function definition
+*/
+int16_t CORPdoSnapshot(CO_RPDO *pdo, uint64_t *val, uint8_t max)
+{
+    CO_PDO_MAP *map;
+    uint64_t    data;
+    uint32_t    seq;
+    uint16_t    retry;
+    uint8_t     num;
+    uint8_t     on;
+
+    if ((pdo == 0) || (val == 0)) {
+        return (-1);
+    }
+    for (retry = 0; retry < CO_RPDO_RETRY; retry++) {
+        seq  = CORPdoReadBegin(pdo);
+        data = pdo->Data;
+        num  = pdo->ObjNum;
+        if (num > max) {
+            num = max;
+        }
+        for (on = 0; on < num; on++) {
+            map     = &pdo->Map[on];
+            val[on] = (data & map->Mask) >> map->Shift;
+        }
+        if (CORPdoReadRetry(pdo, seq) == 0) {
+            return ((int16_t)num);
         }
     }
+    return (-1);
 }
 
+/*
+* see function definition
+*/
+uint32_t CORPdoReadBegin(CO_RPDO *pdo)
+{
+    uint32_t seq;
+    uint16_t retry;
+
+    seq = pdo->Seq;
+    for (retry = 0; (retry < CO_RPDO_RETRY) && ((seq & 1u) != 0); retry++) {
+        seq = pdo->Seq;
+    }
+    CO_BARRIER();
+
+    return (seq);
+}
+
+/*
+* see function definition
+*/
+int16_t CORPdoReadRetry(CO_RPDO *pdo, uint32_t seq)
+{
+    CO_BARRIER();
+    if (((seq & 1u) != 0) || (pdo->Seq != seq)) {
+        return (1);
+    }
+    return (0);
+}
+
+#endif
+
 /*
 * see function definition
 */
@@ -783,7 +881,7 @@ int16_t COTypePdoMapNumWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uin
     int16_t   result = CO_ERR_NONE;
     uint16_t  pmapidx;
     uint16_t  pcomidx;
-    uint8_t   mapbytes;
+    uint16_t  mapbits;
     uint8_t   mapnum;
     uint8_t   i;
 
@@ -794,7 +892,7 @@ int16_t COTypePdoMapNumWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uin
         return (CO_ERR_TPDO_MAP_OBJ);
     }
     mapnum = (uint8_t)(*(uint32_t *)buf);
-    if (mapnum > 8) {
+    if (mapnum > CO_PDO_MAP_N) {
         return (CO_ERR_OBJ_MAP_LEN);
     }
 
@@ -811,20 +909,20 @@ int16_t COTypePdoMapNumWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uin
     if ((id & CO_TPDO_COBID_OFF) == 0) {
         result = CO_ERR_OBJ_ACC;
     } else {
-        mapbytes = 0;
+        mapbits = 0;
         for (i = 1; i <= mapnum; i++) {
             result = CODictRdLong(cod, CO_DEV(pmapidx, i), &mapentry);
             if (result != CO_ERR_NONE) {
                 return (CO_ERR_OBJ_MAP_TYPE);
             }
-            mapbytes += CO_GET_SIZE(mapentry);
+            mapbits += CO_PDO_MAP_LEN(mapentry);
         }
 
-        if (mapbytes > 8) {
+        if (mapbits > 64) {
             return (CO_ERR_OBJ_MAP_LEN);
         }
 
-        result = COObjWrDirect(obj, &mapnum, CO_LONG);
+        result = COObjWrDirect(obj, node, &mapnum, CO_LONG);
     }
 
     return (result);
@@ -882,6 +980,11 @@ int16_t COTypePdoMapWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32
             return (CO_ERR_OBJ_MAP_TYPE);
         }
 
+        maps = COObjGetSize(objm, node, 0L);
+        if ((CO_PDO_MAP_LEN(map) == 0) || (CO_PDO_MAP_LEN(map) > (maps << 3))) {
+            return (CO_ERR_OBJ_MAP_LEN);
+        }
+
         if ((pmapidx >= 0x1600) && (pmapidx <= 0x17FF)) {
             maps = CO_IS_WRITE(objm->Key);
             if (maps == 0) {
@@ -894,7 +997,7 @@ int16_t COTypePdoMapWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32
             }
         }
 
-        result = COObjWrDirect(obj, &map, CO_LONG);
+        result = COObjWrDirect(obj, node, &map, CO_LONG);
     }
 
     return (result);
@@ -944,10 +1047,10 @@ int16_t COTypePdoComIdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint
         return (CO_ERR_TPDO_COM_OBJ);
     }
 
-    (void)COObjRdDirect(obj, &oid, CO_LONG);
+    (void)COObjRdDirect(obj, node, &oid, CO_LONG);
     if ((oid & CO_TPDO_COBID_OFF) == 0) {
         if ((nid & CO_TPDO_COBID_OFF) != 0) {
-            result = COObjWrDirect(obj, &nid, CO_LONG);
+            result = COObjWrDirect(obj, node, &nid, CO_LONG);
             if (nmt->Mode == CO_OPERATIONAL) {
                 if (tpdo != 0) {
                     COTPdoReset(tpdo, num);
@@ -961,9 +1064,9 @@ int16_t COTypePdoComIdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint
         }
     } else {
         if ((nid & CO_TPDO_COBID_OFF) != 0) {
-            result = COObjWrDirect(obj, &nid, CO_LONG);
+            result = COObjWrDirect(obj, node, &nid, CO_LONG);
         } else {
-            result = COObjWrDirect(obj, &nid, CO_LONG);
+            result = COObjWrDirect(obj, node, &nid, CO_LONG);
             if (nmt->Mode == CO_OPERATIONAL) {
                 if (tpdo != 0) {
                     COTPdoReset(tpdo, num);
@@ -1009,7 +1112,7 @@ int16_t COTypePdoComTypeWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, ui
     if ((id & CO_TPDO_COBID_OFF) == 0) {
         result = CO_ERR_OBJ_RANGE;
     } else {
-        result = COObjWrDirect(obj, &type, CO_LONG);
+        result = COObjWrDirect(obj, node, &type, CO_LONG);
     }
 
     return (result);
@@ -0,0 +1,306 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_pimg.h"
+
+#include "co_core.h"
+
+#if CO_PDO_PIMG > 0
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COPimgInit(CO_PIMG *pimg, struct CO_NODE_T *node, CO_PIMG_MEM *mem)
+{
+    uint16_t num;
+
+    if ((pimg == 0) || (node == 0) || (mem == 0)) {
+        CONodeFatalError();
+        return (CO_ERR_BAD_ARG);
+    }
+    node->Pimg   = 0;
+    pimg->Node   = node;
+    pimg->Mem    = mem;
+    mem->Magic   = 0;
+    mem->RPdoNum = CO_RPDO_N;
+    mem->TPdoNum = CO_TPDO_N;
+    for (num = 0; num < CO_RPDO_N; num++) {
+        mem->RPdo[num].Seq = 0;
+        mem->RPdo[num].Map = 0;
+        mem->RPdo[num].Ack = 0;
+        COPimgRPdoMap(pimg, num);
+    }
+    for (num = 0; num < CO_TPDO_N; num++) {
+        mem->TPdo[num].Seq = 0;
+        mem->TPdo[num].Map = 0;
+        mem->TPdo[num].Ack = 0;
+        COPimgTPdoMap(pimg, num);
+        mem->TPdo[num].Ack = mem->TPdo[num].Map;
+    }
+    CO_BARRIER();
+    mem->Magic = CO_PIMG_MAGIC;
+
+    node->Pimg = pimg;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COPimgRead(CO_PIMG_PDO *seg, uint64_t *val, uint8_t max)
+{
+    uint32_t seq;
+    uint16_t retry;
+    uint8_t  num;
+    uint8_t  on;
+
+    if ((seg == 0) || (val == 0)) {
+        return (-1);
+    }
+    for (retry = 0; retry < CO_PIMG_RETRY; retry++) {
+        seq = seg->Seq;
+        if ((seq & 1u) != 0) {
+            continue;
+        }
+        CO_BARRIER();
+        num = seg->Num;
+        if (num > max) {
+            num = max;
+        }
+        if (num > CO_PDO_MAP_N) {
+            num = CO_PDO_MAP_N;
+        }
+        for (on = 0; on < num; on++) {
+            val[on] = seg->Val[on];
+        }
+        CO_BARRIER();
+        if (seg->Seq == seq) {
+            return ((int16_t)num);
+        }
+    }
+    return (-1);
+}
+
+/*
+* see function definition
+*/
+int16_t COPimgWrite(CO_PIMG_PDO *seg, uint8_t pos, uint64_t *val, uint8_t num)
+{
+    uint8_t on;
+
+    if ((seg == 0) || (val == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (((uint16_t)pos + num) > CO_PDO_MAP_N) {
+        return (CO_ERR_BAD_ARG);
+    }
+    COPimgLock(&seg->Seq);
+    seg->Ack = seg->Map;
+    for (on = 0; on < num; on++) {
+        seg->Val[pos + on] = val[on];
+    }
+    COPimgUnlock(&seg->Seq);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+CO_PIMG_PDO *COPimgFind(CO_PIMG_PDO *seg, uint16_t num, uint32_t key, uint8_t *pos)
+{
+    uint16_t n;
+    uint8_t  on;
+
+    if ((seg == 0) || (pos == 0)) {
+        return ((CO_PIMG_PDO *)0);
+    }
+    key = CO_GET_DEV(key);
+    for (n = 0; n < num; n++) {
+        for (on = 0; (on < seg[n].Num) && (on < CO_PDO_MAP_N); on++) {
+            if (seg[n].Key[on] == key) {
+                *pos = on;
+                return (&seg[n]);
+            }
+        }
+    }
+    return ((CO_PIMG_PDO *)0);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COPimgRPdoMap(CO_PIMG *pimg, uint16_t num)
+{
+    CO_RPDO     *pdo;
+    CO_PIMG_PDO *seg;
+    uint64_t     val;
+    uint8_t      on;
+
+    if ((pimg == 0) || (num >= CO_RPDO_N)) {
+        return;
+    }
+    pdo = &pimg->Node->RPdo[num];
+    seg = &pimg->Mem->RPdo[num];
+    COPimgLock(&seg->Map);
+    COPimgLock(&seg->Seq);
+    seg->Num = pdo->ObjNum;
+    for (on = 0; on < pdo->ObjNum; on++) {
+        val = 0;
+        (void)COObjRdValue(pdo->Map[on].Obj, pimg->Node, &val, CO_QUAD, pimg->Node->NodeId);
+        seg->Key[on] = CO_GET_DEV(pdo->Map[on].Obj->Key);
+        seg->Val[on] = val & (pdo->Map[on].Mask >> pdo->Map[on].Shift);
+    }
+    seg->Ack = seg->Map + 1;
+    COPimgUnlock(&seg->Seq);
+    COPimgUnlock(&seg->Map);
+}
+
+/*
+* see function definition
+*/
+void COPimgTPdoMap(CO_PIMG *pimg, uint16_t num)
+{
+    CO_TPDO     *pdo;
+    CO_PIMG_PDO *seg;
+    uint64_t     val;
+    uint8_t      on;
+
+    if ((pimg == 0) || (num >= CO_TPDO_N)) {
+        return;
+    }
+    pdo = &pimg->Node->TPdo[num];
+    seg = &pimg->Mem->TPdo[num];
+    COPimgLock(&seg->Map);
+    seg->Num = pdo->ObjNum;
+    for (on = 0; on < pdo->ObjNum; on++) {
+        seg->Key[on] = CO_GET_DEV(pdo->Map[on].Obj->Key);
+        if (pimg->Mem->Magic != CO_PIMG_MAGIC) {
+            /* values are owned by the consumer after initialization */
+            val = 0;
+            (void)COObjRdValue(pdo->Map[on].Obj, pimg->Node, &val, CO_QUAD, pimg->Node->NodeId);
+            seg->Val[on] = val & (pdo->Map[on].Mask >> pdo->Map[on].Shift);
+        }
+    }
+    COPimgUnlock(&seg->Map);
+    pimg->TSeq[num] = seg->Seq;
+}
+
+/*
+* see function definition
+*/
+void COPimgRPdoPush(CO_PIMG *pimg, CO_RPDO *pdo, uint64_t data)
+{
+    CO_PIMG_PDO *seg;
+    CO_PDO_MAP  *map;
+    uint16_t     num;
+    uint8_t      on;
+
+    if ((pimg == 0) || (pdo == 0)) {
+        return;
+    }
+    num = (uint16_t)(pdo - &pimg->Node->RPdo[0]);
+    if (num >= CO_RPDO_N) {
+        return;
+    }
+    seg = &pimg->Mem->RPdo[num];
+    COPimgLock(&seg->Seq);
+    for (on = 0; on < pdo->ObjNum; on++) {
+        map = &pdo->Map[on];
+        seg->Val[on] = (data & map->Mask) >> map->Shift;
+    }
+    COPimgUnlock(&seg->Seq);
+}
+
+/*
+* see function definition
+*/
+void COPimgCheck(CO_PIMG *pimg)
+{
+    CO_TPDO     *pdo;
+    CO_PIMG_PDO *seg;
+    CO_OBJ      *obj;
+    uint64_t     val[CO_PDO_MAP_N];
+    uint32_t     seq;
+    uint32_t     ack;
+    uint16_t     num;
+    int16_t      n;
+    uint8_t      pass;
+    uint8_t      on;
+
+    if (pimg == 0) {
+        return;
+    }
+    for (num = 0; num < CO_TPDO_N; num++) {
+        seg = &pimg->Mem->TPdo[num];
+        seq = seg->Seq;
+        if ((seq == pimg->TSeq[num]) || ((seq & 1u) != 0)) {
+            continue;
+        }
+        CO_BARRIER();
+        ack = seg->Ack;
+        n   = COPimgRead(seg, &val[0], CO_PDO_MAP_N);
+        if ((n < 0) || (seg->Seq != seq)) {
+            continue;
+        }
+        pimg->TSeq[num] = seq;
+        if (ack != seg->Map) {
+            continue;                     /* values of a previous mapping */
+        }
+        pdo = &pimg->Node->TPdo[num];
+        /* write triggering objects last: the PDO contains all new values */
+        for (pass = 0; pass < 2; pass++) {
+            for (on = 0; (on < (uint8_t)n) && (on < pdo->ObjNum); on++) {
+                obj = pdo->Map[on].Obj;
+                if ((pass == 0) == (obj->Type == CO_TASYNC)) {
+                    continue;
+                }
+                (void)COObjWrValue(obj, pimg->Node, (void *)&val[on], CO_QUAD, pimg->Node->NodeId);
+            }
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+void COPimgLock(volatile uint32_t *seq)
+{
+    *seq = *seq + 1;
+    CO_BARRIER();
+}
+
+/*
+* see function definition
+*/
+void COPimgUnlock(volatile uint32_t *seq)
+{
+    CO_BARRIER();
+    *seq = *seq + 1;
+}
+
+#endif
@@ -50,6 +50,9 @@ void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
 {
     CO_SDO   *srvnum;
     uint32_t  offset;
+#if CO_SDO_CACHE_N > 0
+    uint8_t   n;
+#endif
 
     if (srv == 0) {
         return;
@@ -64,6 +67,7 @@ void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
     srvnum->TxId         = CO_SDO_ID_OFF;
     srvnum->Frm          = 0;
     srvnum->Obj          = 0;
+    srvnum->Defer        = 0;
     offset               = num * CO_SDO_BUF_BYTE;
     srvnum->Buf.Start    = &node->SdoBuf[offset];
     srvnum->Buf.Cur      = &node->SdoBuf[offset];
@@ -72,6 +76,16 @@ void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
     srvnum->Seg.Num      = 0;
     srvnum->Seg.Size     = 0;
     srvnum->Blk.State    = BLK_IDLE;
+    srvnum->Val.Size     = 0;
+    srvnum->Val.Num      = 0;
+#if CO_SDO_CACHE_N > 0
+    for (n = 0; n < CO_SDO_CACHE_N; n++) {
+        srvnum->Cache[n].Key  = 0;
+        srvnum->Cache[n].Obj  = 0;
+        srvnum->Cache[n].Size = 0;
+    }
+    srvnum->CacheGen     = node->Dict.Gen;
+#endif
 }
 
 /*
@@ -109,6 +123,29 @@ void COSdoEnable(CO_SDO *srv, uint8_t num)
     }
 }
 
+/*
+* see function definition
+*/
+int16_t COSdoSetBlkSize(CO_SDO *srv, uint8_t num, uint8_t segnum)
+{
+    if (srv == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (num >= CO_SDOS_N) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((segnum < 1) || (segnum > CO_SDO_BUF_SEG)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (srv[num].Blk.State != BLK_IDLE) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    srv[num].Blk.SegMax = segnum;
+
+    return (CO_ERR_NONE);
+}
+
 /*
 * see function definition
 */
@@ -152,6 +189,12 @@ int16_t COSdoResponse(CO_SDO *srv)
         return (-2);
     }
 
+    /* deferred download response is pending */
+    if (srv->Defer != 0) {
+        COSdoAbort(srv, CO_SDO_ERR_TOS_STATE);
+        return (-1);
+    }
+
     /* active block transfer */
     if (srv->Blk.State == BLK_DOWNLOAD) {
         result = COSdoDownloadBlock(srv);
@@ -227,7 +270,7 @@ int16_t COSdoGetObject(CO_SDO *srv, uint16_t mode)
     int16_t  result = -1;
 
     key = CO_DEV(srv->Idx, srv->Sub);
-    obj = CODictFind(&srv->Node->Dict, key);
+    obj = COSdoCacheFind(srv, key);
     if (obj != 0) {
         if (mode == CO_SDO_RD) {
             if (CO_IS_READ(obj->Key) != 0) {
@@ -261,15 +304,73 @@ int16_t COSdoGetObject(CO_SDO *srv, uint16_t mode)
     return (result);
 }
 
+/*
+* see function definition
+*/
+CO_OBJ *COSdoCacheFind(CO_SDO *srv, uint32_t key)
+{
+    CO_OBJ       *obj;
+#if CO_SDO_CACHE_N > 0
+    CO_SDO_CACHE  hit;
+    uint8_t       n;
+
+    if (srv->CacheGen != srv->Node->Dict.Gen) {
+        for (n = 0; n < CO_SDO_CACHE_N; n++) {
+            srv->Cache[n].Key  = 0;
+            srv->Cache[n].Obj  = 0;
+            srv->Cache[n].Size = 0;
+        }
+        srv->CacheGen = srv->Node->Dict.Gen;
+    }
+    n = 0;
+    while ((n < CO_SDO_CACHE_N) &&
+           ((srv->Cache[n].Obj == 0) || (srv->Cache[n].Key != key))) {
+        n++;
+    }
+    if (n < CO_SDO_CACHE_N) {
+        hit = srv->Cache[n];
+    } else {
+        obj = CODictFind(&srv->Node->Dict, key);
+        if (obj == 0) {
+            return (obj);
+        }
+        hit.Key  = key;
+        hit.Obj  = obj;
+        hit.Size = 0;
+        if ((obj->Type == 0) || (obj->Type->Size == 0)) {
+            hit.Size = CO_GET_SIZE(obj->Key);
+        }
+        n = CO_SDO_CACHE_N - 1;
+    }
+    while (n > 0) {
+        srv->Cache[n] = srv->Cache[n - 1];
+        n--;
+    }
+    srv->Cache[0] = hit;
+    obj           = hit.Obj;
+#else
+    obj = CODictFind(&srv->Node->Dict, key);
+#endif
+
+    return (obj);
+}
+
 /*
 * see function definition
 */
 uint32_t COSdoGetSize(CO_SDO *srv, uint32_t width)
 {
     uint32_t result = 0;
-    uint32_t size;
+    uint32_t size   = 0;
 
-    size = COObjGetSize(srv->Obj, srv->Node, width);
+#if CO_SDO_CACHE_N > 0
+    if (srv->Cache[0].Obj == srv->Obj) {
+        size = srv->Cache[0].Size;
+    }
+#endif
+    if (size == 0) {
+        size = COObjGetSize(srv->Obj, srv->Node, width);
+    }
     if (size == 0) {
         COSdoAbort(srv, CO_SDO_ERR_TOS);
         return (result);
@@ -354,8 +455,15 @@ int16_t COSdoDownloadExpedited(CO_SDO *srv)
     if ((size > 0) && (size <= 4)) {
         nodeid = srv->Node->NodeId;
         data   = CO_GET_LONG(srv->Frm, 4);
+        srv->Node->SdoDefer = srv;
         num    = COObjWrValue(srv->Obj, srv->Node, (void*)&data, CO_LONG, nodeid);
-        if (num != CO_ERR_NONE) {
+        srv->Node->SdoDefer = 0;
+        if (num == CO_ERR_SDO_DEFER) {
+            /* the object type sends the response with COSdoDeferred() */
+            srv->Obj   = 0;
+            srv->Defer = 1;
+            result     = -2;
+        } else if (num != CO_ERR_NONE) {
             if (num ==  CO_ERR_OBJ_RANGE) {
                 COSdoAbort(srv, CO_SDO_ERR_RANGE);
             } else if (num == CO_ERR_OBJ_MAP_TYPE) {
@@ -380,6 +488,32 @@ int16_t COSdoDownloadExpedited(CO_SDO *srv)
     return (result);
 }
 
+/*
+* see function definition
+*/
+void COSdoDeferred(CO_SDO *srv, uint16_t idx, uint8_t sub, uint32_t err)
+{
+    CO_IF_FRM frm;
+
+    /* deferred response is cancelled by a client abort */
+    if (srv->Defer == 0) {
+        return;
+    }
+    srv->Defer = 0;
+
+    CO_SET_ID  (&frm, srv->TxId);
+    CO_SET_DLC (&frm, 8);
+    if (err == 0) {
+        CO_SET_BYTE(&frm, 0x60, 0);
+    } else {
+        CO_SET_BYTE(&frm, 0x80, 0);
+    }
+    CO_SET_WORD(&frm,  idx, 1);
+    CO_SET_BYTE(&frm,  sub, 3);
+    CO_SET_LONG(&frm,  err, 4);
+    (void)COIfSend(&srv->Node->If, &frm);
+}
+
 /*
 * see function definition
 */
@@ -393,6 +527,113 @@ void COSdoAbort(CO_SDO *srv, uint32_t err)
     srv->Obj = 0;
 }
 
+/*
+* see function definition
+*/
+int16_t COSdoObjRdStart(CO_SDO *srv)
+{
+    CO_OBJ   *obj;
+    uint64_t  val;
+    int16_t   result;
+    uint8_t   n;
+
+    obj           = srv->Obj;
+    srv->Val.Size = 0;
+    srv->Val.Num  = 0;
+    if ((obj->Type != 0) && (obj->Type->Size != 0)) {
+        result = COObjRdBufStart(obj, srv->Node, srv->Buf.Cur, 0);
+        return (result);
+    }
+
+    result = COObjRdValue(obj, srv->Node, (void *)&val, CO_QUAD, srv->Node->NodeId);
+    if (result == CO_ERR_NONE) {
+        srv->Val.Size = (uint8_t)CO_GET_SIZE(obj->Key);
+        for (n = 0; n < srv->Val.Size; n++) {
+            srv->Val.Data[n] = (uint8_t)(val >> (8 * n));
+        }
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoObjRdCont(CO_SDO *srv, uint8_t *buf, uint32_t len)
+{
+    int16_t result = CO_ERR_NONE;
+
+    if (srv->Val.Size == 0) {
+        result = COObjRdBufCont(srv->Obj, srv->Node, buf, len);
+        return (result);
+    }
+
+    if (len > (uint32_t)(srv->Val.Size - srv->Val.Num)) {
+        return (CO_ERR_OBJ_SIZE);
+    }
+    while (len > 0) {
+        *buf = srv->Val.Data[srv->Val.Num];
+        srv->Val.Num++;
+        buf++;
+        len--;
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoObjWrStart(CO_SDO *srv)
+{
+    CO_OBJ  *obj;
+    int16_t  result = CO_ERR_NONE;
+
+    obj           = srv->Obj;
+    srv->Val.Size = 0;
+    srv->Val.Num  = 0;
+    if ((obj->Type != 0) && (obj->Type->Size != 0)) {
+        result = COObjWrBufStart(obj, srv->Node, srv->Buf.Cur, 0);
+    } else {
+        srv->Val.Size = (uint8_t)CO_GET_SIZE(obj->Key);
+    }
+
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoObjWrCont(CO_SDO *srv, uint8_t *buf, uint32_t len)
+{
+    uint64_t val    = 0;
+    int16_t  result = CO_ERR_NONE;
+    uint8_t  n;
+
+    if (srv->Val.Size == 0) {
+        result = COObjWrBufCont(srv->Obj, srv->Node, buf, len);
+        return (result);
+    }
+
+    if (len > (uint32_t)(srv->Val.Size - srv->Val.Num)) {
+        return (CO_ERR_OBJ_SIZE);
+    }
+    while (len > 0) {
+        srv->Val.Data[srv->Val.Num] = *buf;
+        srv->Val.Num++;
+        buf++;
+        len--;
+    }
+    if (srv->Val.Num == srv->Val.Size) {
+        for (n = 0; n < srv->Val.Size; n++) {
+            val |= (uint64_t)srv->Val.Data[n] << (8 * n);
+        }
+        result = COObjWrValue(srv->Obj, srv->Node, (void *)&val, CO_QUAD, srv->Node->NodeId);
+    }
+
+    return (result);
+}
+
 /*
 * see function definition
 */
@@ -411,7 +652,7 @@ int16_t COSdoInitUploadSegmented(CO_SDO *srv, uint32_t size)
     srv->Buf.Cur  = srv->Buf.Start;
     srv->Buf.Num  = 0;
 
-    result = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+    result = COSdoObjRdStart(srv);
     if (result != CO_ERR_NONE) {
         srv->Node->Error = CO_ERR_SDO_READ;
         result           = CO_ERR_NONE;
@@ -445,7 +686,7 @@ int16_t COSdoInitDownloadSegmented(CO_SDO *srv)
         srv->Buf.Cur  = srv->Buf.Start;
         srv->Buf.Num  = 0;
         
-        result = COObjWrBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+        result = COSdoObjWrStart(srv);
         if (result != CO_ERR_NONE) {
             srv->Node->Error = CO_ERR_SDO_WRITE;
             result           = CO_ERR_NONE;
@@ -495,7 +736,7 @@ int16_t COSdoDownloadSegmented(CO_SDO *srv)
 
     if ((cmd & 0x01) == 0x01) {
         len    = (uint32_t)srv->Buf.Num;
-        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+        result = COSdoObjWrCont(srv, srv->Buf.Start, len);
         if (result != CO_ERR_NONE) {
             COSdoAbort(srv, CO_SDO_ERR_TOS);
             result = -1;
@@ -505,7 +746,7 @@ int16_t COSdoDownloadSegmented(CO_SDO *srv)
         srv->Obj      = 0;
     } else {
         len    = (uint32_t)srv->Buf.Num;
-        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+        result = COSdoObjWrCont(srv, srv->Buf.Start, len);
         if (result != CO_ERR_NONE) {
             COSdoAbort(srv, CO_SDO_ERR_TOS);
             result = -1;
@@ -557,9 +798,9 @@ int16_t COSdoUploadSegmented(CO_SDO *srv)
     }
 
     if (c_bit == 1) {
-        result = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, width);
+        result = COSdoObjRdCont(srv, srv->Buf.Start, width);
     } else {
-        result = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, width);
+        result = COSdoObjRdCont(srv, srv->Buf.Start, width);
     }
     if (result != CO_ERR_NONE) {
         COSdoAbort(srv, CO_SDO_ERR_TOS);
@@ -614,7 +855,7 @@ int16_t COSdoInitDownloadBlock(CO_SDO *srv)
         return (result);
     }
     if (width <= size) {
-        result = COObjWrBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+        result = COSdoObjWrStart(srv);
         if (result != CO_ERR_NONE) {
             srv->Node->Error = CO_ERR_SDO_WRITE;
             result           = CO_ERR_NONE;
@@ -622,10 +863,10 @@ int16_t COSdoInitDownloadBlock(CO_SDO *srv)
 
         srv->Blk.SegCnt = 0;
         srv->Blk.State  = BLK_DOWNLOAD;
-        srv->Blk.SegNum = CO_SDO_BUF_SEG;
+        srv->Blk.SegNum = srv->Blk.SegMax;
 
         CO_SET_BYTE(srv->Frm, 0xA0, 0);
-        CO_SET_LONG(srv->Frm, (uint32_t)CO_SDO_BUF_SEG, 4);
+        CO_SET_LONG(srv->Frm, (uint32_t)srv->Blk.SegNum, 4);
     } else {
         COSdoAbort(srv, CO_SDO_ERR_LEN_HIGH);
     }
@@ -647,7 +888,7 @@ int16_t COSdoEndDownloadBlock(CO_SDO *srv)
     if ((cmd & 0x01) != 0) {
         n      = (cmd & 0x1C) >> 2;
         len    = ((uint32_t)srv->Buf.Num - n);
-        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+        result = COSdoObjWrCont(srv, srv->Buf.Start, len);
         if (result != CO_ERR_NONE) {
             srv->Node->Error = CO_ERR_SDO_WRITE;
             result = -1;
@@ -686,12 +927,12 @@ int16_t COSdoDownloadBlock(CO_SDO *srv)
             srv->Buf.Num++;
         }
         srv->Blk.SegCnt++;
-        if ((srv->Blk.SegCnt == CO_SDO_BUF_SEG) ||
+        if ((srv->Blk.SegCnt == srv->Blk.SegNum) ||
              ((cmd & 0x80)   != 0             )) {
 
             CO_SET_BYTE(srv->Frm, 0xA2, 0);
             CO_SET_BYTE(srv->Frm, srv->Blk.SegCnt, 1);
-            CO_SET_BYTE(srv->Frm, CO_SDO_BUF_SEG, 2);
+            CO_SET_BYTE(srv->Frm, srv->Blk.SegNum, 2);
             for (i = 3; i <= 7; i++) {
                 CO_SET_BYTE(srv->Frm, 0, i);
             }
@@ -703,7 +944,7 @@ int16_t COSdoDownloadBlock(CO_SDO *srv)
         if (result == 0) {
             if ((cmd & 0x80) == 0) {
                 len = (uint32_t)srv->Buf.Num;
-                err = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+                err = COSdoObjWrCont(srv, srv->Buf.Start, len);
                 if (err != CO_ERR_NONE) {
                     srv->Node->Error = CO_ERR_SDO_WRITE;
                 }
@@ -716,12 +957,12 @@ int16_t COSdoDownloadBlock(CO_SDO *srv)
             srv->Blk.SegCnt |= 0x80;
         }
 
-        if (((cmd & 0x7F) == CO_SDO_BUF_SEG) ||
+        if (((cmd & 0x7F) == srv->Blk.SegNum) ||
             ((cmd & 0x80) != 0             )) {
 
             CO_SET_BYTE(srv->Frm, 0xA2, 0);
             CO_SET_BYTE(srv->Frm, srv->Blk.SegCnt & 0x7F, 1);
-            CO_SET_BYTE(srv->Frm, CO_SDO_BUF_SEG, 2);
+            CO_SET_BYTE(srv->Frm, srv->Blk.SegNum, 2);
             CO_SET_BYTE(srv->Frm, 0, 3);
             CO_SET_LONG(srv->Frm, 0, 4);
 
@@ -762,8 +1003,8 @@ int16_t COSdoInitUploadBlock(CO_SDO *srv)
         COSdoAbortReq(srv);
         return (-1);
     } else {
-        if (srv->Blk.SegNum > CO_SDO_BUF_SEG) {
-            srv->Blk.SegNum = CO_SDO_BUF_SEG;
+        if (srv->Blk.SegNum > srv->Blk.SegMax) {
+            srv->Blk.SegNum = srv->Blk.SegMax;
         }
     }
 
@@ -772,8 +1013,14 @@ int16_t COSdoInitUploadBlock(CO_SDO *srv)
 
     srv->Blk.LastValid = 0xFF;
     srv->Blk.Len       = srv->Blk.Size;
-    
-    err = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+    srv->Blk.Num       = 0;
+    srv->Blk.Pre       = 0;
+    srv->Blk.Data      = srv->Buf.Start;
+    if (((uint32_t)srv->Blk.SegMax * 14u) <= CO_SDO_BUF_BYTE) {
+        srv->Blk.Data += (uint32_t)srv->Blk.SegMax * 7u;
+    }
+
+    err = COSdoObjRdStart(srv);
     if (err != CO_ERR_NONE) {
         srv->Node->Error = CO_ERR_SDO_READ;
     }
@@ -790,35 +1037,46 @@ int16_t COSdoUploadBlock(CO_SDO *srv)
 {
     uint32_t size;
     uint32_t num;
+    uint32_t have;
+    uint32_t half;
+    uint8_t *next     =  0;
     int16_t  result   = -2;
-    int16_t  err;
     uint8_t  finished =  0;
     uint8_t  seg;
     uint8_t  len;
     uint8_t  i;
 
-    srv->Buf.Cur = srv->Buf.Start;
-    srv->Buf.Num = 7 * srv->Blk.SegNum;
+    half = (uint32_t)srv->Blk.SegMax * 7u;
     if (srv->Blk.State == BLK_REPEAT) {
-        srv->Blk.Len += srv->Buf.Num;
+        srv->Blk.Len += srv->Blk.Num;
     } else {
-        if (srv->Blk.Size > srv->Buf.Num) {
-            num = (uint32_t)srv->Buf.Num;
-            err = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, num);
-            if (err != CO_ERR_NONE) {
-                srv->Node->Error = CO_ERR_SDO_READ;
-            }
-            srv->Blk.Size -= srv->Buf.Num;
-        } else {
-            num = (uint32_t)srv->Buf.Num;
-            srv->Buf.Num   = srv->Blk.Size;
-            err = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, num);
-            if (err != CO_ERR_NONE) {
-                srv->Node->Error = CO_ERR_SDO_READ;
+        if ((half * 2u) <= CO_SDO_BUF_BYTE) {
+            /* the prefetched buffer gets the current block */
+            next          = srv->Blk.Data;
+            srv->Blk.Data = (next == srv->Buf.Start) ? &next[half] : srv->Buf.Start;
+        }
+        have = srv->Blk.Pre;
+        num  = 7 * (uint32_t)srv->Blk.SegNum;
+        if (num > srv->Blk.Len) {
+            num = srv->Blk.Len;
+        }
+        if (have < num) {
+            COSdoReadBlock(srv, &srv->Blk.Data[have], num - have);
+            have = num;
+        }
+        srv->Blk.Num = num;
+        srv->Blk.Pre = 0;
+        if (next != 0) {
+            /* keep prefetched bytes beyond a reduced block size */
+            while (have > num) {
+                have--;
+                next[have - num] = srv->Blk.Data[have];
+                srv->Blk.Pre++;
             }
-            srv->Blk.Size = 0;
         }
     }
+    srv->Buf.Cur    = srv->Blk.Data;
+    srv->Buf.Num    = srv->Blk.Num;
     srv->Blk.State  = BLK_UPLOAD;
     srv->Blk.SegCnt = 1;
     while ((srv->Blk.SegCnt <= srv->Blk.SegNum) && (finished == 0)) {
@@ -855,9 +1113,35 @@ int16_t COSdoUploadBlock(CO_SDO *srv)
         (void)COIfSend(&srv->Node->If, srv->Frm);
     }
 
+    /* prefetch next block while the current block is transmitted */
+    if (next != 0) {
+        num = 7 * (uint32_t)srv->Blk.SegNum;
+        if (num > srv->Blk.Len) {
+            num = srv->Blk.Len;
+        }
+        if (srv->Blk.Pre < num) {
+            COSdoReadBlock(srv, &next[srv->Blk.Pre], num - srv->Blk.Pre);
+            srv->Blk.Pre = num;
+        }
+    }
+
     return (result);
 }
 
+/*
+* see function definition
+*/
+void COSdoReadBlock(CO_SDO *srv, uint8_t *buf, uint32_t num)
+{
+    int16_t err;
+
+    err = COSdoObjRdCont(srv, buf, num);
+    if (err != CO_ERR_NONE) {
+        srv->Node->Error = CO_ERR_SDO_READ;
+    }
+    srv->Blk.Size -= num;
+}
+
 /*
 * see function definition
 */
@@ -897,8 +1181,8 @@ int16_t COSdoAckUploadBlock(CO_SDO *srv)
             COSdoAbortReq(srv);
             return (-1);
         } else {
-            if (srv->Blk.SegNum > CO_SDO_BUF_SEG) {
-                srv->Blk.SegNum = CO_SDO_BUF_SEG;
+            if (srv->Blk.SegNum > srv->Blk.SegMax) {
+                srv->Blk.SegNum = srv->Blk.SegMax;
             }
         }
         result = COSdoUploadBlock(srv);
@@ -926,6 +1210,7 @@ int16_t COSdoEndUploadBlock(CO_SDO *srv)
 void COSdoAbortReq(CO_SDO *srv)
 {
     srv->Obj       =  0;
+    srv->Defer     =  0;
     srv->Idx       =  0;
     srv->Sub       =  0;
     srv->Buf.Cur   =  srv->Buf.Start;
@@ -950,12 +1235,12 @@ int16_t COTypeSdoIdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_
         return (CO_ERR_BAD_ARG);
     }
     newval = *(uint32_t *)buf;
-    (void)COObjRdDirect(obj, &curval, CO_LONG);
+    (void)COObjRdDirect(obj, node, &curval, CO_LONG);
     num    = CO_GET_IDX(obj->Key) & 0x7F;
 
     if ((curval & CO_SDO_ID_OFF) == 0) {
         if ((newval & CO_SDO_ID_OFF) != 0) {
-            err = COObjWrDirect(obj, &newval, CO_LONG);
+            err = COObjWrDirect(obj, node, &newval, CO_LONG);
             if (err == CO_ERR_NONE) {
                 COSdoReset(node->Sdo, num, node);
             }
@@ -963,7 +1248,7 @@ int16_t COTypeSdoIdWrite(CO_OBJ* obj, struct CO_NODE_T *node, void *buf, uint32_
             return (CO_ERR_OBJ_RANGE);
         }
     } else {
-        err = COObjWrDirect(obj, &newval, CO_LONG);
+        err = COObjWrDirect(obj, node, &newval, CO_LONG);
     }
     if (err == CO_ERR_NONE) {
         COSdoEnable(node->Sdo, num);
@@ -28,6 +28,45 @@
 extern void COTmrLock(void);
 extern void COTmrUnlock(void);
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief LINK ACTION TO TIMER EVENT
+*
+*    This function links the action into the action list of an existing
+*    timer event. Prioritized actions are linked behind the last
+*    prioritized action, all other actions at the end of the list.
+*
+* \param tx
+*    Pointer to timer event
+*
+* \param action
+*    pointer to action info structure
+*/
+static void COTmrLink(CO_TMR_TIME *tx, CO_TMR_ACTION *action)
+{
+    CO_TMR_ACTION *prev;
+
+    if (action->Prio == 0) {
+        tx->ActionEnd->Next = action;
+        tx->ActionEnd       = action;
+    } else if (tx->Action->Prio == 0) {
+        action->Next = tx->Action;
+        tx->Action   = action;
+    } else {
+        prev = tx->Action;
+        while ((prev->Next != 0) && (prev->Next->Prio != 0)) {
+            prev = prev->Next;
+        }
+        action->Next = prev->Next;
+        prev->Next   = action;
+        if (action->Next == 0) {
+            tx->ActionEnd = action;
+        }
+    }
+}
+
 /******************************************************************************
 * FUNCTIONS
 ******************************************************************************/
@@ -40,6 +79,31 @@ int16_t COTmrCreate(CO_TMR      *tmr,
                     uint32_t     cycleTime,
                     CO_TMR_FUNC  func,
                     void        *para)
+{
+    return (COTmrAdd(tmr, startTime, cycleTime, func, para, 0));
+}
+
+/*
+* see function definition
+*/
+int16_t COTmrCreatePrio(CO_TMR      *tmr,
+                        uint32_t     startTime,
+                        uint32_t     cycleTime,
+                        CO_TMR_FUNC  func,
+                        void        *para)
+{
+    return (COTmrAdd(tmr, startTime, cycleTime, func, para, 1));
+}
+
+/*
+* see function definition
+*/
+int16_t COTmrAdd(CO_TMR      *tmr,
+                 uint32_t     startTime,
+                 uint32_t     cycleTime,
+                 CO_TMR_FUNC  func,
+                 void        *para,
+                 uint8_t      prio)
 {
     CO_TMR_ACTION *act;
     CO_TMR_TIME   *tn;
@@ -78,10 +142,12 @@ int16_t COTmrCreate(CO_TMR      *tmr,
     act->Func      = func;
     act->Para      = para;
     act->CycleTime = cycleTime;
+    act->Prio      = prio;
 
     tn = COTmrInsert(tmr, startTime, act);
     if (tn == (CO_TMR_TIME*)0) {
         act->CycleTime   = 0;
+        act->Prio        = 0;
         act->Para        = 0;
         act->Func        = (CO_TMR_FUNC)0;
         act->Next        = tmr->Acts;
@@ -175,6 +241,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
     /* delete action */
     if (del != 0) {
         del->CycleTime = 0;
+        del->Prio      = 0;
         del->Para      = 0;
         del->Func      = (CO_TMR_FUNC)0;
         del->Next      = tmr->Acts;
@@ -199,6 +266,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 int16_t COTmrService(CO_TMR *tmr)
 {
     CO_TMR_TIME *tn;
+    CO_TMR_TIME *tx;
     int16_t      result = 0;
 
     if (tmr == 0) {
@@ -207,6 +275,7 @@ int16_t COTmrService(CO_TMR *tmr)
     }
 
     COTmrLock();
+    tmr->Ticks++;
     if (tmr->Delay > 0) {
         CO_TMR_UPDATE(tmr);
         if (tmr->Delay == 0) {
@@ -219,11 +288,15 @@ int16_t COTmrService(CO_TMR *tmr)
             } else {
                 CO_TMR_STOP(tmr);
             }
+            /* keep elapsed events in order of their ticks */
             if (tmr->Elapsed == 0) {
                 tmr->Elapsed = tn;
             } else {
-                tn->Next     = tmr->Elapsed;
-                tmr->Elapsed = tn;
+                tx = tmr->Elapsed;
+                while (tx->Next != 0) {
+                    tx = tx->Next;
+                }
+                tx->Next = tn;
             }
             result = 1;
         }
@@ -268,6 +341,7 @@ void COTmrProcess(CO_TMR *tmr)
             if (act->CycleTime == 0) {
                 act->Para = 0;
                 act->Func = (CO_TMR_FUNC)0;
+                act->Prio = 0;
                 COTmrLock();
                 act->Next = tmr->Acts;
                 tmr->Acts = act;
@@ -314,6 +388,7 @@ void COTmrReset(CO_TMR *tmr)
 
     COTmrLock();
     tmr->Delay   = 0;
+    tmr->Ticks   = 0;
     tmr->Use     = 0;
     tmr->Elapsed = 0;
     tmr->Free    = tmr->TPool;
@@ -331,6 +406,7 @@ void COTmrReset(CO_TMR *tmr)
         ap->Func      = (CO_TMR_FUNC)0;
         ap->Para      = 0;
         ap->CycleTime = 0;
+        ap->Prio      = 0;
         tp->Delta     = 0;
         tp->Action    = (void*)0;
         tp->ActionEnd = (void*)0;
@@ -359,6 +435,35 @@ void COTmrClear(CO_TMR *tmr)
     node->Nmt.Tmr = -1;
     COTmrUnlock();
 
+    /* heartbeat consumer timer */
+    COTmrLock();
+    COTmrDelete(tmr, node->Nmt.HbTmr);
+    node->Nmt.HbTmr = -1;
+    COTmrUnlock();
+
+    /* nmt master slave monitor timer */
+    if (node->Nmt.Mst != 0) {
+        COTmrLock();
+        COTmrDelete(tmr, node->Nmt.Mst->Tmr);
+        node->Nmt.Mst->Tmr = -1;
+        COTmrUnlock();
+    }
+
+    /* lss master response timer */
+    if (node->Lss.Mst != 0) {
+        COTmrLock();
+        COTmrDelete(tmr, node->Lss.Mst->Tmr);
+        node->Lss.Mst->Tmr = -1;
+        COTmrUnlock();
+    }
+
+    /* emcy inhibit timer */
+    COTmrLock();
+    COTmrDelete(tmr, node->Emcy.Tx.Tmr);
+    node->Emcy.Tx.Tmr = -1;
+    node->Emcy.Tx.Num = 0;
+    COTmrUnlock();
+
     /* tpdo timer */
     for (num = 0; num < CO_TPDO_N; num++) {
         pdo = &node->TPdo[num];
@@ -438,9 +543,8 @@ CO_TMR_TIME *COTmrInsert(CO_TMR *tmr, uint32_t dTnew, CO_TMR_ACTION *action)
         if (tn == 0) {
             /* equal existing timer */
             if (dTnew == dTx) {
-                tx->ActionEnd->Next = action;
-                tx->ActionEnd       = action;
-                tn                  = tx;
+                COTmrLink(tx, action);
+                tn = tx;
 
             } else if (dTnew < dTx) {
                 /* before first timer */
@@ -38,6 +38,54 @@ static uint32_t MemNext = 0;
 /* index of next domain entry management structure */
 static uint8_t DomIdx = 0;
 
+/* allocate the stream entry management structure */
+static CO_OBJ_STREAM Stream;
+
+/* number of stream function calls */
+static uint32_t StreamCnt = 0;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* pull a chunk out of the domain memory, linked as stream context */
+static int16_t StreamRead(void *ctx, uint32_t off, uint8_t *buf, uint32_t len)
+{
+    CO_OBJ_DOM *dom = (CO_OBJ_DOM *)ctx;
+
+    if (off + len > dom->Size) {
+        return (CO_ERR_BAD_ARG);
+    }
+    while (len > 0) {
+        *buf = dom->Start[off];
+        buf++;
+        off++;
+        len--;
+    }
+    StreamCnt++;
+
+    return (CO_ERR_NONE);
+}
+
+/* push a chunk into the domain memory, linked as stream context */
+static int16_t StreamWrite(void *ctx, uint32_t off, uint8_t *buf, uint32_t len)
+{
+    CO_OBJ_DOM *dom = (CO_OBJ_DOM *)ctx;
+
+    if (off + len > dom->Size) {
+        return (CO_ERR_BAD_ARG);
+    }
+    while (len > 0) {
+        dom->Start[off] = *buf;
+        buf++;
+        off++;
+        len--;
+    }
+    StreamCnt++;
+
+    return (CO_ERR_NONE);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -127,3 +175,51 @@ void DomFill(CO_OBJ_DOM *dom, uint8_t start)
         size--;
     }
 }
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-TD-0140
+*
+* \details Allocate a test domain memory area (without object entry) and
+*          link this area as context to the stream functions. The stream
+*          management structure is added to the test object dictionary.
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ_DOM *StreamCreate(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size)
+{
+    CO_OBJ_DOM *result;
+
+    if (MemNext + size > MEM_BLOCK) {
+        size = MEM_BLOCK - MemNext;
+    }
+    Domain[DomIdx].Offset = 0;
+    Domain[DomIdx].Size   = size;
+    Domain[DomIdx].Start  = &MemBlock[MemNext];
+    MemNext += size;
+
+    DomClear(&Domain[DomIdx]);
+    result = &Domain[DomIdx];
+    DomIdx++;
+
+    Stream.Offset  = 0;
+    Stream.Size    = size;
+    Stream.Context = result;
+    Stream.Read    = StreamRead;
+    Stream.Write   = StreamWrite;
+    StreamCnt      = 0;
+    TS_ODAdd(CO_KEY(idx, sub, CO_DOMAIN|access), CO_TSTREAM,
+             (uintptr_t)&Stream);
+
+    return (result);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-TD-0150
+*
+* \details Simple getter function to retrieve the number of stream function
+*          calls.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t StreamChunks(void)
+{
+    return (StreamCnt);
+}
@@ -88,4 +88,26 @@ void DomClear(CO_OBJ_DOM *dom);
 /*---------------------------------------------------------------------------*/
 void DomFill(CO_OBJ_DOM *dom, uint8_t start);
 
+/*---------------------------------------------------------------------------*/
+/*! \brief CREATE TEST STREAM
+*
+* \details Add an object dictionary entry of type stream with the given
+*          index, subindex, access mode and size. The stream functions
+*          transfer the chunks from/to a test domain memory area, which is
+*          returned for filling and checking the stream content.
+*
+* \note    The stream shares the limits of the test domains.
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ_DOM *StreamCreate(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief GET NUMBER OF STREAM CHUNKS
+*
+* \details Return the number of stream function calls (pulled or pushed
+*          chunks) since the creation of the last test stream.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t StreamChunks(void);
+
 #endif
@@ -136,6 +136,7 @@ void TS_CreateSpec(CO_NODE *node, CO_NODE_SPEC *spec)
     spec->TmrMem   = &TmrMem[0];
     spec->TmrNum   = TS_TMR_N;
     spec->SdoBuf   = &SdoBuf[0][0];
+    spec->DictVal  = 0;
 
     SetCanIsr(TS_CAN_BUSID, TS_CanIsr);   /* connect to test can interface */
 }
@@ -77,6 +77,17 @@
                                (uint8_t)(((uint32_t)d)>>24)); \
                              RunSimCan(0, 0)
 
+#define TS_SDOC_RESP(n,c,i,s,d) SetRxFrm(0, 0, 0x580+n, 8,        \
+                               (uint8_t)(c),                    \
+                               (uint8_t)(i),                    \
+                               (uint8_t)(((uint16_t)i)>>8),   \
+                               (uint8_t)(s),                    \
+                               (uint8_t)(d),                    \
+                               (uint8_t)(((uint32_t)d)>>8),   \
+                               (uint8_t)(((uint32_t)d)>>16),  \
+                               (uint8_t)(((uint32_t)d)>>24)); \
+                             RunSimCan(0, 0)
+
 #define TS_EBLK_SEND(c,d)    SetRxFrm(0, 0, 0x601, 8,              \
                                (uint8_t)(c),                    \
                                (uint8_t)(d),                    \
@@ -121,6 +132,17 @@
                                (uint8_t)(0));       \
                              RunSimCan(0, 0)
 
+#define TS_EMCY_SEND(i,c,r)  SetRxFrm(0, 0, (i), 8,  \
+                               (uint8_t)(c),        \
+                               (uint8_t)((c)>>8),   \
+                               (uint8_t)(r),        \
+                               (uint8_t)(0x11),     \
+                               (uint8_t)(0x22),     \
+                               (uint8_t)(0x33),     \
+                               (uint8_t)(0x44),     \
+                               (uint8_t)(0x55));    \
+                             RunSimCan(0, 0)
+
 #define TS_PDO_SEND(i,a)    SetRxFrm(0, 0, (i), 8,   \
                                (uint8_t)((a)+0),  \
                                (uint8_t)((a)+1),  \
@@ -165,6 +187,17 @@
                                (uint8_t)(0));                   \
                              RunSimCan(0, 0)
 
+#define TS_LSS_FS_SEND(d,b,s,n) SetRxFrm(0, 0, 2021, 8,            \
+                               (uint8_t)(81),                   \
+                               (uint8_t)(d),                    \
+                               (uint8_t)(((uint32_t)d)>>8),   \
+                               (uint8_t)(((uint32_t)d)>>16),  \
+                               (uint8_t)(((uint32_t)d)>>24),  \
+                               (uint8_t)(b),                    \
+                               (uint8_t)(s),                    \
+                               (uint8_t)(n));                   \
+                             RunSimCan(0, 0)
+
 #define CHK_NO_ERR(n)        TS_ASSERT(CO_ERR_NONE == CONodeGetErr(n))
 
 #define CHK_ERR(n,e)         TS_ASSERT(e == CONodeGetErr(n))
@@ -181,12 +214,21 @@
                              TS_ASSERT(1          == (f).DLC);        \
                              TS_ASSERT((s)        == BYTE((f),0))
 
+#define CHK_NMT_CMD(f,c,n)   TS_ASSERT(0          == (f).Identifier); \
+                             TS_ASSERT(2          == (f).DLC);        \
+                             TS_ASSERT((c)        == BYTE((f),0));    \
+                             TS_ASSERT((n)        == BYTE((f),1))
+
 #define CHK_MODE(n,m)        TS_ASSERT((m) == CONmtGetMode(n))
 
 #define CHK_SDO0(f,c)        TS_ASSERT(0x581 == (f).Identifier); \
                              TS_ASSERT(8     == (f).DLC);        \
                              TS_ASSERT((c)   == BYTE((f),0))
 
+#define CHK_SDOC(f,n,c)      TS_ASSERT((0x600+(n)) == (f).Identifier); \
+                             TS_ASSERT(8           == (f).DLC);        \
+                             TS_ASSERT((c)         == BYTE((f),0))
+
 #define CHK_SDO0_OK(i,s)     { CO_IF_FRM f;                                                      \
                                TS_ASSERT(1     == GetFrm(0,(uint8_t*)(&f),sizeof(CO_IF_FRM)));\
                                TS_ASSERT(0x581 == (f).Identifier);                                    \
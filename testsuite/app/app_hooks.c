@@ -34,6 +34,8 @@ uint8_t      RamStorage_NodeId   = 0xFF;
 
 void TS_CallbackInit(TS_CALLBACK *cb)
 {
+    uint8_t n;
+
     RamStorage_Baudrate = 0xFFFFFFFF;
     RamStorage_NodeId = 0xFF;
 
@@ -77,7 +79,28 @@ void TS_CallbackInit(TS_CALLBACK *cb)
     cb->LssLoad_Called = 0;
     cb->LssLoad_Return = CO_ERR_NONE;
 
+    cb->ParaLoad_ArgParaGrp = 0;
     cb->ParaLoad_Called = 0;
+    cb->ParaLoad_Return = CO_ERR_NONE;
+
+    cb->ParaSave_ArgParaGrp = 0;
+    cb->ParaSave_Called = 0;
+    cb->ParaSave_Return = CO_ERR_NONE;
+
+    cb->ParaDefault_ArgParaGrp = 0;
+    cb->ParaDefault_Called = 0;
+    cb->ParaDefault_Return = CO_ERR_NONE;
+
+    cb->NmtMstEvent_ArgNodeId = 0;
+    for (n = 0; n < CO_NMT_MST_EVENT_NUM; n++) {
+        cb->NmtMstEvent_Called[n] = 0;
+    }
+
+    cb->EmcyConsEvent_ArgNodeId = 0;
+    cb->EmcyConsEvent_Called = 0;
+
+    cb->LssMstEvent_ArgEvent = CO_LSS_MST_EVENT_NUM;
+    cb->LssMstEvent_Called = 0;
 }
 
 void TS_CallbackDeInit(void)
@@ -88,6 +111,34 @@ void TS_CallbackDeInit(void)
     TsCallbacks = 0;
 }
 
+void TS_NmtMstEvent(CO_NMT_MST *mst, uint8_t nodeId, CO_NMT_MST_EVENT event)
+{
+    (void)mst;
+    if (TsCallbacks != 0) {
+        TsCallbacks->NmtMstEvent_ArgNodeId = nodeId;
+        TsCallbacks->NmtMstEvent_Called[event]++;
+    }
+}
+
+void TS_EmcyConsEvent(CO_EMCY_CONS *cons, uint8_t nodeId, CO_EMCY_PROD *prod)
+{
+    (void)cons;
+    (void)prod;
+    if (TsCallbacks != 0) {
+        TsCallbacks->EmcyConsEvent_ArgNodeId = nodeId;
+        TsCallbacks->EmcyConsEvent_Called++;
+    }
+}
+
+void TS_LssMstEvent(CO_LSS_MST *mst, CO_LSS_MST_EVENT event)
+{
+    (void)mst;
+    if (TsCallbacks != 0) {
+        TsCallbacks->LssMstEvent_ArgEvent = event;
+        TsCallbacks->LssMstEvent_Called++;
+    }
+}
+
 /******************************************************************************
 * PUBLIC CALLBACKS
 ******************************************************************************/
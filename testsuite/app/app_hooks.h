@@ -98,6 +98,15 @@ typedef struct TS_CALLBACK_T {
     CO_PARA    *ParaDefault_ArgParaGrp;
     uint32_t    ParaDefault_Called;
     int16_t     ParaDefault_Return;
+
+    uint8_t     NmtMstEvent_ArgNodeId;
+    uint32_t    NmtMstEvent_Called[CO_NMT_MST_EVENT_NUM];
+
+    uint8_t     EmcyConsEvent_ArgNodeId;
+    uint32_t    EmcyConsEvent_Called;
+
+    CO_LSS_MST_EVENT LssMstEvent_ArgEvent;
+    uint32_t    LssMstEvent_Called;
 } TS_CALLBACK;
 
 /******************************************************************************
@@ -107,4 +116,8 @@ typedef struct TS_CALLBACK_T {
 void TS_CallbackInit  (TS_CALLBACK *cb);
 void TS_CallbackDeInit(void);
 
+void TS_NmtMstEvent  (CO_NMT_MST *mst, uint8_t nodeId, CO_NMT_MST_EVENT event);
+void TS_EmcyConsEvent(CO_EMCY_CONS *cons, uint8_t nodeId, CO_EMCY_PROD *prod);
+void TS_LssMstEvent  (CO_LSS_MST *mst, CO_LSS_MST_EVENT event);
+
 #endif
@@ -111,6 +111,17 @@
     CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_R_), \
     0, (uintptr_t)(ref)
 
+/*---------------------------------------------------------------------------*/
+/*! \brief OBJECT 1015h:0 - INHIBIT TIME EMCY
+*
+* \param   ref
+*          Reference to value of 16bit inhibit time in 100 us.
+*/
+/*---------------------------------------------------------------------------*/
+#define OBJ1015_0(ref)                             \
+    CO_KEY(0x1015, 0, CO_UNSIGNED16|CO_OBJ____RW), \
+    CO_TEMCY_CFG, (uintptr_t)(ref)
+
 /*---------------------------------------------------------------------------*/
 /*! \brief OBJECT 1017h:0 - PRODUCER HEARTBEAT TIME
 *
@@ -0,0 +1,527 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BENCH_SDO_RX   0x601          /* SDO request identifier of node #1   */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t BenchRef = 0;         /* reference request latency in ns     */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0100
+*
+* \details Get a monotonic time stamp in nanoseconds. The time stamps are
+*          elapsed (wall clock) time and are not affected by adjustments of
+*          the system time.
+*/
+/*---------------------------------------------------------------------------*/
+static uint64_t BenchTime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER cnt;
+    LARGE_INTEGER frq;
+
+    (void)QueryPerformanceCounter(&cnt);
+    (void)QueryPerformanceFrequency(&frq);
+    return (((uint64_t)cnt.QuadPart / (uint64_t)frq.QuadPart) * 1000000000u +
+            (((uint64_t)cnt.QuadPart % (uint64_t)frq.QuadPart) * 1000000000u) /
+            (uint64_t)frq.QuadPart);
+#else
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0110
+*
+* \details Deliver a single SDO request frame to the node and measure the
+*          processing time of the node as request latency.
+*/
+/*---------------------------------------------------------------------------*/
+static void BenchRequest(BENCH *b, uint8_t *d)
+{
+    uint64_t start;
+    uint64_t lat;
+
+    (void)SetRxFrm(0, 0, BENCH_SDO_RX, 8,
+                   d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7]);
+    start = BenchTime();
+    (void)RunSimCan(0, 0);
+    lat   = BenchTime() - start;
+
+    b->Time += lat;
+    b->Frames++;
+    b->Requests++;
+    if (b->Num < BENCH_LAT_MAX) {
+        b->Lat[b->Num] = (uint32_t)lat;
+        b->Num++;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0120
+*
+* \details Get the next SDO response frame, sent by the node.
+*
+* \retval  =0    no response available
+* \retval  =1    response frame received
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t BenchResponse(BENCH *b, CO_IF_FRM *frm)
+{
+    int16_t result;
+
+    result = GetFrm(0, (uint8_t *)frm, sizeof(CO_IF_FRM));
+    if (result == 1) {
+        b->Frames++;
+    }
+    return (result);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0130
+*
+* \details Set the multiplexer and data of an initiate request frame.
+*/
+/*---------------------------------------------------------------------------*/
+static void BenchInitReq(uint8_t *d, uint8_t cmd, uint16_t idx, uint8_t sub, uint32_t val)
+{
+    d[0] = cmd;
+    d[1] = (uint8_t)idx;
+    d[2] = (uint8_t)(idx >> 8);
+    d[3] = sub;
+    d[4] = (uint8_t)val;
+    d[5] = (uint8_t)(val >> 8);
+    d[6] = (uint8_t)(val >> 16);
+    d[7] = (uint8_t)(val >> 24);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0140
+*
+* \details Set the command and upcounting data bytes of a segment frame.
+*/
+/*---------------------------------------------------------------------------*/
+static void BenchSegReq(uint8_t *d, uint8_t cmd, uint32_t pos)
+{
+    uint8_t i;
+
+    d[0] = cmd;
+    for (i = 0; i < 7; i++) {
+        d[1 + i] = (uint8_t)(pos + i);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0150
+*
+* \details Compare two latencies for sorting.
+*/
+/*---------------------------------------------------------------------------*/
+static int BenchCmp(const void *a, const void *b)
+{
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+
+    return ((va > vb) - (va < vb));
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0200
+*
+* \details Clear all measurements of the given benchmark.
+*/
+/*---------------------------------------------------------------------------*/
+void BenchReset(BENCH *b, const char *name, uint32_t size)
+{
+    b->Name      = name;
+    b->Size      = size;
+    b->Transfers = 0;
+    b->Frames    = 0;
+    b->Requests  = 0;
+    b->Time      = 0;
+    b->Num       = 0;
+    SimCanFlush(0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0210
+*
+* \details Perform an expedited SDO upload: one request and one response.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchExpUp(BENCH *b, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+    uint8_t   d[8];
+
+    BenchInitReq(d, 0x40, idx, sub, 0);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || ((BYTE(frm, 0) & 0xF3) != 0x43)) {
+        return (-1);
+    }
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0220
+*
+* \details Perform an expedited SDO download: one request and one response.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchExpDown(BENCH *b, uint16_t idx, uint8_t sub, uint32_t val)
+{
+    CO_IF_FRM frm;
+    uint8_t   d[8];
+    uint8_t   cmd;
+
+    cmd = (uint8_t)(0x23 | ((4 - b->Size) << 2));
+    BenchInitReq(d, cmd, idx, sub, val);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0x60)) {
+        return (-1);
+    }
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0230
+*
+* \details Perform a segmented SDO upload: initiate request, followed by a
+*          segment request for each 7 bytes of data.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchSegUp(BENCH *b, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+    uint8_t   d[8];
+    uint8_t   tbit = 0;
+
+    BenchInitReq(d, 0x40, idx, sub, 0);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0x41)) {
+        return (-1);
+    }
+    do {
+        BenchInitReq(d, (uint8_t)(0x60 | tbit), 0, 0, 0);
+        BenchRequest(b, d);
+        if ((BenchResponse(b, &frm) != 1) || ((BYTE(frm, 0) & 0xF0) != tbit)) {
+            return (-1);
+        }
+        tbit ^= 0x10;
+    } while ((BYTE(frm, 0) & 0x01) == 0);
+
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0240
+*
+* \details Perform a segmented SDO download: initiate request, followed by a
+*          segment request for each 7 bytes of data.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchSegDown(BENCH *b, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+    uint32_t  pos  = 0;
+    uint32_t  len;
+    uint8_t   d[8];
+    uint8_t   tbit = 0;
+    uint8_t   cmd;
+
+    BenchInitReq(d, 0x21, idx, sub, b->Size);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0x60)) {
+        return (-1);
+    }
+    while (pos < b->Size) {
+        len = b->Size - pos;
+        cmd = tbit;
+        if (len <= 7) {
+            cmd |= (uint8_t)(((7 - len) << 1) | 0x01);
+        }
+        BenchSegReq(d, cmd, pos);
+        BenchRequest(b, d);
+        if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != (0x20 | tbit))) {
+            return (-1);
+        }
+        tbit ^= 0x10;
+        pos  += 7;
+    }
+
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0250
+*
+* \details Perform a SDO block upload: initiate and start requests, followed
+*          by an acknowledge for each received block and the end response.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchBlkUp(BENCH *b, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+    uint8_t   d[8];
+    uint8_t   seq = 0;
+
+    BenchInitReq(d, 0xA0, idx, sub, BENCH_BLK_SEG);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0xC2)) {
+        return (-1);
+    }
+    BenchInitReq(d, 0xA3, 0, 0, 0);
+    BenchRequest(b, d);
+    for (;;) {
+        while (BenchResponse(b, &frm) == 1) {
+            seq = BYTE(frm, 0);
+        }
+        if ((seq == 0) || ((seq & 0x80) != 0)) {
+            break;
+        }
+        BenchInitReq(d, 0xA2, 0, 0, 0);
+        d[1] = seq;
+        d[2] = BENCH_BLK_SEG;
+        BenchRequest(b, d);
+        seq  = 0;
+    }
+    if (seq == 0) {
+        return (-1);
+    }
+    BenchInitReq(d, 0xA2, 0, 0, 0);
+    d[1] = (uint8_t)(seq & 0x7F);
+    d[2] = BENCH_BLK_SEG;
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || ((BYTE(frm, 0) & 0xE3) != 0xC1)) {
+        return (-1);
+    }
+    BenchInitReq(d, 0xA1, 0, 0, 0);
+    BenchRequest(b, d);
+
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0260
+*
+* \details Perform a SDO block download: initiate request, the segments of
+*          each block and the end request.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchBlkDown(BENCH *b, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+    uint32_t  pos = 0;
+    uint8_t   d[8];
+    uint8_t   blk;
+    uint8_t   seq;
+    uint8_t   cmd;
+
+    BenchInitReq(d, 0xC2, idx, sub, b->Size);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0xA0)) {
+        return (-1);
+    }
+    blk = BYTE(frm, 4);
+    while (pos < b->Size) {
+        seq = 1;
+        while ((seq <= blk) && (pos < b->Size)) {
+            cmd = seq;
+            if ((b->Size - pos) <= 7) {
+                cmd |= 0x80;
+            }
+            BenchSegReq(d, cmd, pos);
+            BenchRequest(b, d);
+            pos += 7;
+            seq++;
+        }
+        if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0xA2)) {
+            return (-1);
+        }
+        blk = BYTE(frm, 2);
+    }
+    cmd = (uint8_t)(0xC1 | ((pos - b->Size) << 2));
+    BenchInitReq(d, cmd, 0, 0, 0);
+    BenchRequest(b, d);
+    if ((BenchResponse(b, &frm) != 1) || (BYTE(frm, 0) != 0xA1)) {
+        return (-1);
+    }
+
+    b->Transfers++;
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0270
+*
+* \details Measure the reference request latency: the median latency of
+*          BENCH_LOOPS expedited uploads of the device type (1000h:00).
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchCalibrate(void)
+{
+    BENCH    *b;
+    CO_NODE   node;
+    uint32_t  n;
+
+    b = (BENCH *)malloc(sizeof(BENCH));
+    if (b == 0) {
+        return (0);
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    BenchReset(b, "reference", 4);
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        (void)BenchExpUp(b, 0x1000, 0);
+    }
+    BenchRef = 0;
+    if (b->Transfers == BENCH_LOOPS) {
+        BenchRef = BenchLatency(b, 50);
+    }
+    free(b);
+    return (BenchRef);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0280
+*
+* \details Get the reference request latency of the last calibration.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchReference(void)
+{
+    return (BenchRef);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0300
+*
+* \details Calculate the processing time of the node per transfered
+*          kilobyte.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchNsPerKb(BENCH *b)
+{
+    uint64_t bytes;
+
+    bytes = (uint64_t)b->Size * b->Transfers;
+    if (bytes == 0) {
+        return (0);
+    }
+    return ((uint32_t)((b->Time * 1024u) / bytes));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0305
+*
+* \details Calculate the processing time of the node per CAN frame on the
+*          bus.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchNsPerFrm(BENCH *b)
+{
+    if (b->Frames == 0) {
+        return (0);
+    }
+    return ((uint32_t)(b->Time / b->Frames));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0310
+*
+* \details Calculate the given percentile of the recorded request latencies
+*          with the nearest rank method.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchLatency(BENCH *b, uint8_t pct)
+{
+    uint32_t rank;
+
+    if (b->Num == 0) {
+        return (0);
+    }
+    qsort(b->Lat, b->Num, sizeof(uint32_t), BenchCmp);
+    rank = ((uint32_t)pct * b->Num + 99u) / 100u;
+    if (rank > 0) {
+        rank--;
+    }
+    return (b->Lat[rank]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-BENCH-0320
+*
+* \details Print a single report line with the measurements of the given
+*          benchmark:
+*          - frames per transfer
+*          - processing time per kilobyte in ns
+*          - request latency percentiles p50 / p90 / p99 in ns
+*/
+/*---------------------------------------------------------------------------*/
+void BenchReport(BENCH *b)
+{
+    uint32_t frames = 0;
+
+    if (b->Transfers > 0) {
+        frames = b->Frames / b->Transfers;
+    }
+    TS_Printf("BENCH %-14s %5u byte: %4u frm/xfer %9u ns/kB  p50 %6u  p90 %6u  p99 %6u ns\n",
+              (char *)b->Name,
+              (unsigned int)b->Size,
+              (unsigned int)frames,
+              (unsigned int)BenchNsPerKb(b),
+              (unsigned int)BenchLatency(b, 50),
+              (unsigned int)BenchLatency(b, 90),
+              (unsigned int)BenchLatency(b, 99));
+}
@@ -0,0 +1,316 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef _BENCH_ENV_H_
+#define _BENCH_ENV_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "app_env.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/* number of repeated transfers per benchmark */
+#ifndef BENCH_LOOPS
+#define BENCH_LOOPS         200
+#endif
+
+/* maximal number of recorded request latencies per benchmark */
+#ifndef BENCH_LAT_MAX
+#define BENCH_LAT_MAX       8192
+#endif
+
+/* The regression limits are relative to the reference request latency (see
+ * BenchCalibrate()), which is measured on the same host within the same run.
+ * Measured ratios are up to 1 (time per frame) and up to 5 (p99 latency per
+ * response frame); the limits include a margin for noisy build hosts.
+ */
+
+/* regression limit: maximal processing time per frame in reference latencies */
+#ifndef BENCH_LIMIT_FRM
+#define BENCH_LIMIT_FRM     4
+#endif
+
+/* regression limit: maximal 99th percentile request latency per response
+ * frame in reference latencies */
+#ifndef BENCH_LIMIT_P99
+#define BENCH_LIMIT_P99     16
+#endif
+
+/* SDO block size, requested by the benchmark client */
+#define BENCH_BLK_SEG       127
+
+/******************************************************************************
+* PUBLIC MACROS
+******************************************************************************/
+
+#define CHK_BENCH_FRAMES(b,n)  TS_ASSERT((b)->Frames <= ((n) * (b)->Transfers))
+
+#define CHK_BENCH_LIMITS(b,r)  TS_ASSERT(BenchNsPerFrm(b) <=                            \
+                                         BENCH_LIMIT_FRM * BenchReference());         \
+                               TS_ASSERT(BenchLatency((b), 99) <=                     \
+                                         (r) * BENCH_LIMIT_P99 * BenchReference())
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief BENCHMARK RESULT
+*
+*    This structure holds the collected measurements of a single benchmark.
+*/
+typedef struct BENCH_T {
+    const char *Name;                 /*!< name of benchmark                 */
+    uint32_t    Size;                 /*!< transfered bytes per transfer     */
+    uint32_t    Transfers;            /*!< number of completed transfers     */
+    uint32_t    Frames;               /*!< number of CAN frames on bus       */
+    uint32_t    Requests;             /*!< number of processed requests      */
+    uint64_t    Time;                 /*!< processing time in ns             */
+    uint32_t    Num;                  /*!< number of recorded latencies      */
+    uint32_t    Lat[BENCH_LAT_MAX];   /*!< recorded request latencies in ns  */
+
+} BENCH;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief RESET BENCHMARK
+*
+* \details Clear all measurements of the given benchmark.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   name
+*          name of benchmark in report
+*
+* \param   size
+*          transfered bytes per transfer
+*/
+/*---------------------------------------------------------------------------*/
+void BenchReset(BENCH *b, const char *name, uint32_t size);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief EXPEDITED UPLOAD
+*
+* \details Perform an expedited SDO upload of the given object entry.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchExpUp(BENCH *b, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief EXPEDITED DOWNLOAD
+*
+* \details Perform an expedited SDO download of the given object entry.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \param   val
+*          value to download
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchExpDown(BENCH *b, uint16_t idx, uint8_t sub, uint32_t val);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief SEGMENTED UPLOAD
+*
+* \details Perform a segmented SDO upload of the given object entry.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchSegUp(BENCH *b, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief SEGMENTED DOWNLOAD
+*
+* \details Perform a segmented SDO download of the given object entry with
+*          upcounting byte values.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchSegDown(BENCH *b, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief BLOCK UPLOAD
+*
+* \details Perform a SDO block upload of the given object entry.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchBlkUp(BENCH *b, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief BLOCK DOWNLOAD
+*
+* \details Perform a SDO block download of the given object entry with
+*          upcounting byte values.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   idx
+*          object entry index
+*
+* \param   sub
+*          object entry subindex
+*
+* \retval  =0    transfer completed
+* \retval  <0    transfer aborted
+*/
+/*---------------------------------------------------------------------------*/
+int16_t BenchBlkDown(BENCH *b, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief CALIBRATE REFERENCE
+*
+* \details Measure the reference request latency with expedited uploads of
+*          a newly created node. The reference scales the regression limits
+*          to the speed of the host.
+*
+* \return  reference request latency in ns (0 on failure)
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchCalibrate(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REFERENCE LATENCY
+*
+* \details Get the reference request latency of the last calibration.
+*
+* \return  reference request latency in ns
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchReference(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief PROCESSING TIME PER KILOBYTE
+*
+* \details Calculate the processing time of the node per transfered
+*          kilobyte. The processing time is the elapsed time of the
+*          monotonic clock while the node processes the requests.
+*
+* \param   b
+*          benchmark result structure
+*
+* \return  processing time in ns per kilobyte
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchNsPerKb(BENCH *b);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief PROCESSING TIME PER FRAME
+*
+* \details Calculate the processing time of the node per CAN frame on the
+*          bus.
+*
+* \param   b
+*          benchmark result structure
+*
+* \return  processing time in ns per frame
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchNsPerFrm(BENCH *b);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQUEST LATENCY PERCENTILE
+*
+* \details Calculate the given percentile of the recorded request latencies.
+*
+* \param   b
+*          benchmark result structure
+*
+* \param   pct
+*          percentile (0..100)
+*
+* \return  request latency in ns
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t BenchLatency(BENCH *b, uint8_t pct);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REPORT BENCHMARK
+*
+* \details Print a single report line with the measurements of the given
+*          benchmark.
+*
+* \param   b
+*          benchmark result structure
+*/
+/*---------------------------------------------------------------------------*/
+void BenchReport(BENCH *b);
+
+#endif  /* _BENCH_ENV_H_ */
@@ -0,0 +1,261 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "bench_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BENCH_SIZES       3                          /* number of domain sizes   */
+
+#define BENCH_SEGS(s)     (((s) + 6) / 7)            /* segments of transfer     */
+#define BENCH_BLKS(s)     ((BENCH_SEGS(s) + BENCH_BLK_SEG - 1) / BENCH_BLK_SEG)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef int16_t (*BENCH_FUNC)(BENCH *b, uint16_t idx, uint8_t sub);
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* domain sizes: single segment, single block and multiple blocks */
+static const uint32_t BenchSize[BENCH_SIZES] = { 7, 128, 1000 };
+
+/* measurements of the running benchmark */
+static BENCH Bench;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief BENCHMARK DOMAIN TRANSFER
+*
+*         Create a node with a domain of the given size and perform BENCH_LOOPS transfers with
+*         the given client function.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+static void BenchDomain(const char *name, uint32_t size, BENCH_FUNC func)
+{
+    CO_NODE      node;
+    CO_OBJ_DOM  *dom;
+    uint32_t     n;
+    int16_t      err;
+    uint16_t     idx  = 0x2100;
+    uint8_t      sub  = 1;
+
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node);
+
+    BenchReset(&Bench, name, size);
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        err = func(&Bench, idx, sub);
+        TS_ASSERT(0 == err);
+    }
+    BenchReport(&Bench);
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the expedited upload of a 4 byte parameter.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_ExpUp)
+{
+    CO_NODE  node;
+    uint32_t val  = 0x12345678;
+    uint32_t n;
+    int16_t  err;
+    uint16_t idx  = 0x2000;
+    uint8_t  sub  = 1;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+    BenchReset(&Bench, "exp_up", 4);
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        err = BenchExpUp(&Bench, idx, sub);
+        TS_ASSERT(0 == err);
+    }
+    BenchReport(&Bench);
+
+    CHK_BENCH_FRAMES(&Bench, 2);
+    CHK_BENCH_LIMITS(&Bench, 1);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the expedited download of a 4 byte parameter.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_ExpDown)
+{
+    CO_NODE  node;
+    uint32_t val  = 0;
+    uint32_t n;
+    int16_t  err;
+    uint16_t idx  = 0x2000;
+    uint8_t  sub  = 1;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+    BenchReset(&Bench, "exp_down", 4);
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        err = BenchExpDown(&Bench, idx, sub, n);
+        TS_ASSERT(0 == err);
+    }
+    BenchReport(&Bench);
+
+    TS_ASSERT((BENCH_LOOPS - 1) == val);
+    CHK_BENCH_FRAMES(&Bench, 2);
+    CHK_BENCH_LIMITS(&Bench, 1);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the segmented upload of domains with varying sizes.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_SegUp)
+{
+    uint32_t size;
+    uint8_t  n;
+
+    for (n = 0; n < BENCH_SIZES; n++) {
+        size = BenchSize[n];
+        BenchDomain("seg_up", size, BenchSegUp);
+        CHK_BENCH_FRAMES(&Bench, 2 + 2 * BENCH_SEGS(size));
+        CHK_BENCH_LIMITS(&Bench, 1);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the segmented download of domains with varying sizes.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_SegDown)
+{
+    uint32_t size;
+    uint8_t  n;
+
+    for (n = 0; n < BENCH_SIZES; n++) {
+        size = BenchSize[n];
+        BenchDomain("seg_down", size, BenchSegDown);
+        CHK_BENCH_FRAMES(&Bench, 2 + 2 * BENCH_SEGS(size));
+        CHK_BENCH_LIMITS(&Bench, 1);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the block upload of domains with varying sizes.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_BlkUp)
+{
+    uint32_t size;
+    uint8_t  n;
+
+    for (n = 0; n < BENCH_SIZES; n++) {
+        size = BenchSize[n];
+        BenchDomain("blk_up", size, BenchBlkUp);
+        CHK_BENCH_FRAMES(&Bench, 5 + BENCH_SEGS(size) + BENCH_BLKS(size));
+        CHK_BENCH_LIMITS(&Bench, BENCH_BLK_SEG);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This benchmark measures the block download of domains with varying sizes.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Bench_BlkDown)
+{
+    uint32_t size;
+    uint8_t  n;
+
+    for (n = 0; n < BENCH_SIZES; n++) {
+        size = BenchSize[n];
+        BenchDomain("blk_down", size, BenchBlkDown);
+        CHK_BENCH_FRAMES(&Bench, 4 + BENCH_SEGS(size) + BENCH_BLKS(size));
+        CHK_BENCH_LIMITS(&Bench, 1);
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_BENCH_SDOS()
+{
+    TS_Begin(__FILE__);
+
+    TS_Printf("BENCH reference: %u ns\n", (unsigned int)BenchCalibrate());
+
+    TS_RUNNER(TS_Bench_ExpUp);
+    TS_RUNNER(TS_Bench_ExpDown);
+    TS_RUNNER(TS_Bench_SegUp);
+    TS_RUNNER(TS_Bench_SegDown);
+    TS_RUNNER(TS_Bench_BlkUp);
+    TS_RUNNER(TS_Bench_BlkDown);
+
+    TS_End();
+}
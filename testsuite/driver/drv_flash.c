@@ -0,0 +1,151 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "drv_flash.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static SIM_FLASH SimFlash = { 0 };
+
+/******************************************************************************
+* PRIVATE MACROS
+******************************************************************************/
+
+#define ASSERT_VALID_RANGE(addr,len)  do {                           \
+    if ((SimFlash.File == 0) ||                                      \
+        ((addr) + (len) > SimFlash.SecSize * SimFlash.SecNum)) {     \
+        return (-1);                                                 \
+    } } while(0)
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+int16_t SimFlashRead(uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    ASSERT_VALID_RANGE(addr, len);
+
+    if (fseek(SimFlash.File, (long)addr, SEEK_SET) != 0) {
+        return (-1);
+    }
+    if (fread(buf, 1, len, SimFlash.File) != len) {
+        return (-1);
+    }
+    return (0);
+}
+
+int16_t SimFlashProg(uint32_t addr, const uint8_t *buf, uint32_t len)
+{
+    uint8_t  cell;
+    uint32_t n;
+
+    ASSERT_VALID_RANGE(addr, len);
+
+    for (n = 0; n < len; n++) {
+        /* simulated power cut: the remaining bytes stay unprogrammed */
+        if (SimFlash.Cut == 0) {
+            return (-1);
+        }
+        if (SimFlash.Cut != SIM_FLASH_NO_CUT) {
+            SimFlash.Cut--;
+        }
+        if (SimFlashRead(addr + n, &cell, 1) < 0) {
+            return (-1);
+        }
+        /* NOR flash: programming clears bits only */
+        if ((cell & buf[n]) != buf[n]) {
+            return (-1);
+        }
+        cell &= buf[n];
+        if (fseek(SimFlash.File, (long)(addr + n), SEEK_SET) != 0) {
+            return (-1);
+        }
+        if (fwrite(&cell, 1, 1, SimFlash.File) != 1) {
+            return (-1);
+        }
+        SimFlash.Prog++;
+    }
+    return (0);
+}
+
+int16_t SimFlashErase(uint8_t sec)
+{
+    uint8_t  cell = 0xFF;
+    uint32_t n;
+
+    if ((SimFlash.File == 0) || (sec >= SimFlash.SecNum) || (SimFlash.Cut == 0)) {
+        return (-1);
+    }
+    if (fseek(SimFlash.File, (long)sec * (long)SimFlash.SecSize, SEEK_SET) != 0) {
+        return (-1);
+    }
+    for (n = 0; n < SimFlash.SecSize; n++) {
+        if (fwrite(&cell, 1, 1, SimFlash.File) != 1) {
+            return (-1);
+        }
+    }
+    SimFlash.Erase[sec]++;
+    return (0);
+}
+
+SIM_FLASH *SimFlashInit(uint32_t secSize, uint8_t secNum)
+{
+    uint8_t  cell = 0xFF;
+    uint32_t n;
+
+    if (SimFlash.File != 0) {
+        (void)fclose(SimFlash.File);
+    }
+    SimFlash.File    = tmpfile();
+    SimFlash.SecSize = secSize;
+    SimFlash.SecNum  = (secNum > SIM_FLASH_SEC_N) ? SIM_FLASH_SEC_N : secNum;
+    SimFlash.Cut     = SIM_FLASH_NO_CUT;
+    SimFlash.Prog    = 0;
+    for (n = 0; n < SIM_FLASH_SEC_N; n++) {
+        SimFlash.Erase[n] = 0;
+    }
+    if (SimFlash.File == 0) {
+        return (0);
+    }
+    for (n = 0; n < secSize * SimFlash.SecNum; n++) {
+        (void)fwrite(&cell, 1, 1, SimFlash.File);
+    }
+    return (&SimFlash);
+}
+
+void SimFlashCut(uint32_t bytes)
+{
+    SimFlash.Cut = bytes;
+}
+
+uint32_t SimFlashWear(void)
+{
+    uint32_t max = 0;
+    uint8_t  n;
+
+    for (n = 0; n < SimFlash.SecNum; n++) {
+        if (SimFlash.Erase[n] > max) {
+            max = SimFlash.Erase[n];
+        }
+    }
+    return (max);
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef _DRV_FLASH_H_
+#define _DRV_FLASH_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/* simulation supports up to 32 flash sectors */
+#define SIM_FLASH_SEC_N             32
+
+/* the programming is cut off after the given number of bytes */
+#define SIM_FLASH_NO_CUT            0xFFFFFFFFu
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+typedef struct SIM_FLASH_T {
+    FILE       *File;
+    uint32_t    SecSize;
+    uint8_t     SecNum;
+    uint32_t    Cut;
+    uint32_t    Prog;
+    uint32_t    Erase[SIM_FLASH_SEC_N];
+} SIM_FLASH;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/* Device Driver Functions:
+*  - Flash access functions as defined in co_para_log.h
+*/
+int16_t     SimFlashRead    (uint32_t addr, uint8_t *buf, uint32_t len);
+int16_t     SimFlashProg    (uint32_t addr, const uint8_t *buf, uint32_t len);
+int16_t     SimFlashErase   (uint8_t sec);
+
+/* Flash Memory Simulation Interface (for interfacing with automated tests only) */
+SIM_FLASH  *SimFlashInit    (uint32_t secSize, uint8_t secNum);
+void        SimFlashCut     (uint32_t bytes);
+uint32_t    SimFlashWear    (void);
+
+#endif /* _DRV_FLASH_H_ */
@@ -0,0 +1,80 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "drv_shm.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_PIMG_MEM *SimShmMap(int fd)
+{
+    void *mem;
+
+    if (fd < 0) {
+        return (0);
+    }
+    mem = mmap(0, sizeof(CO_PIMG_MEM), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (mem == MAP_FAILED) {
+        return (0);
+    }
+    return ((CO_PIMG_MEM *)mem);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+CO_PIMG_MEM *SimShmCreate(const char *name)
+{
+    int fd;
+
+    fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        return (0);
+    }
+    if (ftruncate(fd, (off_t)sizeof(CO_PIMG_MEM)) != 0) {
+        (void)close(fd);
+        return (0);
+    }
+    return (SimShmMap(fd));
+}
+
+CO_PIMG_MEM *SimShmAttach(const char *name)
+{
+    return (SimShmMap(shm_open(name, O_RDWR, 0)));
+}
+
+void SimShmDetach(CO_PIMG_MEM *mem)
+{
+    if (mem != 0) {
+        (void)munmap((void *)mem, sizeof(CO_PIMG_MEM));
+    }
+}
+
+void SimShmRemove(const char *name)
+{
+    (void)shm_unlink(name);
+}
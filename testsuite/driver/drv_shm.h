@@ -0,0 +1,38 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef _DRV_SHM_H_
+#define _DRV_SHM_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/* Process Image Memory Functions:
+*  - POSIX shared memory object with the layout CO_PIMG_MEM (see co_pimg.h)
+*/
+CO_PIMG_MEM *SimShmCreate   (const char *name);
+CO_PIMG_MEM *SimShmAttach   (const char *name);
+void         SimShmDetach   (CO_PIMG_MEM *mem);
+void         SimShmRemove   (const char *name);
+
+#endif /* _DRV_SHM_H_ */
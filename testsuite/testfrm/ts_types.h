@@ -65,6 +65,18 @@ typedef unsigned int        uintptr_t;
 #define TEST_SECTION_END_ALLOC(TEST_SECTION_START)    __declspec(allocate(".test$z")) const TS_INFOFUNC TEST_SECTION_END   = (TS_INFOFUNC)0;
 #define STRUCT_PACKED_PRE                             __pragma(pack(push, 1))
 #define STRUCT_PACKED_SUF                             __pragma(pack(pop))
+#elif defined(__GNUC__)
+#define TEST_SECTION_PRE
+#define TEST_SECTION_DEF
+#define TEST_SECTION_SUF                              __attribute__((used, section("ts_test")))
+#define TEST_SECTION_START                            __start_ts_test
+#define TEST_SECTION_END                              __stop_ts_test
+#define TEST_SECTION_START_DEF
+#define TEST_SECTION_START_ALLOC(TEST_SECTION_START)  extern const TS_INFOFUNC TEST_SECTION_START;
+#define TEST_SECTION_END_DEF
+#define TEST_SECTION_END_ALLOC(TEST_SECTION_START)    extern const TS_INFOFUNC TEST_SECTION_END;
+#define STRUCT_PACKED_PRE
+#define STRUCT_PACKED_SUF                             __attribute__((packed))
 #else
 #error "Adjust some compiler specific settings in ts.types.h"
 #endif
@@ -0,0 +1,1148 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \addtogroup core_dict
+* \details    This test suite checks the import and export of parameter images into and out of
+*             the object dictionary and the access to 64bit values.
+*
+* #### Test Definition
+*
+* test-function                  | description                                          | type
+* ------------------------------ | ---------------------------------------------------- | ----
+* \ref TS_DictImport_Params      | import byte, word, long and node-id parameters       | F
+* \ref TS_DictImport_Domain      | import a domain with more than 4 bytes               | F
+* \ref TS_DictImport_ReadOnly    | stop import at a read-only object                    | R
+* \ref TS_DictImport_BadSize     | stop import at a record with wrong length            | R
+* \ref TS_DictImport_NotExist    | stop import at a not existing object                 | R
+* \ref TS_DictImport_Truncated   | stop import at a truncated record                    | R
+* \ref TS_DictExport_RoundTrip   | export index range and import the image again        | F
+* \ref TS_DictExport_BufSmall    | export into a too small image buffer                 | R
+* \ref TS_DictImport_Quad        | import a 64bit value                                 | F
+* \ref TS_Dict_QuadAccess        | read and write 64bit integer and REAL64 values       | F
+* \ref TS_Dict_QuadBadSize       | 64bit access to a 32bit object                       | R
+* \ref TS_DictGen_Init           | initialize node with a generated object dictionary   | F
+* \ref TS_DictGen_Pdo            | PDO exchange with a generated object dictionary      | F
+* \ref TS_DictGen_Default        | restore the generated default parameter values       | F
+* \ref TS_DictVal_Direct         | direct objects of a const dictionary in value arrays | F
+* \ref TS_DictSub_Change         | notify changed objects within the subscribed range   | F
+* \ref TS_DictSub_Sdo            | notify objects changed by SDO download               | F
+* \ref TS_DictSub_Typed          | notify value changes of objects with a type          | F
+*
+* Type Legend: R = Robustness Test, F = Functional Test
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "def_suite.h"
+#if TS_APP_GEN > 0
+#include "app_gen.h"
+#endif
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TS_IMG_MAX   128                             /* size of test parameter image             */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t  TsImg[TS_IMG_MAX];
+static uint32_t TsSubNum;
+static uint32_t TsSubKey;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* append a record with the given value (little endian) to the test parameter image */
+static uint32_t TS_ImgAdd(uint32_t pos, uint16_t idx, uint8_t sub, uint32_t len, uint32_t val)
+{
+    uint32_t n;
+
+    TsImg[pos++] = (uint8_t)(idx     );
+    TsImg[pos++] = (uint8_t)(idx >> 8);
+    TsImg[pos++] = sub;
+    TsImg[pos++] = (uint8_t)(len      );
+    TsImg[pos++] = (uint8_t)(len >>  8);
+    TsImg[pos++] = (uint8_t)(len >> 16);
+    TsImg[pos++] = (uint8_t)(len >> 24);
+    for (n = 0; n < len; n++) {
+        TsImg[pos++] = (uint8_t)(val >> (8 * (n & 3)));
+    }
+
+    return (pos);
+}
+
+/* change subscription callback: count the notifications and remember the last key */
+static void TS_SubFunc(CO_DICT_SUB *sub, CO_NODE *node, CO_OBJ *obj)
+{
+    (void)sub;
+    (void)node;
+
+    TsSubNum++;
+    TsSubKey = CO_GET_DEV(obj->Key);
+}
+
+/* user type with the value behind a header: the object data is not the value */
+typedef struct TS_TYPED_T {
+    uint32_t Hdr;
+    uint32_t Val;
+} TS_TYPED;
+
+static int16_t TS_TypedRead(CO_OBJ *obj, CO_NODE *node, void *buf, uint32_t len)
+{
+    (void)node;
+    if (len != CO_LONG) {
+        return (CO_ERR_TYPE_RD);
+    }
+    *((uint32_t *)buf) = ((TS_TYPED *)obj->Data)->Val;
+    return (CO_ERR_NONE);
+}
+
+static int16_t TS_TypedWrite(CO_OBJ *obj, CO_NODE *node, void *buf, uint32_t len)
+{
+    (void)node;
+    if (len != CO_LONG) {
+        return (CO_ERR_TYPE_WR);
+    }
+    ((TS_TYPED *)obj->Data)->Val = *((uint32_t *)buf);
+    return (CO_ERR_NONE);
+}
+
+static const CO_OBJ_TYPE TsTyped = { 0, 0, TS_TypedRead, TS_TypedWrite };
+
+#if TS_APP_GEN > 0
+/* create and start a node with the generated object dictionary and default parameters */
+static void TS_CreateGenNode(CO_NODE *node)
+{
+    CO_NODE_SPEC spec;
+
+    memcpy(&AppGenPara, &AppGenParaDef, sizeof(AppGenPara));
+    AppGenVar.Obj2000_01 = 0;
+    AppGenVar.Obj2000_02 = 0;
+
+    TS_CreateSpec(node, &spec);
+    spec.Dict    = APP_GEN_DICT;
+    spec.DictLen = APP_GEN_DICT_N + 1;
+
+    CONodeInit(node, &spec);
+    CONodeStart(node);
+
+    SimCanFlush(0);                                   /* remove all simulated CAN messages        */
+}
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import parameters of different sizes
+*
+* \details  This test checks, that an image with byte, word, long and node-id dependent
+*           parameters is written into the object dictionary.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including parameters of each size.
+*           2. Prepare parameter image with a record for each parameter.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that all records are written
+*           2. Check, that the parameters hold the values of the image
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_Params)
+{
+    CO_NODE   node;
+    uint8_t   val1 = 0;
+    uint16_t  val2 = 0;
+    uint32_t  val4 = 0;
+    uint32_t  valn = 0;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    TS_ODAdd(CO_KEY(0x2500, 3, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val4);
+    TS_ODAdd(CO_KEY(0x2501, 0, CO_UNSIGNED32|CO_OBJ__N_RW), 0, (uintptr_t)&valn);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0,   0x2500, 1, 1, 0x11);
+    len = TS_ImgAdd(len, 0x2500, 2, 2, 0x2221);
+    len = TS_ImgAdd(len, 0x2500, 3, 4, 0x44434241);
+    len = TS_ImgAdd(len, 0x2501, 0, 4, 0x00000180 + node.NodeId);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(4 == num);
+    TS_ASSERT(0x11 == val1);
+    TS_ASSERT(0x2221 == val2);
+    TS_ASSERT(0x44434241 == val4);
+    TS_ASSERT(0x00000180 == valn);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a domain
+*
+* \details  This test checks, that an image record with more than 4 bytes is written into a
+*           domain of the object dictionary.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a domain with 10 bytes.
+*           2. Prepare parameter image with a record for the domain.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that the record is written
+*           2. Check, that the domain holds the bytes of the image
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_Domain)
+{
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    len;
+    uint32_t    num;
+    uint32_t    n;
+    int16_t     err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(0x2520, 1, CO_OBJ____RW, 10);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0, 0x2520, 1, 10, 0x03020100);
+    for (n = 0; n < 10; n++) {
+        TsImg[CO_DICT_IMG_HDR + n] = (uint8_t)n;
+    }
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(1 == num);
+    CHK_DOM_FULL(dom, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a record for a read-only object
+*
+* \details  This test checks, that the import stops at a record addressing a read-only object
+*           (same as the SDO download) and the records in front of this record are written.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a parameter and a constant.
+*           2. Prepare parameter image with the parameter, the constant and the parameter.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that the import is rejected with access error
+*           2. Check, that only the first record is written
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_ReadOnly)
+{
+    CO_NODE   node;
+    uint16_t  val  = 0;
+    uint16_t  cnst = 0x1234;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED16|CO_OBJ____R_), 0, (uintptr_t)&cnst);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0,   0x2500, 1, 2, 0x1111);
+    len = TS_ImgAdd(len, 0x2500, 2, 2, 0x2222);
+    len = TS_ImgAdd(len, 0x2500, 1, 2, 0x3333);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_OBJ_ACC == err);
+    TS_ASSERT(1 == num);
+    TS_ASSERT(0x1111 == val);
+    TS_ASSERT(0x1234 == cnst);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a record with a wrong length
+*
+* \details  This test checks, that the import stops at a record with a length, which is not
+*           matching the object size (same as the SDO download).
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a word parameter.
+*           2. Prepare parameter image with a long record for the parameter.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that the import is rejected with size error
+*           2. Check, that the parameter is not changed
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_BadSize)
+{
+    CO_NODE   node;
+    uint16_t  val  = 0x1234;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0, 0x2500, 1, 4, 0x11112222);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_OBJ_SIZE == err);
+    TS_ASSERT(0 == num);
+    TS_ASSERT(0x1234 == val);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a record for a not existing object
+*
+* \details  This test checks, that the import stops at a record addressing an object, which is
+*           not existing in the object dictionary.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a parameter.
+*           2. Prepare parameter image with the parameter and a not existing object.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that the import is rejected with not found error
+*           2. Check, that only the first record is written
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_NotExist)
+{
+    CO_NODE   node;
+    uint32_t  val  = 0;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0,   0x2500, 1, 4, 0x11223344);
+    len = TS_ImgAdd(len, 0x2500, 2, 4, 0x55667788);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_OBJ_NOT_FOUND == err);
+    TS_ASSERT(1 == num);
+    TS_ASSERT(0x11223344 == val);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a truncated image
+*
+* \details  This test checks, that the import stops at a record, which is not completely
+*           within the given image length.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including two parameters.
+*           2. Prepare parameter image with both parameters.
+*
+* ####      Test Steps
+*           1. Import the parameter image without the last value byte
+*
+* ####      Test Checks
+*           1. Check, that the import is rejected with bad argument
+*           2. Check, that only the first record is written
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_Truncated)
+{
+    CO_NODE   node;
+    uint32_t  val1 = 0;
+    uint32_t  val2 = 0;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0,   0x2500, 1, 4, 0x11223344);
+    len = TS_ImgAdd(len, 0x2500, 2, 4, 0x55667788);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len - 1, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_BAD_ARG == err);
+    TS_ASSERT(1 == num);
+    TS_ASSERT(0x11223344 == val1);
+    TS_ASSERT(0 == val2);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Export and import an index range
+*
+* \details  This test checks, that the exported image contains all readable and writable objects
+*           of the given index range, and restores these objects with an import.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including parameters, a constant and a domain.
+*
+* ####      Test Steps
+*           1. Export the index range of the parameters and domain
+*           2. Change the parameters and the domain
+*           3. Import the exported parameter image
+*
+* ####      Test Checks
+*           1. Check, that the image contains the parameters and domain (not the constant)
+*           2. Check, that the import restores the parameters and domain
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictExport_RoundTrip)
+{
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint8_t     val1 = 0x11;
+    uint32_t    val4 = 0x44434241;
+    uint32_t    valn = 0x00000180;
+    uint32_t    cnst = 0x12345678;
+    uint32_t    oth  = 0x87654321;
+    uint32_t    len;
+    uint32_t    num;
+    int16_t     err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED32|CO_OBJ____R_), 0, (uintptr_t)&cnst);
+    TS_ODAdd(CO_KEY(0x2500, 3, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val4);
+    TS_ODAdd(CO_KEY(0x2501, 0, CO_UNSIGNED32|CO_OBJ__N_RW), 0, (uintptr_t)&valn);
+    TS_ODAdd(CO_KEY(0x2600, 0, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&oth);
+    dom = DomCreate(0x2520, 1, CO_OBJ____RW, 10);
+    DomFill(dom, 0);
+    TS_CreateNode(&node);
+
+    /* -- TEST -- */
+    len = TS_IMG_MAX;
+    err = CODictExport(&node.Dict, 0x2500, 0x25FF, TsImg, &len);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT((4 * CO_DICT_IMG_HDR + 1 + 4 + 4 + 10) == len);
+    TS_ASSERT((uint8_t)(0x80 + node.NodeId) == TsImg[3 * CO_DICT_IMG_HDR + 1 + 4]);
+
+    /* -- TEST -- */
+    val1  = 0;
+    val4  = 0;
+    valn  = 0;
+    oth   = 0;
+    DomClear(dom);
+    err   = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(4 == num);
+    TS_ASSERT(0x11 == val1);
+    TS_ASSERT(0x44434241 == val4);
+    TS_ASSERT(0x00000180 == valn);
+    TS_ASSERT(0 == oth);
+    CHK_DOM_FULL(dom, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Export into a too small buffer
+*
+* \details  This test checks, that the export stops at the first record, which doesn't fit into
+*           the given image buffer and returns the length of the complete records.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including two long parameters.
+*
+* ####      Test Steps
+*           1. Export the parameters into a buffer with space for a single record
+*
+* ####      Test Checks
+*           1. Check, that the export is rejected with size error
+*           2. Check, that the returned length contains the first record
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictExport_BufSmall)
+{
+    CO_NODE   node;
+    uint32_t  val1 = 0x11223344;
+    uint32_t  val2 = 0x55667788;
+    uint32_t  len;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    TS_CreateNode(&node);
+
+    /* -- TEST -- */
+    len = 2 * CO_DICT_IMG_HDR + 4 + 3;
+    err = CODictExport(&node.Dict, 0x2500, 0x2500, TsImg, &len);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_OBJ_SIZE == err);
+    TS_ASSERT((CO_DICT_IMG_HDR + 4) == len);
+    TS_ASSERT(0x44 == TsImg[CO_DICT_IMG_HDR]);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Import a 64bit value
+*
+* \details  This test checks, that an image record with 8 bytes is written into a 64bit value
+*           of the object dictionary.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an UNSIGNED64 parameter.
+*           2. Prepare parameter image with a record for the parameter.
+*
+* ####      Test Steps
+*           1. Import the parameter image
+*
+* ####      Test Checks
+*           1. Check, that the record is written
+*           2. Check, that the parameter holds the value of the image
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictImport_Quad)
+{
+    CO_NODE   node;
+    uint64_t  val8 = 0;
+    uint32_t  len;
+    uint32_t  num;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED64|CO_OBJ____RW), 0, (uintptr_t)&val8);
+    TS_CreateNode(&node);
+
+    len = TS_ImgAdd(0, 0x2500, 1, 8, 0x44434241);
+
+    /* -- TEST -- */
+    err = CODictImport(&node.Dict, TsImg, len, &num);
+
+    /* -- CHECK -- */
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(1 == num);
+    TS_ASSERT(0x4443424144434241ULL == val8);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Access 64bit values
+*
+* \details  This test checks, that 64bit integer and REAL64 values are written to and read from
+*           the object dictionary without loss.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a SIGNED64 and a REAL64 object.
+*
+* ####      Test Steps
+*           1. Write and read back the SIGNED64 object
+*           2. Write and read back the REAL64 object
+*
+* ####      Test Checks
+*           1. Check, that the objects hold the written values
+*           2. Check, that the read values are equal to the written values
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Dict_QuadAccess)
+{
+    CO_NODE   node;
+    int64_t   pos  = 0;
+    double    real = 0.0;
+    uint64_t  rdq  = 0;
+    double    rdd  = 0.0;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_SIGNED64|CO_OBJ___PRW), 0, (uintptr_t)&pos);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_REAL64  |CO_OBJ___PRW), 0, (uintptr_t)&real);
+    TS_CreateNode(&node);
+
+    /* -- TEST -- */
+    err = CODictWrQuad(&node.Dict, CO_DEV(0x2500, 1), (uint64_t)-123456789012LL);
+    TS_ASSERT(CO_ERR_NONE == err);
+    err = CODictRdQuad(&node.Dict, CO_DEV(0x2500, 1), &rdq);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    err = CODictWrDouble(&node.Dict, CO_DEV(0x2500, 2), -2.5e100);
+    TS_ASSERT(CO_ERR_NONE == err);
+    err = CODictRdDouble(&node.Dict, CO_DEV(0x2500, 2), &rdd);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- CHECK -- */
+    TS_ASSERT(-123456789012LL == pos);
+    TS_ASSERT((uint64_t)-123456789012LL == rdq);
+    TS_ASSERT(-2.5e100 == real);
+    TS_ASSERT(-2.5e100 == rdd);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    64bit access to a 32bit object
+*
+* \details  This test checks, that the 64bit access functions reject objects of other sizes.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an UNSIGNED32 object.
+*
+* ####      Test Steps
+*           1. Write a 64bit value to the UNSIGNED32 object
+*           2. Read a 64bit value from the UNSIGNED32 object
+*
+* ####      Test Checks
+*           1. Check, that both accesses are rejected with a size error
+*           2. Check, that the object is unchanged
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Dict_QuadBadSize)
+{
+    CO_NODE   node;
+    uint32_t  val4 = 0x11223344;
+    uint64_t  rdq  = 0;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val4);
+    TS_CreateNode(&node);
+
+    /* -- TEST -- */
+    err = CODictWrQuad(&node.Dict, CO_DEV(0x2500, 1), 0x5566778899AABBCCULL);
+    TS_ASSERT(CO_ERR_OBJ_SIZE == err);
+    err = CODictRdQuad(&node.Dict, CO_DEV(0x2500, 1), &rdq);
+    TS_ASSERT(CO_ERR_OBJ_SIZE == err);
+
+    /* -- CHECK -- */
+    TS_ASSERT(0x11223344 == val4);
+    TS_ASSERT(CO_ERR_OBJ_SIZE == CONodeGetErr(&node));
+}
+
+#if TS_APP_GEN > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Initialize node with a generated object dictionary
+*
+* \details  This test checks, that a node is created with the const object dictionary, which
+*           is generated out of the testsuite EDS file.
+*
+* ####      Test Preparation
+*           1. Reset the generated parameters to their default values.
+*
+* ####      Test Steps
+*           1. Create and start the node with the generated object dictionary
+*           2. Read a constant, a variable and a node-id dependent object
+*
+* ####      Test Checks
+*           1. Check, that all generated entries are found in the dictionary
+*           2. Check, that the read values are the EDS values
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictGen_Init)
+{
+    CO_NODE   node;
+    uint32_t  dev = 0;
+    uint32_t  sdo = 0;
+    uint8_t   num = 0;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateGenNode(&node);
+
+    /* -- TEST -- */
+    err = CODictRdLong(&node.Dict, CO_DEV(0x1000, 0), &dev);
+    TS_ASSERT(CO_ERR_NONE == err);
+    err = CODictRdLong(&node.Dict, CO_DEV(0x1200, 1), &sdo);
+    TS_ASSERT(CO_ERR_NONE == err);
+    err = CODictRdByte(&node.Dict, CO_DEV(0x1018, 0), &num);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- CHECK -- */
+    TS_ASSERT(APP_GEN_DICT_N == node.Dict.Num);
+    TS_ASSERT(0x00000191 == dev);
+    TS_ASSERT(0x00000601 == sdo);
+    TS_ASSERT(4 == num);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    PDO exchange with a generated object dictionary
+*
+* \details  This test checks, that the generated PDO communication and mapping entries are
+*           used for the RPDO and TPDO of the node.
+*
+* ####      Test Preparation
+*           1. Create node with the generated object dictionary in operational mode.
+*
+* ####      Test Steps
+*           1. Receive the RPDO with the outputs
+*           2. Send a SYNC message
+*
+* ####      Test Checks
+*           1. Check, that the outputs hold the received values
+*           2. Check, that the TPDO with the inputs is transmitted
+*           3. Check, that the generated mapping list contains all PDO mappable entries
+*           4. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictGen_Pdo)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+
+    /* -- PREPARATION -- */
+    TS_CreateGenNode(&node);
+    CONmtSetMode(&node.Nmt, CO_OPERATIONAL);
+
+    /* -- TEST -- */
+    TS_PDO_SEND(0x201, 0x41);
+    TS_SYNC_SEND();
+
+    /* -- CHECK -- */
+    TS_ASSERT(0x41   == AppGenVar.Obj2000_01);
+    TS_ASSERT(0x4342 == AppGenVar.Obj2000_02);
+
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 3);
+    CHK_BYTE (frm, 0, 0x11);
+    CHK_WORD (frm, 1, 0x2233);
+
+    TS_ASSERT(5 == APP_GEN_PDO_N);
+    TS_ASSERT(0x10010008 == AppGenPdoMap[0]);
+    TS_ASSERT(0x20010210 == AppGenPdoMap[4]);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Restore the generated default parameter values
+*
+* \details  This test checks, that the generated default parameter image restores the
+*           parameters after changes via the object dictionary.
+*
+* ####      Test Preparation
+*           1. Create node with the generated object dictionary.
+*
+* ####      Test Steps
+*           1. Write new values into a 32bit and a 64bit parameter
+*           2. Copy the default parameter image into the parameter memory
+*
+* ####      Test Checks
+*           1. Check, that the written values change the parameter memory
+*           2. Check, that the defaults are readable after the restore
+*           3. Check, that the constant REAL32 object holds the IEEE754 pattern
+*           4. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictGen_Default)
+{
+    CO_NODE   node;
+    uint32_t  val4 = 0;
+    uint64_t  rdq  = 0;
+    int16_t   err;
+
+    /* -- PREPARATION -- */
+    TS_CreateGenNode(&node);
+
+    /* -- TEST -- */
+    err = CODictWrLong(&node.Dict, CO_DEV(0x2100, 0), 0xAABBCCDD);
+    TS_ASSERT(CO_ERR_NONE == err);
+    err = CODictWrQuad(&node.Dict, CO_DEV(0x2101, 0), 0x0102030405060708ULL);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(0 != memcmp(&AppGenPara, &AppGenParaDef, sizeof(AppGenPara)));
+
+    memcpy(&AppGenPara, &AppGenParaDef, sizeof(AppGenPara));
+
+    /* -- CHECK -- */
+    err = CODictRdLong(&node.Dict, CO_DEV(0x2100, 0), &val4);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(0x12345678 == val4);
+    err = CODictRdQuad(&node.Dict, CO_DEV(0x2101, 0), &rdq);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT((uint64_t)-2LL == rdq);
+    err = CODictRdLong(&node.Dict, CO_DEV(0x2102, 0), &val4);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(0x3FC00000 == val4);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Direct objects of a const dictionary in value arrays
+*
+* \details  This test checks, that the values of direct object entries are stored in the value
+*           array of the node, when the const object dictionary is shared between two nodes.
+*
+* ####      Test Preparation
+*           1. Create two nodes with the generated object dictionary and a value array per node.
+*
+* ####      Test Steps
+*           1. Write a new value into a direct object entry of the first node
+*
+* ####      Test Checks
+*           1. Check, that the first node reads the written value
+*           2. Check, that the second node reads the initial value
+*           3. Check, that the const object dictionary is unchanged
+*           4. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictVal_Direct)
+{
+    CO_NODE_SPEC spec;
+    CO_NODE      node;
+    CO_NODE      other;
+    uintptr_t    val[APP_GEN_DICT_N + 1];
+    uintptr_t    otherVal[APP_GEN_DICT_N + 1];
+    CO_OBJ      *obj;
+    uint8_t      num = 0;
+    int16_t      err;
+
+    /* -- PREPARATION -- */
+    memcpy(&AppGenPara, &AppGenParaDef, sizeof(AppGenPara));
+    TS_CreateSpec(&other, &spec);
+    spec.Dict    = APP_GEN_DICT;
+    spec.DictLen = APP_GEN_DICT_N + 1;
+    spec.DictVal = &otherVal[0];
+    CONodeInit(&other, &spec);
+
+    TS_CreateSpec(&node, &spec);
+    spec.Dict    = APP_GEN_DICT;
+    spec.DictLen = APP_GEN_DICT_N + 1;
+    spec.DictVal = &val[0];
+    CONodeInit(&node, &spec);
+
+    /* -- TEST -- */
+    err = CODictWrByte(&node.Dict, CO_DEV(0x1018, 0), 7);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- CHECK -- */
+    err = CODictRdByte(&node.Dict, CO_DEV(0x1018, 0), &num);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(7 == num);
+    err = CODictRdByte(&other.Dict, CO_DEV(0x1018, 0), &num);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(4 == num);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x1018, 0));
+    TS_ASSERT(4 == obj->Data);
+    TS_ASSERT(7 == val[obj - node.Dict.Root]);
+
+    CHK_NO_ERR(&node);
+    CHK_NO_ERR(&other);
+}
+
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Notify changed objects within the subscribed range
+*
+* \details  This test checks, that the subscription callback is called for value changes
+*           of object entries within the subscribed key range only.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary with objects inside and outside of the range.
+*           2. Subscribe to the changes of index 2500h.
+*
+* ####      Test Steps
+*           1. Write the current value into an object within the range
+*           2. Write a new value into an object within the range
+*           3. Write a new value into an object outside of the range
+*           4. Unsubscribe and write a new value into an object within the range
+*
+* ####      Test Checks
+*           1. Check, that only the changed object within the range is notified
+*           2. Check, that no notification is called after unsubscribing
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictSub_Change)
+{
+    CO_NODE      node;
+    CO_DICT_SUB  sub;
+    uint8_t      val1 = 0;
+    uint16_t     val2 = 0;
+    uint32_t     val4 = 0;
+    int16_t      err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 1, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(0x2500, 2, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    TS_ODAdd(CO_KEY(0x2501, 0, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val4);
+    TS_CreateNode(&node);
+    TsSubNum = 0;
+    TsSubKey = 0;
+    err = CODictSubscribe(&node.Dict, &sub, CO_DEV(0x2500, 0), CO_DEV(0x2500, 0xFF), TS_SubFunc);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- TEST -- */
+    err = CODictWrByte(&node.Dict, CO_DEV(0x2500, 1), 0);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(0 == TsSubNum);
+
+    err = CODictWrByte(&node.Dict, CO_DEV(0x2500, 1), 0x5A);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(1 == TsSubNum);
+    TS_ASSERT(CO_DEV(0x2500, 1) == TsSubKey);
+
+    err = CODictWrLong(&node.Dict, CO_DEV(0x2501, 0), 0x12345678);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(1 == TsSubNum);
+
+    CODictUnsubscribe(&node.Dict, &sub);
+    err = CODictWrWord(&node.Dict, CO_DEV(0x2500, 2), 0x1234);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TsSubNum);
+    TS_ASSERT(0x5A == val1);
+    TS_ASSERT(0x1234 == val2);
+    TS_ASSERT(0x12345678 == val4);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Notify objects changed by SDO download
+*
+* \details  This test checks, that the subscription callback is called for value changes
+*           via the CANopen network.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary with an object within the range.
+*           2. Subscribe to the changes of index 2500h.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request with a new value
+*           2. Send SDO expedited download request with the same value
+*
+* ####      Test Checks
+*           1. Check, that the SDO downloads are successful
+*           2. Check, that the change is notified once
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictSub_Sdo)
+{
+    CO_NODE      node;
+    CO_DICT_SUB  sub;
+    uint32_t     val4 = 0;
+    int16_t      err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 3, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val4);
+    TS_CreateNode(&node);
+    TsSubNum = 0;
+    TsSubKey = 0;
+    err = CODictSubscribe(&node.Dict, &sub, CO_DEV(0x2500, 0), CO_DEV(0x2500, 0xFF), TS_SubFunc);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x23, 0x2500, 3, 0x14131211);
+    CHK_SDO0_OK(0x2500, 3);
+    TS_SDO_SEND (0x23, 0x2500, 3, 0x14131211);
+    CHK_SDO0_OK(0x2500, 3);
+
+    /* -- CHECK -- */
+    TS_ASSERT(0x14131211 == val4);
+    TS_ASSERT(1 == TsSubNum);
+    TS_ASSERT(CO_DEV(0x2500, 3) == TsSubKey);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Notify value changes of objects with a type
+*
+* \details  This test checks, that the change detection of an object with a type compares the
+*           value of the type read function and not the object data.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary with an object of a type, which holds the value behind
+*              a header.
+*           2. Subscribe to the changes of index 2500h.
+*
+* ####      Test Steps
+*           1. Write the current value into the object
+*           2. Write a new value into the object
+*           3. Write the new value again into the object
+*
+* ####      Test Checks
+*           1. Check, that only the changed value is notified
+*           2. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_DictSub_Typed)
+{
+    CO_NODE      node;
+    CO_DICT_SUB  sub;
+    TS_TYPED     typed = { 0x11111111, 0x22222222 };
+    int16_t      err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 4, CO_UNSIGNED32|CO_OBJ____RW), (CO_OBJ_TYPE *)&TsTyped, (uintptr_t)&typed);
+    TS_CreateNode(&node);
+    TsSubNum = 0;
+    TsSubKey = 0;
+    err = CODictSubscribe(&node.Dict, &sub, CO_DEV(0x2500, 0), CO_DEV(0x2500, 0xFF), TS_SubFunc);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- TEST -- */
+    err = CODictWrLong(&node.Dict, CO_DEV(0x2500, 4), 0x22222222);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(0 == TsSubNum);
+
+    err = CODictWrLong(&node.Dict, CO_DEV(0x2500, 4), 0x11111111);
+    TS_ASSERT(CO_ERR_NONE == err);
+    TS_ASSERT(1 == TsSubNum);
+    TS_ASSERT(CO_DEV(0x2500, 4) == TsSubKey);
+
+    err = CODictWrLong(&node.Dict, CO_DEV(0x2500, 4), 0x11111111);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TsSubNum);
+    TS_ASSERT(0x11111111 == typed.Val);
+    TS_ASSERT(0x11111111 == typed.Hdr);
+
+    CHK_NO_ERR(&node);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_DICT()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_DictImport_Params);
+    TS_RUNNER(TS_DictImport_Domain);
+    TS_RUNNER(TS_DictImport_ReadOnly);
+    TS_RUNNER(TS_DictImport_BadSize);
+    TS_RUNNER(TS_DictImport_NotExist);
+    TS_RUNNER(TS_DictImport_Truncated);
+    TS_RUNNER(TS_DictExport_RoundTrip);
+    TS_RUNNER(TS_DictExport_BufSmall);
+    TS_RUNNER(TS_DictImport_Quad);
+    TS_RUNNER(TS_Dict_QuadAccess);
+    TS_RUNNER(TS_Dict_QuadBadSize);
+#if TS_APP_GEN > 0
+    TS_RUNNER(TS_DictGen_Init);
+    TS_RUNNER(TS_DictGen_Pdo);
+    TS_RUNNER(TS_DictGen_Default);
+    TS_RUNNER(TS_DictVal_Direct);
+#endif
+    TS_RUNNER(TS_DictSub_Change);
+    TS_RUNNER(TS_DictSub_Sdo);
+    TS_RUNNER(TS_DictSub_Typed);
+
+    TS_End();
+}
+
+/*! @} */
@@ -0,0 +1,1077 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \addtogroup core_para
+* \details    This test suite checks the log-structured parameter storage in a simulated flash
+*             memory, and the tracking of changed parameter groups.
+*
+* #### Test Definition
+*
+* test-function                  | description                                          | type
+* ------------------------------ | ---------------------------------------------------- | ----
+* \ref TS_ParaLog_SaveLoad       | save parameter groups and load after remount         | F
+* \ref TS_ParaLog_Delta          | save only the changed range of a parameter group     | F
+* \ref TS_ParaLog_Default        | load default values after a restore record           | F
+* \ref TS_ParaLog_Wear           | compact the log and spread erases over all sectors   | F
+* \ref TS_ParaLog_PowerCut       | keep the old or new values after a power cut         | R
+* \ref TS_ParaLog_BadGeometry    | reject a flash memory without space for compaction   | R
+* \ref TS_Para_StoreChanged      | store the changed parameter groups only              | F
+* \ref TS_Para_StoreRange        | track the changed range of written objects           | F
+* \ref TS_Para_StoreDomain       | track a segmented download into a parameter group    | F
+* \ref TS_Para_RestoreChanged    | store the whole group after a restore default        | F
+* \ref TS_Para_LoadFailed        | store all groups, which are not loaded from NVM      | R
+* \ref TS_Para_TaskDeferred      | send the store response after background execution  | F
+* \ref TS_Para_TaskBusy          | reject a store request while a request is pending    | R
+* \ref TS_Para_TaskAbort         | cancel the deferred store response on client abort  | R
+* \ref TS_Para_TaskError         | abort the deferred store response on save error      | R
+* \ref TS_Para_TaskChanged       | keep changes during a pending store for next store   | F
+* \ref TS_Para_StoreUntracked    | store a parameter group without change tracking      | F
+*
+* Type Legend: R = Robustness Test, F = Functional Test
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "drv_flash.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TS_SEC_SIZE   256                            /* size of simulated flash sector           */
+#define TS_SEC_NUM    8                              /* number of simulated flash sectors        */
+#define TS_GRP_A      64                             /* size of parameter group A                */
+#define TS_GRP_B      32                             /* size of parameter group B                */
+
+#define TS_STORE_SIG  0x65766173                     /* store parameter signature 'save'         */
+#define TS_RESTORE_SIG 0x64616F6C                    /* restore parameter signature 'load'       */
+
+#define TS_COM        1                              /* change state of communication parameters */
+#define TS_APP        2                              /* change state of application parameters   */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t  TsMemA[TS_GRP_A];
+static uint8_t  TsMemB[TS_GRP_B];
+static uint8_t  TsDefA[TS_GRP_A];
+static uint8_t  TsBuf[TS_GRP_A];
+
+/* parameter groups: size, memory, default, reset type, ident and value */
+static CO_PARA  TsParaA = { TS_GRP_A, TsMemA, TsDefA, CO_RESET_NODE, 0, 0 };
+static CO_PARA  TsParaB = { TS_GRP_B, TsMemB, 0,      CO_RESET_COM,  0, 0 };
+
+static CO_PARA *TsGrp[2] = { &TsParaA, &TsParaB };
+
+static uint32_t TsComVal[4];
+static uint32_t TsAppVal[4];
+static uint32_t TsExtVal[4];
+
+static CO_PARA  TsParaAll = { 0,  0,                   0, CO_RESET_NODE, 0, CO_PARA___E };
+static CO_PARA  TsParaCom = { 16, (uint8_t *)TsComVal, 0, CO_RESET_COM,  0, CO_PARA___E };
+static CO_PARA  TsParaApp = { 16, (uint8_t *)TsAppVal, 0, CO_RESET_NODE, 0, CO_PARA___E };
+static const CO_PARA TsParaExt = { 16, (uint8_t *)TsExtVal, 0, CO_RESET_NODE, 0, CO_PARA___E };
+
+static CO_OBJ_DOM TsParaDom;
+
+static TS_CALLBACK TsParaCb;
+
+static const CO_PARA_LOG_DRV TsFlash = {
+    TS_SEC_SIZE, TS_SEC_NUM, SimFlashRead, SimFlashProg, SimFlashErase
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* fill the given memory with a pattern, which starts with the given value */
+static void TS_Fill(uint8_t *mem, uint32_t len, uint8_t val)
+{
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        mem[n] = (uint8_t)(val + n);
+    }
+}
+
+/* compare the given memory with the reference memory */
+static uint8_t TS_Equal(const uint8_t *mem, const uint8_t *ref, uint32_t len)
+{
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        if (mem[n] != ref[n]) {
+            return (0);
+        }
+    }
+    return (1);
+}
+
+/* copy the reference memory into the given memory */
+static void TS_Copy(uint8_t *mem, const uint8_t *ref, uint32_t len)
+{
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        mem[n] = ref[n];
+    }
+}
+
+/* create node with parameter groups for communication (2100h) and application (2200h, 2300h) */
+static void TS_ParaCreate(CO_NODE *node)
+{
+    uint8_t sub;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1010, 0, CO_UNSIGNED8 |CO_OBJ_D__R_), 0, 3);
+    TS_ODAdd(CO_KEY(0x1010, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_TPARA, (uintptr_t)&TsParaAll);
+    TS_ODAdd(CO_KEY(0x1010, 2, CO_UNSIGNED32|CO_OBJ____RW), CO_TPARA, (uintptr_t)&TsParaCom);
+    TS_ODAdd(CO_KEY(0x1010, 3, CO_UNSIGNED32|CO_OBJ____RW), CO_TPARA, (uintptr_t)&TsParaApp);
+    TS_ODAdd(CO_KEY(0x1011, 0, CO_UNSIGNED8 |CO_OBJ_D__R_), 0, 3);
+    TS_ODAdd(CO_KEY(0x1011, 2, CO_UNSIGNED32|CO_OBJ____RW), CO_TPARA, (uintptr_t)&TsParaCom);
+    for (sub = 0; sub < 4; sub++) {
+        TsComVal[sub] = 0;
+        TsAppVal[sub] = 0;
+        TS_ODAdd(CO_KEY(0x2100, sub + 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&TsComVal[sub]);
+        TS_ODAdd(CO_KEY(0x2200, sub + 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&TsAppVal[sub]);
+    }
+    TsParaDom.Offset = 0;
+    TsParaDom.Size   = 8;
+    TsParaDom.Start  = (uint8_t *)&TsAppVal[1];
+    TS_ODAdd(CO_KEY(0x2300, 1, CO_DOMAIN|CO_OBJ____RW), CO_TDOMAIN, (uintptr_t)&TsParaDom);
+    TS_CreateNode(node);
+}
+
+/* start with an erased flash memory and default values in parameter group A */
+static SIM_FLASH *TS_FlashCreate(void)
+{
+    TS_Fill(TsDefA, TS_GRP_A, 0xD0);
+    TS_Fill(TsMemA, TS_GRP_A, 0x00);
+    TS_Fill(TsMemB, TS_GRP_B, 0x80);
+    return (SimFlashInit(TS_SEC_SIZE, TS_SEC_NUM));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Save and load parameter groups
+*
+* \details  This test checks, that the saved parameter groups are loaded after a remount of the
+*           log.
+*
+* ####      Test Preparation
+*           1. Prepare erased flash memory and mount the parameter log
+*
+* ####      Test Steps
+*           1. Save both parameter groups
+*           2. Clear the parameter memory and remount the parameter log
+*           3. Load both parameter groups
+*
+* ####      Test Checks
+*           1. Check, that the parameter groups hold the saved values
+*           2. Check, that a group without stored values is unchanged by the load
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_SaveLoad)
+{
+    CO_PARA_LOG log;
+    uint8_t     ref[TS_GRP_A];
+
+    /* -- PREPARATION -- */
+    TS_ASSERT(0 != TS_FlashCreate());
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+    TS_Fill(ref, TS_GRP_A, 0x00);
+    TS_ASSERT(1 == TS_Equal(TsMemA, ref, TS_GRP_A));
+
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaB));
+    TS_Fill(TsMemA, TS_GRP_A, 0x55);
+    TS_Fill(TsMemB, TS_GRP_B, 0x55);
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaB));
+
+    /* -- CHECK -- */
+    TS_Fill(ref, TS_GRP_A, 0x00);
+    TS_ASSERT(1 == TS_Equal(TsMemA, ref, TS_GRP_A));
+    TS_Fill(ref, TS_GRP_B, 0x80);
+    TS_ASSERT(1 == TS_Equal(TsMemB, ref, TS_GRP_B));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Save changed range only
+*
+* \details  This test checks, that a save of a parameter group programs the changed range only.
+*
+* ####      Test Preparation
+*           1. Prepare flash memory with saved parameter group
+*
+* ####      Test Steps
+*           1. Save the parameter group without changes
+*           2. Change a single byte and save the parameter group
+*           3. Change two bytes with a small gap and save the parameter group
+*
+* ####      Test Checks
+*           1. Check, that the unchanged group programs no bytes
+*           2. Check, that a single record header with padded data is programmed
+*           3. Check, that the new values are loaded after a remount
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_Delta)
+{
+    CO_PARA_LOG log;
+    uint8_t     ref[TS_GRP_A];
+    uint32_t    written;
+
+    /* -- PREPARATION -- */
+    TS_ASSERT(0 != TS_FlashCreate());
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+
+    /* -- TEST -- */
+    written = log.Written;
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT(written == log.Written);
+
+    TsMemA[17] = 0xAA;
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT((written + CO_PARA_LOG_HDR + 4) == log.Written);
+
+    written    = log.Written;
+    TsMemA[40] = 0xBB;
+    TsMemA[43] = 0xCC;
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT((written + CO_PARA_LOG_HDR + 4) == log.Written);
+
+    /* -- CHECK -- */
+    TS_Fill(ref, TS_GRP_A, 0x00);
+    ref[17] = 0xAA;
+    ref[40] = 0xBB;
+    ref[43] = 0xCC;
+    TS_Fill(TsMemA, TS_GRP_A, 0x55);
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+    TS_ASSERT(1 == TS_Equal(TsMemA, ref, TS_GRP_A));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Restore default values
+*
+* \details  This test checks, that a restore record loads the default values of the parameter
+*           group, and that a following save writes the complete group.
+*
+* ####      Test Preparation
+*           1. Prepare flash memory with saved parameter group
+*
+* ####      Test Steps
+*           1. Restore the default values and remount the parameter log
+*           2. Load the parameter group
+*           3. Change a single byte and save the parameter group
+*
+* ####      Test Checks
+*           1. Check, that the default values are loaded
+*           2. Check, that only the changed byte is programmed after the restore
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_Default)
+{
+    CO_PARA_LOG log;
+    uint8_t     ref[TS_GRP_A];
+    uint32_t    written;
+
+    /* -- PREPARATION -- */
+    TS_ASSERT(0 != TS_FlashCreate());
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == COParaLogDefault(&log, &TsParaA));
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TS_Equal(TsMemA, TsDefA, TS_GRP_A));
+
+    written   = log.Written;
+    TsMemA[0] = 0x11;
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT((written + CO_PARA_LOG_HDR + 4) == log.Written);
+    TS_Fill(ref, TS_GRP_A, 0xD0);
+    ref[0] = 0x11;
+    TS_Fill(TsMemA, TS_GRP_A, 0x55);
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+    TS_ASSERT(1 == TS_Equal(TsMemA, ref, TS_GRP_A));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Compaction and wear levelling
+*
+* \details  This test checks, that a long sequence of saves compacts the log, keeps all
+*           parameter groups and spreads the erase cycles over all sectors.
+*
+* ####      Test Preparation
+*           1. Prepare flash memory with both saved parameter groups
+*
+* ####      Test Steps
+*           1. Change and save a single byte of parameter group A many times
+*           2. Remount the parameter log and load both parameter groups
+*
+* ####      Test Checks
+*           1. Check, that all sectors are erased
+*           2. Check, that the erase cycles differ by at most one between all sectors
+*           3. Check, that both parameter groups hold the last saved values
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_Wear)
+{
+    CO_PARA_LOG log;
+    SIM_FLASH  *flash;
+    uint8_t     ref[TS_GRP_A];
+    uint32_t    min;
+    uint16_t    n;
+
+    /* -- PREPARATION -- */
+    flash = TS_FlashCreate();
+    TS_ASSERT(0 != flash);
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaB));
+
+    /* -- TEST -- */
+    for (n = 0; n < 1000; n++) {
+        TsMemA[n % TS_GRP_A] = (uint8_t)(n + 1);
+        TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+    }
+    TS_Fill(ref, TS_GRP_A, 0x55);
+    TS_Fill(TsMemA, TS_GRP_A, 0x55);
+    TS_Fill(TsMemB, TS_GRP_B, 0x55);
+    TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+    TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaB));
+
+    /* -- CHECK -- */
+    min = flash->Erase[0];
+    for (n = 0; n < TS_SEC_NUM; n++) {
+        if (flash->Erase[n] < min) {
+            min = flash->Erase[n];
+        }
+    }
+    TS_ASSERT(min > 0);
+    TS_ASSERT(SimFlashWear() <= (min + 1));
+
+    for (n = 0; n < 1000; n++) {
+        ref[n % TS_GRP_A] = (uint8_t)(n + 1);
+    }
+    TS_ASSERT(1 == TS_Equal(TsMemA, ref, TS_GRP_A));
+    TS_Fill(ref, TS_GRP_B, 0x80);
+    TS_ASSERT(1 == TS_Equal(TsMemB, ref, TS_GRP_B));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Power cut during save and compaction
+*
+* \details  This test checks, that a power cut at any programmed byte of a save sequence keeps
+*           either the old or the new values of the saved parameter group, including power
+*           cuts during a compaction.
+*
+* ####      Test Preparation
+*           1. Prepare flash memory with both saved parameter groups
+*
+* ####      Test Steps
+*           1. Cut the power after a number of programmed bytes
+*           2. Change and save a single byte of parameter group A until the save fails
+*           3. Remount the parameter log and load both parameter groups
+*           4. Save parameter group A again with restored power
+*
+* ####      Test Checks
+*           1. Check, that parameter group A holds the old or the new values
+*           2. Check, that parameter group B is unchanged
+*           3. Check, that the parameter log is usable after the power cut
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_PowerCut)
+{
+    CO_PARA_LOG log;
+    uint8_t     old[TS_GRP_A];
+    uint8_t     val[TS_GRP_A];
+    uint8_t     ref[TS_GRP_B];
+    uint32_t    cut;
+    uint16_t    n;
+
+    for (cut = 0; cut < 2400; cut += 11) {
+        /* -- PREPARATION -- */
+        TS_ASSERT(0 != TS_FlashCreate());
+        TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+        TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+        TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaB));
+
+        /* -- TEST -- */
+        SimFlashCut(cut);
+        for (n = 0; n < 200; n++) {
+            TS_Copy(old, TsMemA, TS_GRP_A);
+            TsMemA[n % TS_GRP_A] = (uint8_t)(n + 1);
+            if (COParaLogSave(&log, &TsParaA) != CO_ERR_NONE) {
+                break;
+            }
+        }
+        SimFlashCut(SIM_FLASH_NO_CUT);
+        TS_Copy(val, TsMemA, TS_GRP_A);
+        TS_Fill(TsMemA, TS_GRP_A, 0x55);
+        TS_Fill(TsMemB, TS_GRP_B, 0x55);
+        TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+        TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+        TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaB));
+
+        /* -- CHECK -- */
+        TS_ASSERT((1 == TS_Equal(TsMemA, old, TS_GRP_A)) ||
+                  (1 == TS_Equal(TsMemA, val, TS_GRP_A)));
+        TS_Fill(ref, TS_GRP_B, 0x80);
+        TS_ASSERT(1 == TS_Equal(TsMemB, ref, TS_GRP_B));
+
+        TS_Copy(TsMemA, val, TS_GRP_A);
+        TS_ASSERT(CO_ERR_NONE == COParaLogSave(&log, &TsParaA));
+        TS_Fill(TsMemA, TS_GRP_A, 0x55);
+        TS_ASSERT(CO_ERR_NONE == COParaLogInit(&log, &TsFlash, TsGrp, 2, TsBuf));
+        TS_ASSERT(CO_ERR_NONE == COParaLogLoad(&log, &TsParaA));
+        TS_ASSERT(1 == TS_Equal(TsMemA, val, TS_GRP_A));
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Reject bad flash geometry
+*
+* \details  This test checks, that the parameter log is rejected, when the flash memory has not
+*           enough sectors for a compaction.
+*
+* ####      Test Preparation
+*           1. Prepare erased flash memory with too less sectors
+*
+* ####      Test Steps
+*           1. Mount the parameter log
+*
+* ####      Test Checks
+*           1. Check, that the mount is rejected
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ParaLog_BadGeometry)
+{
+    CO_PARA_LOG     log;
+    CO_PARA_LOG_DRV drv = TsFlash;
+
+    /* -- PREPARATION -- */
+    TS_ASSERT(0 != TS_FlashCreate());
+    drv.SecNum = 3;
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_BAD_ARG == COParaLogInit(&log, &drv, TsGrp, 2, TsBuf));
+
+    /* -- CHECK -- */
+    drv.SecNum  = TS_SEC_NUM;
+    drv.SecSize = 24;
+    TS_ASSERT(CO_ERR_BAD_ARG == COParaLogInit(&log, &drv, TsGrp, 2, TsBuf));
+}
+
+#if CO_PARA_TRACK_N > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Store changed parameter groups
+*
+* \details  This test checks, that the store of all parameters saves the parameter groups with
+*           changed objects only.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups
+*
+* ####      Test Steps
+*           1. Write an object of the communication parameter group
+*           2. Store all parameters
+*           3. Store all parameters again
+*
+* ####      Test Checks
+*           1. Check, that only the communication parameter group is saved
+*           2. Check, that the stored bytes are the size of the written object
+*           3. Check, that the unchanged parameter groups are not saved again
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_StoreChanged)
+{
+    CO_NODE node;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+    TS_ASSERT(0 < TsParaCb.ParaLoad_Called);
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2100, 2), 0x12345678));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 1), TS_STORE_SIG));
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(&TsParaCom == TsParaCb.ParaSave_ArgParaGrp);
+    TS_ASSERT(4 == node.Dict.ParaState[TS_COM].Stored);
+    TS_ASSERT(0 == node.Dict.ParaState[TS_APP].Stored);
+    TS_ASSERT(node.Dict.ParaState[TS_COM].DirtyStart >= node.Dict.ParaState[TS_COM].DirtyEnd);
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 1), TS_STORE_SIG));
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(0 == node.Dict.ParaState[TS_COM].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Track changed range
+*
+* \details  This test checks, that the changed range of a parameter group covers all written
+*           objects, and that direct changes are reported by the application.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups
+*
+* ####      Test Steps
+*           1. Write two objects of the application parameter group
+*           2. Report a direct change of a further parameter
+*           3. Store the application parameter group
+*
+* ####      Test Checks
+*           1. Check, that the changed range covers the written objects
+*           2. Check, that the changed range covers the reported change
+*           3. Check, that the stored bytes are the size of the changed range
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_StoreRange)
+{
+    CO_NODE node;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2200, 3), 0x11));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2200, 2), 0x22));
+
+    /* -- CHECK -- */
+    TS_ASSERT(4  == node.Dict.ParaState[TS_APP].DirtyStart);
+    TS_ASSERT(12 == node.Dict.ParaState[TS_APP].DirtyEnd);
+
+    TsAppVal[3] = 0x33;
+    COParaChanged(&TsParaApp, &node, &TsAppVal[3], sizeof(uint32_t));
+    COParaChanged(&TsParaApp, &node, &TsComVal[0], sizeof(uint32_t));
+    TS_ASSERT(4  == node.Dict.ParaState[TS_APP].DirtyStart);
+    TS_ASSERT(16 == node.Dict.ParaState[TS_APP].DirtyEnd);
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 3), TS_STORE_SIG));
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(12 == node.Dict.ParaState[TS_APP].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Track segmented download
+*
+* \details  This test checks, that a segmented SDO download into a domain, which is part of a
+*           parameter group, marks the domain as changed.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups (domain 2300h:01 in the application
+*              parameter group)
+*
+* ####      Test Steps
+*           1. Download the domain with a segmented SDO transfer
+*           2. Store the application parameter group
+*
+* ####      Test Checks
+*           1. Check, that the changed range covers the domain
+*           2. Check, that the stored bytes are the size of the domain
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_StoreDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x21, 0x2300, 1, 8);
+    CHK_SDO0_OK(0x2300, 1);
+    TS_SEG_SEND(0x00, 0x11);
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x20);
+    TS_SEG_SEND(0x1D, 0x18);
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x30);
+    TS_ASSERT(0x18 == ((uint8_t *)TsAppVal)[11]);
+
+    /* -- CHECK -- */
+    TS_ASSERT(4  == node.Dict.ParaState[TS_APP].DirtyStart);
+    TS_ASSERT(12 == node.Dict.ParaState[TS_APP].DirtyEnd);
+    TS_ASSERT(node.Dict.ParaState[TS_COM].DirtyStart >= node.Dict.ParaState[TS_COM].DirtyEnd);
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 3), TS_STORE_SIG));
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(8 == node.Dict.ParaState[TS_APP].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Store after restore default
+*
+* \details  This test checks, that a restore of the default values marks the whole parameter
+*           group as changed.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups
+*
+* ####      Test Steps
+*           1. Restore the default values of the communication parameter group
+*           2. Store all parameters
+*
+* ####      Test Checks
+*           1. Check, that the restore callback is called
+*           2. Check, that the whole communication parameter group is saved
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_RestoreChanged)
+{
+    CO_NODE node;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1011, 2), TS_RESTORE_SIG));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 1), TS_STORE_SIG));
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TsParaCb.ParaDefault_Called);
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(&TsParaCom == TsParaCb.ParaSave_ArgParaGrp);
+    TS_ASSERT(16 == node.Dict.ParaState[TS_COM].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Store after failed load
+*
+* \details  This test checks, that parameter groups, which are not loaded from NVM, are saved
+*           completely with the store of all parameters.
+*
+* ####      Test Preparation
+*           1. Prepare load callback with an error
+*           2. Prepare node with two parameter groups
+*
+* ####      Test Steps
+*           1. Store all parameters
+*
+* ####      Test Checks
+*           1. Check, that the load callback is called
+*           2. Check, that both parameter groups are saved completely
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_LoadFailed)
+{
+    CO_NODE node;
+
+    /* -- PREPARATION -- */
+    TsParaCb.ParaLoad_Return = CO_ERR_PARA_LOAD;
+    TS_ParaCreate(&node);
+    TS_ASSERT(0 < TsParaCb.ParaLoad_Called);
+    (void)CONodeGetErr(&node);
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1010, 1), TS_STORE_SIG));
+
+    /* -- CHECK -- */
+    TS_ASSERT(2 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(&TsParaApp == TsParaCb.ParaSave_ArgParaGrp);
+    TS_ASSERT(16 == node.Dict.ParaState[TS_COM].Stored);
+    TS_ASSERT(16 == node.Dict.ParaState[TS_APP].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Deferred store response
+*
+* \details  This test checks, that a store request with a parameter store task is executed
+*           outside of the node processing, that the SDO server rejects further requests
+*           meanwhile, and that the SDO response is sent after the execution.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups and a parameter store task
+*           2. Change an object of the communication parameter group
+*
+* ####      Test Steps
+*           1. Send SDO request to store all parameters
+*           2. Send SDO request to read an object
+*           3. Execute the request in the parameter store task
+*           4. Process the node
+*
+* ####      Test Checks
+*           1. Check, that no store response is sent before the execution
+*           2. Check, that the read request is aborted while the store is pending
+*           3. Check, that the store response is sent after the execution
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_TaskDeferred)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PARA_TASK task;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+    TS_ASSERT(CO_ERR_NONE == COParaTaskInit(&task, &node));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2100, 1), 0x11));
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x23, 0x1010, 1, TS_STORE_SIG);
+    CHK_NOCAN(&frm);
+    TS_ASSERT(0 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(CO_PARA_TASK_PEND == task.State);
+
+    TS_SDO_SEND(0x40, 0x2100, 1, 0);
+    CHK_SDO0_ERR(0x2100, 1, CO_SDO_ERR_TOS_STATE);
+
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    TS_ASSERT(0 == COParaTaskProcess(&task));
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    CHK_NOCAN(&frm);
+
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(CO_PARA_TASK_IDLE == task.State);
+    TS_ASSERT(4 == node.Dict.ParaState[TS_COM].Stored);
+
+    CHK_NO_ERR(&node);
+}
+
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Busy parameter store task
+*
+* \details  This test checks, that a further store request is rejected while a request is
+*           pending in the parameter store task.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups and a parameter store task
+*           2. Send SDO request to store all parameters
+*
+* ####      Test Steps
+*           1. Send SDO request to store the application parameters
+*           2. Store the application parameters within the application
+*           3. Execute the pending request and process the node
+*
+* ####      Test Checks
+*           1. Check, that the further SDO request is aborted
+*           2. Check, that the further store within the application is rejected
+*           3. Check, that the pending request is answered
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_TaskBusy)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PARA_TASK task;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+    TS_ASSERT(CO_ERR_NONE == COParaTaskInit(&task, &node));
+    TS_SDO_SEND(0x23, 0x1010, 1, TS_STORE_SIG);
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x23, 0x1010, 3, TS_STORE_SIG);
+    CHK_SDO0_ERR(0x1010, 3, CO_SDO_ERR_TOS_STATE);
+    TS_ASSERT(CO_ERR_OBJ_ACC == CODictWrLong(&node.Dict, CO_DEV(0x1010, 3), TS_STORE_SIG));
+    CHK_ERR(&node, CO_ERR_OBJ_WRITE);
+
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(0x1010, 1);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Abort deferred store response
+*
+* \details  This test checks, that a client abort cancels the deferred SDO response of a pending
+*           store request.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups and a parameter store task
+*           2. Send SDO request to store all parameters
+*
+* ####      Test Steps
+*           1. Send SDO abort request
+*           2. Execute the pending request and process the node
+*           3. Send SDO request to read an object
+*
+* ####      Test Checks
+*           1. Check, that the pending request is executed without a response
+*           2. Check, that the SDO server serves the next request
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_TaskAbort)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PARA_TASK task;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+    TS_ASSERT(CO_ERR_NONE == COParaTaskInit(&task, &node));
+    TS_SDO_SEND(0x23, 0x1010, 1, TS_STORE_SIG);
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x80, 0x1010, 1, CO_SDO_ERR_TOS);
+    CHK_NOCAN(&frm);
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_NOCAN(&frm);
+    TS_ASSERT(CO_PARA_TASK_IDLE == task.State);
+
+    TS_SDO_SEND(0x40, 0x2100, 1, 0);
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x43);
+
+    CHK_NO_ERR(&node);
+}
+
+#if CO_PARA_TRACK_N > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Deferred store error
+*
+* \details  This test checks, that an error of the save callback aborts the deferred SDO
+*           transfer and is reported as node error.
+*
+* ####      Test Preparation
+*           1. Prepare save callback with an error
+*           2. Prepare node with two loaded parameter groups and a parameter store task
+*           3. Change an object of the application parameter group
+*
+* ####      Test Steps
+*           1. Send SDO request to store the application parameters
+*           2. Execute the request and process the node
+*
+* ####      Test Checks
+*           1. Check, that the SDO transfer is aborted
+*           2. Check, that the store error is reported
+*           3. Check, that the parameter group is still changed
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_TaskError)
+{
+    CO_NODE      node;
+    CO_PARA_TASK task;
+
+    /* -- PREPARATION -- */
+    TsParaCb.ParaSave_Return = CO_ERR_PARA_STORE;
+    TS_ParaCreate(&node);
+    TS_ASSERT(CO_ERR_NONE == COParaTaskInit(&task, &node));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2200, 4), 0x44));
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x23, 0x1010, 3, TS_STORE_SIG);
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(0x1010, 3, CO_SDO_ERR_TOS);
+    CHK_ERR(&node, CO_ERR_PARA_STORE);
+    TS_ASSERT(12 == node.Dict.ParaState[TS_APP].DirtyStart);
+    TS_ASSERT(16 == node.Dict.ParaState[TS_APP].DirtyEnd);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Change during pending store
+*
+* \details  This test checks, that a parameter, which is written between the store request and
+*           the execution in the parameter store task, is kept as changed for the next store.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups and a parameter store task
+*           2. Change an object of the communication parameter group
+*
+* ####      Test Steps
+*           1. Send SDO request to store the communication parameters
+*           2. Change a further object of the communication parameter group
+*           3. Execute the request and process the node
+*           4. Store the communication parameters again
+*
+* ####      Test Checks
+*           1. Check, that the first store saves the first change only
+*           2. Check, that the further change is kept as changed range
+*           3. Check, that the second store saves the further change
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_TaskChanged)
+{
+    CO_NODE      node;
+    CO_PARA_TASK task;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+    TS_ASSERT(CO_ERR_NONE == COParaTaskInit(&task, &node));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2100, 1), 0x11));
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x23, 0x1010, 2, TS_STORE_SIG);
+    TS_ASSERT(CO_PARA_TASK_PEND == task.State);
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x2100, 3), 0x33));
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(0x1010, 2);
+    TS_ASSERT(1  == TsParaCb.ParaSave_Called);
+    TS_ASSERT(4  == node.Dict.ParaState[TS_COM].Stored);
+    TS_ASSERT(8  == node.Dict.ParaState[TS_COM].DirtyStart);
+    TS_ASSERT(12 == node.Dict.ParaState[TS_COM].DirtyEnd);
+
+    /* -- TEST -- */
+    TS_SDO_SEND(0x23, 0x1010, 2, TS_STORE_SIG);
+    TS_ASSERT(1 == COParaTaskProcess(&task));
+    CONodeProcess(&node);
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(0x1010, 2);
+    TS_ASSERT(2 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(4 == node.Dict.ParaState[TS_COM].Stored);
+    TS_ASSERT(node.Dict.ParaState[TS_COM].DirtyStart >= node.Dict.ParaState[TS_COM].DirtyEnd);
+
+    CHK_NO_ERR(&node);
+}
+
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Store untracked parameter group
+*
+* \details  This test checks, that a parameter group without change tracking is stored
+*           completely, and that the parameter group may be placed in read-only memory.
+*
+* ####      Test Preparation
+*           1. Prepare node with two loaded parameter groups
+*
+* ####      Test Steps
+*           1. Store a constant parameter group, which is not part of the object dictionary
+*
+* ####      Test Checks
+*           1. Check, that the parameter group is saved
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_StoreUntracked)
+{
+    CO_NODE node;
+
+    /* -- PREPARATION -- */
+    TS_ParaCreate(&node);
+
+    /* -- TEST -- */
+    COParaStore((CO_PARA *)&TsParaExt, &node);
+
+    /* -- CHECK -- */
+    TS_ASSERT(1 == TsParaCb.ParaSave_Called);
+    TS_ASSERT(&TsParaExt == TsParaCb.ParaSave_ArgParaGrp);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CoreParaSetup(void)
+{
+    TS_CallbackInit(&TsParaCb);
+}
+
+static void CoreParaCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_PARA()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CoreParaSetup, CoreParaCleanup);
+
+    TS_RUNNER(TS_ParaLog_SaveLoad);
+    TS_RUNNER(TS_ParaLog_Delta);
+    TS_RUNNER(TS_ParaLog_Default);
+    TS_RUNNER(TS_ParaLog_Wear);
+    TS_RUNNER(TS_ParaLog_PowerCut);
+    TS_RUNNER(TS_ParaLog_BadGeometry);
+#if CO_PARA_TRACK_N > 0
+    TS_RUNNER(TS_Para_StoreChanged);
+    TS_RUNNER(TS_Para_StoreRange);
+    TS_RUNNER(TS_Para_StoreDomain);
+    TS_RUNNER(TS_Para_RestoreChanged);
+    TS_RUNNER(TS_Para_LoadFailed);
+    TS_RUNNER(TS_Para_TaskDeferred);
+#endif
+    TS_RUNNER(TS_Para_TaskBusy);
+    TS_RUNNER(TS_Para_TaskAbort);
+#if CO_PARA_TRACK_N > 0
+    TS_RUNNER(TS_Para_TaskError);
+    TS_RUNNER(TS_Para_TaskChanged);
+#endif
+    TS_RUNNER(TS_Para_StoreUntracked);
+
+    TS_End();
+}
+
+/*! @} */
@@ -29,6 +29,9 @@ static int16_t  a11, a12, a13;
 static int16_t  a21, a22, a23;
 static int16_t  a31, a32, a33;
 
+static uint8_t  order[8];
+static uint8_t  orderNum;
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -61,6 +64,16 @@ void TS_PrepareTmrLists(CO_NODE *node, uint32_t t1, uint32_t t2, uint32_t t3)
     COTmrService(&node->Tmr);
 }
 
+/*
+*       record the calling order of timer actions with the action parameter
+*/
+static void TS_TmrOrder(void *arg)
+{
+    if (orderNum < sizeof(order)) {
+        order[orderNum] = (uint8_t)(uintptr_t)arg;
+        orderNum++;
+    }
+}
 
 TEST_DEF(TS_Tmr_DelA11)
 {
@@ -651,6 +664,79 @@ TEST_DEF(TS_Tmr_AppTmrAfterNodeReset)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC7
+*
+*          This testcase will check:
+*          - prioritized actions are called ahead of all other actions of the same timer tick,
+*            independent of the creation order and after the cyclic re-insertion.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TEST_DEF(TS_Tmr_PrioOrder)
+{
+    CO_NODE  node;
+
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    COTmrReset(&node.Tmr);
+
+    /* create actions */
+    TS_ASSERT(COTmrCreate    (&node.Tmr, 0, CO_TMR_TICKS(100), TS_TmrOrder, (void *)3) >= 0);
+    TS_ASSERT(COTmrCreatePrio(&node.Tmr, 0, CO_TMR_TICKS(100), TS_TmrOrder, (void *)1) >= 0);
+    TS_ASSERT(COTmrCreate    (&node.Tmr, 0, CO_TMR_TICKS(100), TS_TmrOrder, (void *)4) >= 0);
+    TS_ASSERT(COTmrCreatePrio(&node.Tmr, 0, CO_TMR_TICKS(100), TS_TmrOrder, (void *)2) >= 0);
+
+    orderNum = 0;
+    TS_Wait(&node, 100);
+    TS_Wait(&node, 100);
+
+    TS_ASSERT(8 == orderNum);                         /* all actions called twice                 */
+    TS_ASSERT(1 == order[0]);                         /* prioritized actions in creation order    */
+    TS_ASSERT(2 == order[1]);
+    TS_ASSERT(3 == order[2]);                         /* other actions in creation order          */
+    TS_ASSERT(4 == order[3]);
+    TS_ASSERT(1 == order[4]);                         /* same order after re-insertion            */
+    TS_ASSERT(2 == order[5]);
+    TS_ASSERT(3 == order[6]);
+    TS_ASSERT(4 == order[7]);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC8
+*
+*          This testcase will check:
+*          - timer events, which are elapsed before processing, are processed in order of their
+*            timer ticks.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TEST_DEF(TS_Tmr_ElapsedOrder)
+{
+    CO_NODE  node;
+    uint8_t  n;
+
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    COTmrReset(&node.Tmr);
+
+    /* create actions */
+    TS_ASSERT(COTmrCreate(&node.Tmr, 2, 0, TS_TmrOrder, (void *)2) >= 0);
+    TS_ASSERT(COTmrCreate(&node.Tmr, 1, 0, TS_TmrOrder, (void *)1) >= 0);
+    TS_ASSERT(COTmrCreate(&node.Tmr, 3, 0, TS_TmrOrder, (void *)3) >= 0);
+
+    orderNum = 0;
+    for (n = 0; n < 3; n++) {
+        (void)COTmrService(&node.Tmr);
+    }
+    COTmrProcess(&node.Tmr);
+
+    TS_ASSERT(3 == orderNum);
+    TS_ASSERT(1 == order[0]);
+    TS_ASSERT(2 == order[1]);
+    TS_ASSERT(3 == order[2]);
+    CHK_NO_ERR(&node);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -687,6 +773,8 @@ SUITE_CORE_TMR()
     TS_RUNNER(TS_Tmr_OneShot100ms);
     TS_RUNNER(TS_Tmr_StartDelay);
     TS_RUNNER(TS_Tmr_AppTmrAfterNodeReset);
+    TS_RUNNER(TS_Tmr_PrioOrder);
+    TS_RUNNER(TS_Tmr_ElapsedOrder);
 
 //    CanDiagnosticOff(0);
 
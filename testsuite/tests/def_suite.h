@@ -34,12 +34,15 @@ typedef enum DEF_TEST_GROUPS_E {                      /*---- Test Groups -------
     DEF_G_PDO,                                        /*!< Group: PDO Communication               */
     DEF_G_NMT,                                        /*!< Group: NMT Management                  */
     DEF_G_EMCY,                                       /*!< Group: EMCY Management                 */
+    DEF_G_BENCH,                                      /*!< Group: Benchmarks                      */
 
     DEF_G_NUM                                         /*!< Number of Groups                       */
 } DEF_TEST_GROUPS;
 
 typedef enum DEF_CORE_SUITES_E {                      /*---- Core Component Test Suites ----------*/ 
     DEF_S_CORE_TMR,                                   /*!< Suite: Highspeed Timer                 */
+    DEF_S_CORE_DICT,                                  /*!< Suite: Object Dictionary Image         */
+    DEF_S_CORE_PARA,                                  /*!< Suite: Parameter Log Storage           */
 
     DEF_S_CORE_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CORE_SUITES;
@@ -68,6 +71,9 @@ typedef enum DEF_NMT_SUITES_E {                       /*---- NMT Management Test
     DEF_S_NMT_HBP,                                    /*!< Suite: NMT Heartbeat Producer          */
     DEF_S_NMT_HBC,                                    /*!< Suite: NMT Heartbeat Consumer          */
     DEF_S_NMT_LSS,                                    /*!< Suite: NMT Layer Setting Service       */
+    DEF_S_NMT_MST,                                    /*!< Suite: NMT Master                      */
+    DEF_S_NMT_BOOT,                                   /*!< Suite: NMT Boot Engine                 */
+    DEF_S_NMT_LSS_MST,                                /*!< Suite: LSS Master                      */
 
     DEF_S_NMT_NUM                                     /*!< Number of Suites in Group              */
 } DEF_NMT_SUITES;
@@ -77,15 +83,25 @@ typedef enum DEF_EMCY_SUITES_E {                      /*---- EMCY Management Tes
     DEF_S_EMCY_ERR,                                   /*!< Suite: EMCY Error Register Object      */
     DEF_S_EMCY_HIST,                                  /*!< Suite: EMCY Error History Object       */
     DEF_S_EMCY_API,                                   /*!< Suite: EMCY Application Interface Test */
+    DEF_S_EMCY_TX,                                    /*!< Suite: EMCY Transmit Queue             */
+    DEF_S_EMCY_CONS,                                  /*!< Suite: EMCY Consumer                   */
 
     DEF_S_EMCY_NUM                                    /*!< Number of Suites in Group              */
 } DEF_EMCY_SUITES;
 
+typedef enum DEF_BENCH_SUITES_E {                     /*---- Benchmark Suites --------------------*/ 
+    DEF_S_BENCH_SDOS,                                 /*!< Suite: SDO Server Benchmark            */
+
+    DEF_S_BENCH_NUM                                   /*!< Number of Suites in Group              */
+} DEF_BENCH_SUITES;
+
 /******************************************************************************
 * PUBLIC DEFINES
 ******************************************************************************/
 
 #define SUITE_CORE_TMR()   TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_TMR)  /*!< \addtogroup core_tmr      Core Timer Test  */
+#define SUITE_CORE_DICT()  TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_DICT) /*!< \addtogroup core_dict     Core Dictionary Image Test */
+#define SUITE_CORE_PARA()  TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_PARA) /*!< \addtogroup core_para     Core Parameter Log Test */
 
 #define SUITE_EXP_UP()     TS_DEF_SUITE(DEF_G_SDOS, DEF_S_EXP_UP)    /*!< \addtogroup sdos_exp_up   SDO Server Test: Expedited Upload   */
 #define SUITE_EXP_DOWN()   TS_DEF_SUITE(DEF_G_SDOS, DEF_S_EXP_DOWN)  /*!< \addtogroup sdos_exp_down SDO Server Test: Expedited Download */
@@ -102,11 +118,18 @@ typedef enum DEF_EMCY_SUITES_E {                      /*---- EMCY Management Tes
 #define SUITE_NMT_HBP()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_HBP)    /*!< \addtogroup nmt_hbp NMT Heartbeat Producer    */
 #define SUITE_NMT_HBC()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_HBC)    /*!< \addtogroup nmt_hbc NMT Heartbeat Consumer    */
 #define SUITE_NMT_LSS()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_LSS)    /*!< \addtogroup nmt_lss NMT Layer Setting Service */
+#define SUITE_NMT_MST()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_MST)    /*!< \addtogroup nmt_mst NMT Master                */
+#define SUITE_NMT_BOOT()   TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_BOOT)   /*!< \addtogroup nmt_boot NMT Boot Engine          */
+#define SUITE_NMT_LSS_MST() TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_LSS_MST) /*!< \addtogroup nmt_lss_mst LSS Master          */
 
 #define SUITE_EMCY_STATE() TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_STATE) /*!< \addtogroup emcy_state EMCY Error State Test           */
 #define SUITE_EMCY_ERR()   TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_ERR)   /*!< \addtogroup emcy_err   EMCY Error Register Test        */
 #define SUITE_EMCY_HIST()  TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_HIST)  /*!< \addtogroup emcy_hist  EMCY Error History Test         */
 #define SUITE_EMCY_API()   TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_API)   /*!< \addtogroup emcy_api   EMCY Application Interface Test */
+#define SUITE_EMCY_TX()    TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_TX)    /*!< \addtogroup emcy_tx    EMCY Transmit Queue Test        */
+#define SUITE_EMCY_CONS()  TS_DEF_SUITE(DEF_G_EMCY, DEF_S_EMCY_CONS)  /*!< \addtogroup emcy_cons  EMCY Consumer Test              */
+
+#define SUITE_BENCH_SDOS() TS_DEF_SUITE(DEF_G_BENCH, DEF_S_BENCH_SDOS) /*!< \addtogroup sdos_bench SDO Server Benchmark */
 
 
 #if DEF_G_NUM > TS_GROUP_MAX
@@ -133,4 +156,8 @@ typedef enum DEF_EMCY_SUITES_E {                      /*---- EMCY Management Tes
 #error "Suite Limit reached in DEF_S_EMCY_NUM!"
 #endif
 
+#if DEF_S_BENCH_NUM > TS_SUITE_MAX
+#error "Suite Limit reached in DEF_S_BENCH_NUM!"
+#endif
+
 #endif /* DEF_SUITE_H_ */
@@ -76,6 +76,7 @@ TS_DEF_MAIN(TS_Emcy_TxChangedId)
     TS_CreateMandatoryDir();
     TS_CreateNode(&node);
 
+    (void)CODictWrLong(&node.Dict,CO_DEV(0x1014,0),CO_EMCY_COBID_OFF | emcy_id);
     (void)CODictWrLong(&node.Dict,CO_DEV(0x1014,0),emcy_id);
 
     COEmcySet(&node.Emcy, 1, 0);                      /* register error #1 without user info      */
@@ -171,6 +172,87 @@ TS_DEF_MAIN(TS_Emcy_TotalNumError)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This test will check that the iteration over the detected EMCY errors is working.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Emcy_NextError)
+{
+    int16_t     err;                                  /* Local: identifier of EMCY error          */
+    CO_NODE     node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+
+    err = COEmcyNext(&node.Emcy, 0);                  /* check no detected error                  */
+    TS_ASSERT(err < 0);
+
+    COEmcySet(&node.Emcy, 1, 0);                      /* register error #1 and #3                 */
+    COEmcySet(&node.Emcy, 3, 0);
+
+    err = COEmcyNext(&node.Emcy, 0);
+    TS_ASSERT(1 == err);
+    err = COEmcyNext(&node.Emcy, 1);
+    TS_ASSERT(1 == err);
+    err = COEmcyNext(&node.Emcy, 2);
+    TS_ASSERT(3 == err);
+    err = COEmcyNext(&node.Emcy, 4);
+    TS_ASSERT(err < 0);
+    err = COEmcyNext(&node.Emcy, CO_EMCY_N);
+    TS_ASSERT(err < 0);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This test will check that the reset of all errors sends an EMCY message for the
+*          detected errors only.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Emcy_ResetDetectedOnly)
+{
+    CO_IF_FRM   frm;                                  /* Local: virtual CAN frame                 */
+    CO_NODE     node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+
+    COEmcySet(&node.Emcy, 0, 0);                      /* register error #0 and #2                 */
+    COEmcySet(&node.Emcy, 2, 0);
+    CHK_CAN  (&frm);
+    CHK_CAN  (&frm);
+
+    COEmcyReset(&node.Emcy, 0);                       /* reset errors                             */
+    CHK_CAN  (&frm);                                  /* check EMCY message for error #0          */
+    CHK_WORD (frm, 0, 0x0000);
+    CHK_BYTE (frm, 2, 0x05);
+    CHK_CAN  (&frm);                                  /* check EMCY message for error #2          */
+    CHK_WORD (frm, 0, 0x0000);
+    CHK_BYTE (frm, 2, 0x00);
+    CHK_NOCAN(&frm);                                  /* check no further EMCY message            */
+
+    TS_ASSERT(0 == COEmcyCnt(&node.Emcy));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This test will check the find first set primitive for all bit positions.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Emcy_FindFirstSet)
+{
+    uint8_t     n;
+                                                      /*------------------------------------------*/
+    for (n = 0; n < 32; n++) {
+        TS_ASSERT(n == COEmcyFfs((uint32_t)1 << n));
+        TS_ASSERT(n == COEmcyFfs(0xFFFFFFFFu << n));
+    }
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -187,6 +269,9 @@ SUITE_EMCY_API()
     TS_RUNNER(TS_Emcy_GetStatusError);
     TS_RUNNER(TS_Emcy_TotalNumNoError);
     TS_RUNNER(TS_Emcy_TotalNumError);
+    TS_RUNNER(TS_Emcy_NextError);
+    TS_RUNNER(TS_Emcy_ResetDetectedOnly);
+    TS_RUNNER(TS_Emcy_FindFirstSet);
 
 //    CanDiagnosticOff(0);
 
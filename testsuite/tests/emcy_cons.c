@@ -0,0 +1,223 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK EmcyConsCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the EMCY messages of consumed producers are decoded and counted, and the
+*         EMCY messages of other nodes are ignored.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyCons_Receive)
+{
+    CO_IF_FRM     frm;
+    CO_NODE       node;
+    CO_EMCY_CONS  cons;
+    CO_EMCY_PROD  prod[2] = { { 10 }, { 11 } };
+    CO_EMCY_PROD *p;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COEmcyConsInit(&cons, &node, prod, 2, TS_EmcyConsEvent));
+
+    TS_EMCY_SEND(0x8B, 0x3210, 0x05);                 /* EMCY of node 11                          */
+    CHK_NOCAN(&frm);
+    TS_ASSERT(1  == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(11 == EmcyConsCb.EmcyConsEvent_ArgNodeId);
+
+    p = COEmcyConsGet(&cons, 11);
+    TS_ASSERT(&prod[1] == p);
+    TS_ASSERT(1      == p->Num);
+    TS_ASSERT(1      == p->Err);
+    TS_ASSERT(0x3210 == p->Code);
+    TS_ASSERT(0x05   == p->Reg);
+    TS_ASSERT(0x11   == p->Usr[0]);
+    TS_ASSERT(0x55   == p->Usr[4]);
+
+    TS_EMCY_SEND(0x8B, 0x0000, 0x00);                 /* error reset of node 11                   */
+    TS_ASSERT(2 == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(2 == p->Num);
+    TS_ASSERT(1 == p->Err);
+    TS_ASSERT(0 == p->Code);
+
+    TS_EMCY_SEND(0x8C, 0x1000, 0x01);                 /* EMCY of not consumed node 12             */
+    TS_ASSERT(2 == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(0 == COEmcyConsGet(&cons, 12));
+    TS_ASSERT(0 == prod[0].Num);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the consumed COB-IDs are taken from the object entry 1028h, including
+*         disabled and non-default COB-IDs, and are kept over a communication reset.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyCons_CobId)
+{
+    CO_NODE       node;
+    CO_EMCY_CONS  cons;
+    CO_EMCY_PROD  prod[3] = { { 10 }, { 11 }, { 12 } };
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1028, 10, CO_UNSIGNED32|CO_OBJ_D__R_), 0, (uintptr_t)0x8000008A);
+    TS_ODAdd(CO_KEY(0x1028, 11, CO_UNSIGNED32|CO_OBJ_D__R_), 0, (uintptr_t)0x00000123);
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COEmcyConsInit(&cons, &node, prod, 3, TS_EmcyConsEvent));
+    TS_ASSERT(2 == cons.Ext);
+
+    TS_EMCY_SEND(0x8A,  0x1000, 0x01);                /* disabled producer node 10                */
+    TS_EMCY_SEND(0x8B,  0x1000, 0x01);                /* default COB-ID of node 11                */
+    TS_ASSERT(0 == EmcyConsCb.EmcyConsEvent_Called);
+
+    TS_EMCY_SEND(0x123, 0x1000, 0x01);                /* configured COB-ID of node 11             */
+    TS_ASSERT(1  == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(11 == EmcyConsCb.EmcyConsEvent_ArgNodeId);
+    TS_EMCY_SEND(0x8C,  0x1000, 0x01);                /* default COB-ID of node 12                */
+    TS_ASSERT(2  == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(12 == EmcyConsCb.EmcyConsEvent_ArgNodeId);
+
+    COEmcyConsSetFilter(&cons, 0xFF00, 0x2300);
+    CONmtReset(&node.Nmt, CO_RESET_COM);              /* reset communication                      */
+    TS_ASSERT(&cons == node.Emcy.Cons);
+    TS_ASSERT(0xFF00 == cons.Mask);
+    TS_ASSERT(0 == prod[1].Num);
+    TS_EMCY_SEND(0x123, 0x2310, 0x01);
+    TS_ASSERT(3 == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(1 == prod[1].Num);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the callback filter suppresses the callback only, while the statistics
+*         are updated for all EMCY messages.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyCons_Filter)
+{
+    CO_NODE       node;
+    CO_EMCY_CONS  cons;
+    CO_EMCY_PROD  prod[1] = { { 10 } };
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COEmcyConsInit(&cons, &node, prod, 1, TS_EmcyConsEvent));
+    COEmcyConsSetFilter(&cons, 0xFF00, 0x4200);       /* only temperature device errors           */
+
+    TS_EMCY_SEND(0x8A, 0x4210, 0x09);
+    TS_EMCY_SEND(0x8A, 0x3100, 0x05);
+    TS_EMCY_SEND(0x8A, 0x42FF, 0x09);
+    TS_ASSERT(2 == EmcyConsCb.EmcyConsEvent_Called);
+    TS_ASSERT(3 == prod[0].Num);
+    TS_ASSERT(3 == prod[0].Err);
+    TS_ASSERT(0x42FF == prod[0].Code);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check the EMCY rate estimation for a single EMCY message, an EMCY storm and a silent
+*         producer after the storm.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyCons_Rate)
+{
+    CO_NODE       node;
+    CO_EMCY_CONS  cons;
+    CO_EMCY_PROD  prod[1] = { { 10 } };
+    uint8_t       n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COEmcyConsInit(&cons, &node, prod, 1, TS_EmcyConsEvent));
+    TS_ASSERT(0 == COEmcyConsRate(&cons, 10));        /* no EMCY message received                 */
+
+    TS_EMCY_SEND(0x8A, 0x1000, 0x01);
+    TS_ASSERT(1 == COEmcyConsRate(&cons, 10));        /* single EMCY message                      */
+
+    for (n = 0; n < 10; n++) {                        /* EMCY storm: one message per 10ms         */
+        TS_Wait(&node, 10);
+        TS_EMCY_SEND(0x8A, 0x1000, 0x01);
+    }
+    TS_ASSERT(6000 == COEmcyConsRate(&cons, 10));
+
+    TS_Wait(&node, 1000);                             /* silent producer for 1s                   */
+    TS_ASSERT(60 == COEmcyConsRate(&cons, 10));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+static void EmcyConsSetup(void)
+{
+    TS_CallbackInit(&EmcyConsCb);
+}
+
+static void EmcyConsCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_EMCY_CONS()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(EmcyConsSetup, EmcyConsCleanup);
+
+    TS_RUNNER(TS_EmcyCons_Receive);
+    TS_RUNNER(TS_EmcyCons_CobId);
+    TS_RUNNER(TS_EmcyCons_Filter);
+    TS_RUNNER(TS_EmcyCons_Rate);
+
+    TS_End();
+}
@@ -335,6 +335,49 @@ TS_DEF_MAIN(TS_Emcy_HistClearBad)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This test will check that the history works as circular log after an overflow and
+*          after a reset of the history.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Emcy_HistWrapReset)
+{
+    CO_NODE        node;
+    uint8_t     hist_num;
+    uint32_t     hist;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(3 == node.Emcy.Hist.Max);               /* check length of history                  */
+
+    COEmcySet(&node.Emcy, 0, 0);                      /* register 4 errors in history of 3        */
+    COEmcySet(&node.Emcy, 1, 0);
+    COEmcySet(&node.Emcy, 2, 0);
+    COEmcySet(&node.Emcy, 3, 0);
+
+    (void)CODictRdByte(&node.Dict,CO_DEV(0x1003,0),&hist_num);
+    TS_ASSERT(3 == hist_num);
+    (void)CODictRdLong(&node.Dict,CO_DEV(0x1003,1),&hist);
+    TS_ASSERT(0x4000 == hist);
+    (void)CODictRdLong(&node.Dict,CO_DEV(0x1003,3),&hist);
+    TS_ASSERT(0x2000 == hist);
+
+    COEmcyHistReset(&node.Emcy);                      /* reset history                            */
+    COEmcyClr(&node.Emcy, 0);
+    COEmcySet(&node.Emcy, 0, 0);                      /* register error #0 again                  */
+
+    (void)CODictRdByte(&node.Dict,CO_DEV(0x1003,0),&hist_num);
+    TS_ASSERT(1 == hist_num);
+    (void)CODictRdLong(&node.Dict,CO_DEV(0x1003,1),&hist);
+    TS_ASSERT(0x1000 == hist);
+    hist = 0xFFFFFFFF;
+    (void)CODictRdLong(&node.Dict,CO_DEV(0x1003,2),&hist);
+    TS_ASSERT(0 == hist);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -358,6 +401,7 @@ SUITE_EMCY_HIST()
     TS_RUNNER(TS_Emcy_HistObjOnReset);
     TS_RUNNER(TS_Emcy_HistClearOk);
     TS_RUNNER(TS_Emcy_HistClearBad);
+    TS_RUNNER(TS_Emcy_HistWrapReset);
 
 //    CanDiagnosticOff(0);
 
@@ -0,0 +1,335 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* object entry variables for 0x1014:0 (COB-ID EMCY) and 0x1015:0 (inhibit time EMCY) */
+static uint32_t EmcyCobId;
+static uint16_t EmcyInhibit;
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that an EMCY message within the inhibit time is delayed until the end of the
+*         inhibit time.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_Inhibit)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 200;                                /* inhibit time: 20ms                       */
+    TS_CreateNode(&node);
+
+    COEmcySet(&node.Emcy, 1, 0);                      /* register error #1                        */
+    CHK_CAN  (&frm);                                  /* check for immediate EMCY message         */
+    CHK_EMCY (frm);
+    CHK_WORD (frm, 0, 0x2000);
+
+    COEmcySet(&node.Emcy, 2, 0);                      /* register error #2 within inhibit time    */
+    CHK_NOCAN(&frm);                                  /* check for delayed EMCY message           */
+    TS_Wait(&node, 10);
+    CHK_NOCAN(&frm);
+    TS_Wait(&node, 10);                               /* end of inhibit time                      */
+    CHK_CAN  (&frm);
+    CHK_EMCY (frm);
+    CHK_WORD (frm, 0, 0x3000);
+    CHK_BYTE (frm, 2, 0x07);
+    CHK_NOCAN(&frm);
+
+    TS_Wait(&node, 20);                               /* inhibit time of second message elapsed   */
+    COEmcySet(&node.Emcy, 3, 0);                      /* register error #3                        */
+    CHK_CAN  (&frm);                                  /* check for immediate EMCY message         */
+    CHK_WORD (frm, 0, 0x4000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the queued EMCY messages are transmitted in order, one message per inhibit
+*         time.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_Order)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 100;                                /* inhibit time: 10ms                       */
+    TS_CreateNode(&node);
+
+    COEmcySet(&node.Emcy, 0, 0);
+    COEmcySet(&node.Emcy, 1, 0);
+    COEmcySet(&node.Emcy, 2, 0);
+    COEmcySet(&node.Emcy, 3, 0);
+    CHK_CAN  (&frm);
+    CHK_WORD (frm, 0, 0x1000);
+    CHK_NOCAN(&frm);
+    TS_ASSERT(3 == node.Emcy.Tx.Num);
+
+    TS_Wait(&node, 10);
+    CHK_CAN  (&frm);
+    CHK_WORD (frm, 0, 0x2000);
+    CHK_NOCAN(&frm);
+    TS_Wait(&node, 10);
+    CHK_CAN  (&frm);
+    CHK_WORD (frm, 0, 0x3000);
+    CHK_NOCAN(&frm);
+    TS_Wait(&node, 10);
+    CHK_CAN  (&frm);
+    CHK_WORD (frm, 0, 0x4000);
+    CHK_NOCAN(&frm);
+    TS_ASSERT(0 == node.Emcy.Tx.Num);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a set and clear of the same error within the inhibit time are coalesced,
+*         while the error history and error register are still updated.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_Coalesce)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint8_t   reg;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 200;                                /* inhibit time: 20ms                       */
+    TS_CreateNode(&node);
+
+    COEmcySet(&node.Emcy, 1, 0);                      /* register error #1                        */
+    CHK_CAN  (&frm);
+
+    COEmcySet(&node.Emcy, 2, 0);                      /* flapping error #2 within inhibit time    */
+    COEmcyClr(&node.Emcy, 2);
+    COEmcySet(&node.Emcy, 2, 0);
+    COEmcyClr(&node.Emcy, 2);
+    TS_ASSERT(0 == node.Emcy.Tx.Num);
+
+    TS_Wait(&node, 50);
+    CHK_NOCAN(&frm);                                  /* check no EMCY message for error #2       */
+
+    TS_ASSERT(3 == node.Emcy.Hist.Num);               /* check history of error #1 and 2x #2      */
+    (void)CODictRdByte(&node.Dict, CO_DEV(0x1001, 0), &reg);
+    TS_ASSERT(0x03 == reg);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that EMCY messages are dropped and counted, when the transmit queue is full.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_QueueFull)
+{
+    CO_NODE     node;
+    CO_EMCY_MSG msg = { 0 };
+    uint8_t     n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 200;                                /* inhibit time: 20ms                       */
+    TS_CreateNode(&node);
+
+    msg.State = 1;
+    for (n = 0; n < (CO_EMCY_QUEUE_N + 2); n++) {
+        msg.Err = n;
+        COEmcyTxQueue(&node.Emcy, &msg);
+    }
+    TS_ASSERT(CO_EMCY_QUEUE_N == node.Emcy.Tx.Num);
+    TS_ASSERT(2 == node.Emcy.Tx.Lost);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a written inhibit time and an invalid COB-ID are taken over without a reset
+*         of the node.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_CfgWrite)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 0;                                  /* no inhibit time                          */
+    TS_CreateNode(&node);
+
+    COEmcySet(&node.Emcy, 1, 0);
+    COEmcySet(&node.Emcy, 2, 0);
+    CHK_CAN  (&frm);
+    CHK_CAN  (&frm);
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrWord(&node.Dict, CO_DEV(0x1015, 0), 100));
+    COEmcySet(&node.Emcy, 3, 0);
+    COEmcyClr(&node.Emcy, 1);
+    CHK_CAN  (&frm);
+    CHK_NOCAN(&frm);
+    TS_Wait(&node, 10);
+    CHK_CAN  (&frm);
+    CHK_WORD (frm, 0, 0x0000);
+
+    TS_Wait(&node, 10);
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x80000081));
+    COEmcyClr(&node.Emcy, 2);
+    CHK_NOCAN(&frm);                                  /* check no EMCY with invalid COB-ID        */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a written COB-ID with reserved or extended frame bits and a change of a valid
+*         COB-ID are rejected.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_CfgRange)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1014, 0, CO_UNSIGNED32|CO_OBJ__N_RW), CO_TEMCY_CFG, (uintptr_t)&EmcyCobId);
+    TS_ODAdd(OBJ1015_0(&EmcyInhibit));
+    EmcyCobId   = 0x80;
+    EmcyInhibit = 0;                                  /* no inhibit time                          */
+    TS_CreateNode(&node);
+
+    TS_ASSERT(CO_ERR_OBJ_RANGE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x40000081));
+    TS_ASSERT(CO_ERR_OBJ_RANGE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x20000081));
+    TS_ASSERT(CO_ERR_OBJ_RANGE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x00000091));
+    COEmcySet(&node.Emcy, 1, 0);
+    CHK_CAN  (&frm);                                  /* check EMCY with unchanged COB-ID         */
+    TS_ASSERT(0x81 == frm.Identifier);
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x80000081));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1014, 0), 0x00000091));
+    COEmcySet(&node.Emcy, 2, 0);
+    CHK_CAN  (&frm);                                  /* check EMCY with changed COB-ID           */
+    TS_ASSERT(0x91 == frm.Identifier);
+
+    CHK_ERR(&node, CO_ERR_OBJ_WRITE);                 /* check for expected error                 */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a node without EMCY code table boots and resets the communication without
+*         access to the EMCY management.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_EmcyTx_NoEmcy)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NODE_SPEC spec;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    memset(&node, 0xA5, sizeof(node));                /* node memory is not initialized           */
+    TS_CreateSpec(&node, &spec);
+    spec.EmcyCode = 0;                                /* node without EMCY code table             */
+    CONodeInit(&node, &spec);
+    CONodeStart(&node);
+    CHK_CAN  (&frm);                                  /* check bootup message                     */
+    CHK_BOOTUP(frm, 1);
+
+    CONmtReset(&node.Nmt, CO_RESET_COM);              /* reset communication                      */
+    CHK_CAN  (&frm);                                  /* check bootup message                     */
+    CHK_BOOTUP(frm, 1);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_EMCY_TX()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_EmcyTx_Inhibit);
+    TS_RUNNER(TS_EmcyTx_Order);
+    TS_RUNNER(TS_EmcyTx_Coalesce);
+    TS_RUNNER(TS_EmcyTx_QueueFull);
+    TS_RUNNER(TS_EmcyTx_CfgWrite);
+    TS_RUNNER(TS_EmcyTx_CfgRange);
+    TS_RUNNER(TS_EmcyTx_NoEmcy);
+
+    TS_End();
+}
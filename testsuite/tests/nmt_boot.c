@@ -0,0 +1,406 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK NmtBootCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t BootRec(uint8_t *img, uint16_t idx, uint8_t sub, uint32_t len, uint8_t val)
+{
+    uint32_t n;
+
+    img[0] = (uint8_t)(idx);
+    img[1] = (uint8_t)(idx >> 8);
+    img[2] = sub;
+    img[3] = (uint8_t)(len);
+    img[4] = (uint8_t)(len >> 8);
+    img[5] = (uint8_t)(len >> 16);
+    img[6] = (uint8_t)(len >> 24);
+    for (n = 0; n < len; n++) {
+        img[CO_DICT_IMG_HDR + n] = (uint8_t)(val + n);
+    }
+    return (CO_DICT_IMG_HDR + len);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check the configuration of a slave with expedited downloads, which starts when the
+*         slave reports pre-operational.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Expedited)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave = { 10 };
+    CO_NMT_CFG   cfg   = { 0 };
+    uint8_t      img[32];
+
+    cfg.NodeId = 10;
+    cfg.Img    = img;
+    cfg.Len    = BootRec(&img[0], 0x2100, 1, 4, 0x11);
+    cfg.Len   += BootRec(&img[cfg.Len], 0x2100, 2, 1, 0x22);
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, &cfg, 1, 1, 4));
+    TS_Wait(&node, 50);
+    CHK_NOCAN   (&frm);                               /* check for no request before boot-up      */
+    TS_ASSERT(1 == CONmtBootPending(&boot));
+
+    TS_HB_SEND(10, 0);
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x23);                      /* check for expedited 4 byte download      */
+    TS_ASSERT(0x2100     == WORD(frm, 1));
+    TS_ASSERT(1          == BYTE(frm, 3));
+    TS_ASSERT(0x14131211 == LONG(frm, 4));
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+                                                      /*------------------------------------------*/
+    TS_SDOC_RESP(10, 0x60, 0x2100, 1, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x2F);                      /* check for expedited 1 byte download      */
+    TS_ASSERT(2          == BYTE(frm, 3));
+    TS_ASSERT(0x22       == BYTE(frm, 4));
+    TS_ASSERT((11 * 100) / 19 == CONmtBootProgress(&boot, 10));
+
+    TS_SDOC_RESP(10, 0x60, 0x2100, 2, 0);
+    CHK_NOCAN   (&frm);                               /* check for no start without flag          */
+    TS_ASSERT(CO_NMT_CFG_DONE == cfg.State);
+    TS_ASSERT(2   == cfg.Num);
+    TS_ASSERT(100 == CONmtBootProgress(&boot, 10));
+    TS_ASSERT(0   == CONmtBootPending(&boot));
+    TS_ASSERT(1   == NmtBootCb.NmtMstEvent_Called[CO_NMT_MST_CONFIG]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check the configuration of a slave with a segmented download and the start of the
+*         slave after the configuration.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Segmented)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave = { 10 };
+    CO_NMT_CFG   cfg   = { 0 };
+    uint8_t      img[32];
+
+    slave.Flags = CO_NMT_MST_START;
+    cfg.NodeId  = 10;
+    cfg.Img     = img;
+    cfg.Len     = BootRec(&img[0], 0x2200, 0, 10, 0x30);
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, &cfg, 1, 1, 4));
+    TS_HB_SEND(10, 127);
+    TS_Wait(&node, 10);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x21);                      /* check for segmented download initiate    */
+    TS_ASSERT(0x2200     == WORD(frm, 1));
+    TS_ASSERT(10         == LONG(frm, 4));
+
+    TS_SDOC_RESP(10, 0x60, 0x2200, 0, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x00);                      /* check for first segment with 7 bytes     */
+    TS_ASSERT(0x30       == BYTE(frm, 1));
+    TS_ASSERT(0x36       == BYTE(frm, 7));
+
+    TS_SDOC_RESP(10, 0x20, 0, 0, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x19);                      /* check for last segment with 3 bytes      */
+    TS_ASSERT(0x37       == BYTE(frm, 1));
+    TS_ASSERT(0x39       == BYTE(frm, 3));
+    TS_ASSERT(0x00       == BYTE(frm, 4));
+                                                      /*------------------------------------------*/
+    TS_SDOC_RESP(10, 0x30, 0, 0, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 10);                         /* check for node specific start command    */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+    TS_ASSERT(CO_NMT_CFG_DONE == cfg.State);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the number of parallel configurations and the number of SDO requests per
+*         tick are limited.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Budget)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave[4] = { { 10 }, { 11 }, { 12 }, { 13 } };
+    CO_NMT_CFG   cfg[4]   = { { 0 }, { 0 }, { 0 }, { 0 } };
+    uint8_t      img[16];
+    uint32_t     len;
+    uint8_t      n;
+
+    len = BootRec(&img[0], 0x2100, 1, 4, 0x11);
+    for (n = 0; n < 4; n++) {
+        cfg[n].NodeId = (uint8_t)(10 + n);
+        cfg[n].Img    = img;
+        cfg[n].Len    = len;
+    }
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 4, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, cfg, 4, 3, 2));
+    for (n = 0; n < 4; n++) {
+        TS_HB_SEND(10 + n, 127);
+    }
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x23);                      /* check for request to first slave         */
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 11, 0x23);                      /* check for request to second slave        */
+    CHK_NOCAN   (&frm);                               /* check for request budget reached         */
+
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 12, 0x23);                      /* check for request to third slave         */
+    CHK_NOCAN   (&frm);                               /* check for parallel limit reached         */
+    TS_ASSERT(CO_NMT_CFG_WAIT == cfg[3].State);
+                                                      /*------------------------------------------*/
+    TS_SDOC_RESP(11, 0x60, 0x2100, 1, 0);
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 13, 0x23);                      /* check for request to fourth slave        */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_SDOC_RESP(10, 0x60, 0x2100, 1, 0);
+    TS_SDOC_RESP(12, 0x60, 0x2100, 1, 0);
+    TS_SDOC_RESP(13, 0x60, 0x2100, 1, 0);
+    TS_ASSERT(0 == CONmtBootPending(&boot));
+    TS_ASSERT(4 == NmtBootCb.NmtMstEvent_Called[CO_NMT_MST_CONFIG]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that an SDO abort of the slave finishes the configuration with the abort code.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Abort)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave = { 10 };
+    CO_NMT_CFG   cfg   = { 0 };
+    uint8_t      img[32];
+
+    slave.Flags = CO_NMT_MST_START;
+    cfg.NodeId  = 10;
+    cfg.Img     = img;
+    cfg.Len     = BootRec(&img[0], 0x2100, 1, 4, 0x11);
+    cfg.Len    += BootRec(&img[cfg.Len], 0x2100, 2, 1, 0x22);
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, &cfg, 1, 1, 4));
+    TS_HB_SEND(10, 127);
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+
+    TS_SDOC_RESP(10, 0x80, 0x2100, 1, 0x06020000);
+    CHK_NOCAN   (&frm);                               /* check for no start of slave              */
+
+    TS_ASSERT(CO_NMT_CFG_ERROR == cfg.State);
+    TS_ASSERT(0x06020000 == cfg.Abort);
+    TS_ASSERT(0 == cfg.Num);
+    TS_ASSERT(0 == CONmtBootPending(&boot));
+    TS_ASSERT(1 == NmtBootCb.NmtMstEvent_Called[CO_NMT_MST_CONFIG_ERR]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a missing SDO response aborts the configuration after the timeout.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Timeout)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave = { 10 };
+    CO_NMT_CFG   cfg   = { 0 };
+    uint8_t      img[16];
+
+    cfg.NodeId = 10;
+    cfg.Img    = img;
+    cfg.Len    = BootRec(&img[0], 0x2100, 1, 4, 0x11);
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, &cfg, 1, 1, 4));
+    TS_HB_SEND(10, 127);
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+
+    TS_Wait(&node, CO_NMT_BOOT_TIMEOUT - 20);
+    CHK_NOCAN   (&frm);                               /* check for no abort before timeout        */
+    TS_Wait(&node, 20);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x80);                      /* check for SDO abort                      */
+    TS_ASSERT(0x05040000 == LONG(frm, 4));
+
+    TS_ASSERT(CO_NMT_CFG_ERROR == cfg.State);
+    TS_ASSERT(0x05040000 == cfg.Abort);
+    TS_ASSERT(CO_NMT_BOOT_TIMEOUT == cfg.Time);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a boot-up of the slave restarts the configuration and delays the automatic
+*         start of the slave.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtBoot_Restart)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_BOOT  boot;
+    CO_NMT_SLAVE slave = { 10 };
+    CO_NMT_CFG   cfg   = { 0 };
+    uint8_t      img[32];
+
+    slave.Flags = CO_NMT_MST_START;
+    cfg.NodeId  = 10;
+    cfg.Img     = img;
+    cfg.Len     = BootRec(&img[0], 0x2100, 1, 4, 0x11);
+    cfg.Len    += BootRec(&img[cfg.Len], 0x2100, 2, 1, 0x22);
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtBootInit(&boot, &mst, &cfg, 1, 1, 4));
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetMode(&mst, CO_OPERATIONAL));
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    TS_HB_SEND(10, 0);
+    CHK_NOCAN   (&frm);                               /* check for no start before configuration  */
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    TS_SDOC_RESP(10, 0x60, 0x2100, 1, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x2F);                      /* check for second record                  */
+                                                      /*------------------------------------------*/
+    TS_HB_SEND(10, 0);
+    TS_SDOC_RESP(10, 0x60, 0x2100, 2, 0);
+    CHK_NOCAN   (&frm);                               /* check for ignored stale response         */
+    TS_Wait(&node, 10);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDOC    (frm, 10, 0x23);                      /* check for restart with first record      */
+    TS_SDOC_RESP(10, 0x60, 0x2100, 1, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    TS_SDOC_RESP(10, 0x60, 0x2100, 2, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 10);                         /* check for node specific start command    */
+    TS_ASSERT(1 == NmtBootCb.NmtMstEvent_Called[CO_NMT_MST_CONFIG]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+static void NmtBootSetup(void)
+{
+    TS_CallbackInit(&NmtBootCb);
+}
+
+static void NmtBootCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_NMT_BOOT()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(NmtBootSetup, NmtBootCleanup);
+
+    TS_RUNNER(TS_NmtBoot_Expedited);
+    TS_RUNNER(TS_NmtBoot_Segmented);
+    TS_RUNNER(TS_NmtBoot_Budget);
+    TS_RUNNER(TS_NmtBoot_Abort);
+    TS_RUNNER(TS_NmtBoot_Timeout);
+    TS_RUNNER(TS_NmtBoot_Restart);
+
+    TS_End();
+}
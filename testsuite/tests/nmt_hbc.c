@@ -41,7 +41,7 @@ TS_DEF_MAIN(TS_HBCons_RdEntry)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     CODictRdLong(&node.Dict, CO_DEV(0x1016, 1), &value);
@@ -70,7 +70,7 @@ TS_DEF_MAIN(TS_HBCons_WaitForHb)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_Wait(&node, 200);
@@ -101,7 +101,7 @@ TS_DEF_MAIN(TS_HBCons_CheckState)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -132,7 +132,7 @@ TS_DEF_MAIN(TS_HBCons_SingleEvent)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -164,7 +164,7 @@ TS_DEF_MAIN(TS_HBCons_MultiEvent)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -196,7 +196,7 @@ TS_DEF_MAIN(TS_HBCons_NoEvent)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -229,7 +229,7 @@ TS_DEF_MAIN(TS_HBCons_Jitter)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -266,7 +266,7 @@ TS_DEF_MAIN(TS_HBCons_MasterId)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(0, 5);
@@ -327,7 +327,7 @@ TS_DEF_MAIN(TS_HBCons_OtherConsumer)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -366,8 +366,8 @@ TS_DEF_MAIN(TS_HBCons_MultiConsumer)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)2);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data1);
-    TS_ODAdd(CO_KEY(0x1016, 2, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uint32_t)&data2);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data1);
+    TS_ODAdd(CO_KEY(0x1016, 2, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data2);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -404,7 +404,7 @@ TS_DEF_MAIN(TS_HBCons_WrEntry)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     CODictWrLong(&node.Dict, CO_DEV(0x1016, 1), value);
@@ -432,7 +432,7 @@ TS_DEF_MAIN(TS_HBCons_DynEvent)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     CODictWrLong(&node.Dict, CO_DEV(0x1016, 1), value);
@@ -464,7 +464,7 @@ TS_DEF_MAIN(TS_HBCons_DynSdoError)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -501,7 +501,7 @@ TS_DEF_MAIN(TS_HBCons_DynSdoDisable)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
-    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_HB_SEND(10, 5);
@@ -519,6 +519,174 @@ TS_DEF_MAIN(TS_HBCons_DynSdoDisable)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC16
+*
+*          Check that an active consumer is moved to another node-id, when the entry is written
+*          with a new node-id.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_HBCons_DynNodeChange)
+{
+    CO_NODE        node;
+    CO_HBCONS      data  = { 0 };
+    int16_t     events;
+
+    data.NodeId = 10;
+    data.Time   = 50;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
+    TS_CreateNode(&node);
+                                                      /*------------------------------------------*/
+    TS_SDO_SEND (0x23, 0x1016, 1, 0x007F0032);
+
+    CHK_SDO0_OK(0x1016, 1);
+
+    TS_HB_SEND(127, 5);
+    TS_HB_SEND(10, 5);
+
+    TS_ASSERT(CO_OPERATIONAL == CONmtLastHbState(&node.Nmt, 127));
+    TS_ASSERT(CO_INVALID == CONmtLastHbState(&node.Nmt, 10));
+
+    TS_Wait(&node, 60);
+
+    events = CONmtGetHbEvents(&node.Nmt, 127);
+    TS_ASSERT(1 == events);
+
+    events = CONmtGetHbEvents(&node.Nmt, 10);
+    TS_ASSERT(-1 == events);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC17
+*
+*          Check that the SDO abort is generated correctly, if a heartbeat consumer is
+*          activated for a node-id out of the range 0..127.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_HBCons_DynSdoBadId)
+{
+    CO_NODE        node;
+    CO_HBCONS      data  = { 0 };
+    int16_t     events;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____RW), CO_THB_CONS, (uintptr_t)&data);
+    TS_CreateNode(&node);
+                                                      /*------------------------------------------*/
+    TS_SDO_SEND (0x23, 0x1016, 1, 0x00800032);
+
+    CHK_SDO0_ERR(0x1016, 1, 0x06090030);
+
+    events = CONmtGetHbEvents(&node.Nmt, 128);
+    TS_ASSERT(-1 == events);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC18
+*
+*          This testcase will focus on the situation:
+*            HBP1 : O---------- (O: heartbeat)
+*            HBC1 : |....!....! (!: heartbeat consumer check/event)
+*            HBP2 : O---------- (O: heartbeat)
+*            HBC2 : |.........! (!: heartbeat consumer check/event)
+*          Check that the consumers with different times are detected at their own deadline.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_HBCons_MultiDeadline)
+{
+    CO_NODE        node;
+    CO_HBCONS      data1 = { 0 };
+    CO_HBCONS      data2 = { 0 };
+    int16_t     events;
+
+    data1.NodeId = 10;
+    data1.Time   = 50;
+
+    data2.NodeId = 20;
+    data2.Time   = 100;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)2);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data1);
+    TS_ODAdd(CO_KEY(0x1016, 2, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data2);
+    TS_CreateNode(&node);
+                                                      /*------------------------------------------*/
+    TS_HB_SEND(10, 5);
+    TS_HB_SEND(20, 5);
+    TS_Wait(&node, 60);
+
+    events = CONmtGetHbEvents(&node.Nmt, 10);
+    TS_ASSERT(1 == events);
+    events = CONmtGetHbEvents(&node.Nmt, 20);
+    TS_ASSERT(0 == events);
+
+    TS_Wait(&node, 50);
+
+    events = CONmtGetHbEvents(&node.Nmt, 10);
+    TS_ASSERT(1 == events);
+    events = CONmtGetHbEvents(&node.Nmt, 20);
+    TS_ASSERT(1 == events);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC19
+*
+*          Check that the heartbeat reception of multiple consumers doesn't use timer actions.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_HBCons_TmrUsage)
+{
+    CO_NODE        node;
+    CO_HBCONS      data[3] = { { 0 }, { 0 }, { 0 } };
+    CO_TMR_ACTION *act;
+    uint32_t       before = 0;
+    uint32_t       after  = 0;
+    uint8_t        n;
+
+    for (n = 0; n < 3; n++) {
+        data[n].NodeId = (uint8_t)(10 + n);
+        data[n].Time   = 50;
+    }
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)3);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x1016, 2, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x1016, 3, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data[2]);
+    TS_CreateNode(&node);
+                                                      /*------------------------------------------*/
+    for (act = node.Tmr.Acts; act != 0; act = act->Next) {
+        before++;
+    }
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 5);
+    }
+    TS_Wait(&node, 20);
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 5);
+    }
+    for (act = node.Tmr.Acts; act != 0; act = act->Next) {
+        after++;
+    }
+    TS_ASSERT(before == after);
+
+    for (n = 0; n < 3; n++) {
+        TS_ASSERT(0 == CONmtGetHbEvents(&node.Nmt, 10 + n));
+    }
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -544,6 +712,10 @@ SUITE_NMT_HBC()
     TS_RUNNER(TS_HBCons_DynEvent);
     TS_RUNNER(TS_HBCons_DynSdoError);
     TS_RUNNER(TS_HBCons_DynSdoDisable);
+    TS_RUNNER(TS_HBCons_DynNodeChange);
+    TS_RUNNER(TS_HBCons_DynSdoBadId);
+    TS_RUNNER(TS_HBCons_MultiDeadline);
+    TS_RUNNER(TS_HBCons_TmrUsage);
 
 //    CanDiagnosticOff(0);
 
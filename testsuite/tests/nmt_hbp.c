@@ -38,7 +38,7 @@ TS_DEF_MAIN(TS_HBProd_Disable)
     uint16_t     time = 0;
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uint32_t)&time);
+    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uintptr_t)&time);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_Wait(&node, 1000);                             /* wait 1000ms                              */
@@ -61,7 +61,7 @@ TS_DEF_MAIN(TS_HBProd_PreOperational)
     uint16_t     time = 50;
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uint32_t)&time);
+    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uintptr_t)&time);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_Wait(&node, 50);                               /* wait heartbeat time                      */
@@ -86,7 +86,7 @@ TS_DEF_MAIN(TS_HBProd_Operational)
     uint16_t     time = 50;
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uint32_t)&time);
+    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uintptr_t)&time);
     TS_CreateNode(&node);
                                                       /*------------------------------------------*/
     TS_NMT_SEND(0x01, 1);                            /* set node-id 0x01 to operational          */
@@ -98,6 +98,48 @@ TS_DEF_MAIN(TS_HBProd_Operational)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check:
+*          - the heartbeat jitter is measured, when the timer processing is delayed.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_HBProd_Jitter)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  time = 100;
+    uint8_t   n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1017, 0, CO_UNSIGNED16|CO_OBJ____RW), CO_THB_PROD, (uintptr_t)&time);
+    TS_CreateNode(&node);
+                                                      /*------------------------------------------*/
+    TS_Wait(&node, 1000);                             /* wait 10 heartbeat times                  */
+    TS_ASSERT(10 == node.Nmt.HbStat.Num);
+    TS_ASSERT(0  == CONmtHbJitter(&node.Nmt));
+
+    for (n = 0; n < 12; n++) {                        /* delay timer processing by 20ms           */
+        (void)COTmrService(&node.Tmr);
+    }
+    COTmrProcess(&node.Tmr);
+    TS_ASSERT(11 == node.Nmt.HbStat.Num);
+    TS_ASSERT(20 == CONmtHbJitter(&node.Nmt));
+                                                      /*------------------------------------------*/
+    CONmtHbStatReset(&node.Nmt);
+    TS_ASSERT(0  == node.Nmt.HbStat.Num);
+    TS_ASSERT(0  == CONmtHbJitter(&node.Nmt));
+    TS_Wait(&node, 200);
+    TS_ASSERT(2  == node.Nmt.HbStat.Num);
+    TS_ASSERT(0  == CONmtHbJitter(&node.Nmt));
+
+    while (GetFrm(0, (uint8_t *)&frm, sizeof(CO_IF_FRM)) == 1) {
+        CHK_NMT(frm, 1, 127);                         /* check for heartbeat messages only        */
+    }
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -111,6 +153,7 @@ SUITE_NMT_HBP()
     TS_RUNNER(TS_HBProd_Disable);
     TS_RUNNER(TS_HBProd_PreOperational);
     TS_RUNNER(TS_HBProd_Operational);
+    TS_RUNNER(TS_HBProd_Jitter);
 
 //    CanDiagnosticOff(0);
 
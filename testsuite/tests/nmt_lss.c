@@ -97,10 +97,10 @@ TS_DEF_MAIN(TS_Lss_SelIdent_WrongVendor)
 
     /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&vendor);
-    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&product);
-    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&revision);
-    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&serial);
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
     TS_CreateNode(&node);
     /*------------------------------------------*/
 
@@ -131,10 +131,10 @@ TS_DEF_MAIN(TS_Lss_SelIdent_WrongProduct)
 
     /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&vendor);
-    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&product);
-    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&revision);
-    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&serial);
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
     TS_CreateNode(&node);
     /*------------------------------------------*/
 
@@ -165,10 +165,10 @@ TS_DEF_MAIN(TS_Lss_SelIdent_WrongRevision)
 
     /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&vendor);
-    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&product);
-    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&revision);
-    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&serial);
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
     TS_CreateNode(&node);
     /*------------------------------------------*/
 
@@ -199,10 +199,10 @@ TS_DEF_MAIN(TS_Lss_SelIdent_WrongSerial)
 
     /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&vendor);
-    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&product);
-    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&revision);
-    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&serial);
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
     TS_CreateNode(&node);
     /*------------------------------------------*/
 
@@ -232,10 +232,10 @@ TS_DEF_MAIN(TS_Lss_SelIdent_Ok)
 
     /*------------------------------------------*/
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&vendor);
-    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&product);
-    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&revision);
-    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uint32_t)&serial);
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
     TS_CreateNode(&node);
     /*------------------------------------------*/
 
@@ -249,6 +249,94 @@ TS_DEF_MAIN(TS_Lss_SelIdent_Ok)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check:
+*          - The LSS requests with unused command specifiers are consumed and ignored.
+*          - The fastscan is ignored by a node with a node ID.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Lss_UnusedCmd)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+
+    /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    /*------------------------------------------*/
+
+    TS_LSS_SEND(  0, 1, 0);
+    TS_LSS_SEND( 18, 1, 0);
+    TS_LSS_SEND(255, 1, 0);
+    TS_LSS_FS_SEND(0, 0x80, 0, 0);                    /* fastscan reset                           */
+    CHK_NOCAN(&frm);
+    TS_ASSERT(CO_LSS_WAIT == node.Lss.Mode);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check:
+*          - The fastscan of a node without node ID responds for matching bits only.
+*          - The node switches to configuration mode with the complete LSS address.
+*          - The node with a configured node ID takes no part in the following fastscan.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Lss_Fastscan)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  vendor = 0x11000011;
+    uint32_t  product = 0x22000022;
+    uint32_t  revision = 0x33000033;
+    uint32_t  serial = 0x44000044;
+
+    /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&vendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&product);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&revision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&serial);
+    TS_CreateNode(&node);
+    node.NodeId = 0xFF;                               /* node without node ID                     */
+    /*------------------------------------------*/
+
+    TS_LSS_FS_SEND(0, 31, 0, 0);                      /* bit check without reset                  */
+    CHK_NOCAN(&frm);
+
+    TS_LSS_FS_SEND(0, 0x80, 0, 0);                    /* fastscan reset                           */
+    CHK_LSS_OK(79);
+    TS_LSS_FS_SEND(0x00000000, 28, 0, 0);             /* vendor bits 31..28 = 0000b               */
+    CHK_NOCAN(&frm);
+    TS_LSS_FS_SEND(0x10000000, 28, 0, 0);             /* vendor bits 31..28 = 0001b               */
+    CHK_LSS_OK(79);
+    TS_LSS_FS_SEND(vendor, 0, 1, 1);                  /* wrong LSS address part                   */
+    CHK_NOCAN(&frm);
+
+    TS_LSS_FS_SEND(vendor,   0, 0, 1);                /* confirm LSS address parts                */
+    CHK_LSS_OK(79);
+    TS_LSS_FS_SEND(product,  0, 1, 2);
+    CHK_LSS_OK(79);
+    TS_LSS_FS_SEND(revision, 0, 2, 3);
+    CHK_LSS_OK(79);
+    TS_ASSERT(CO_LSS_WAIT == node.Lss.Mode);
+    TS_LSS_FS_SEND(serial,   0, 3, 0);
+    CHK_LSS_OK(79);
+    TS_ASSERT(CO_LSS_CONF == node.Lss.Mode);
+
+    TS_LSS_SEND(17, 12, 0);                           /* configure node ID                        */
+    CHK_LSS_OK(17);
+    TS_LSS_SEND( 4, 0, 0);                            /* global switch to waiting mode            */
+    TS_LSS_FS_SEND(0, 0x80, 0, 0);                    /* fastscan reset                           */
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 static void NmtLssSetup(void)
 {
     TS_CallbackInit(&NmtLssCb);
@@ -277,6 +365,8 @@ SUITE_NMT_LSS()
     TS_RUNNER(TS_Lss_SelIdent_WrongRevision);
     TS_RUNNER(TS_Lss_SelIdent_WrongSerial);
     TS_RUNNER(TS_Lss_SelIdent_Ok);
+    TS_RUNNER(TS_Lss_UnusedCmd);
+    TS_RUNNER(TS_Lss_Fastscan);
 
     //    CanDiagnosticOff(0);
 
@@ -0,0 +1,272 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK LssMstCb;
+
+/* LSS address of the scanned node */
+static uint32_t LssVendor   = 0x0000031A;
+static uint32_t LssProduct  = 0x8000FFFF;
+static uint32_t LssRevision = 0x00010002;
+static uint32_t LssSerial   = 0x5A5AA5A5;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* loop back all transmitted LSS frames: the node scans its own LSS slave */
+static void MstLoopback(void)
+{
+    CO_IF_FRM frm;
+
+    while (GetFrm(0, (uint8_t *)&frm, sizeof(CO_IF_FRM)) == 1) {
+        SetRxFrm(0, 0, frm.Identifier, frm.DLC,
+                 frm.Data[0], frm.Data[1], frm.Data[2], frm.Data[3],
+                 frm.Data[4], frm.Data[5], frm.Data[6], frm.Data[7]);
+        RunSimCan(0, 0);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the fastscan without a responding slave is finished after a single response
+*         timeout.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_LssMst_None)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    CO_LSS_MST mst;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COLssMstInit(&mst, &node, 10, TS_LssMstEvent));
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstFastscan(&mst));
+    TS_ASSERT(CO_ERR_NONE != COLssMstFastscan(&mst)); /* check busy LSS master                    */
+    CHK_CAN  (&frm);                                  /* check fastscan reset                     */
+    TS_ASSERT(2021 == frm.Identifier);
+    CHK_BYTE (frm, 0, 81);
+    CHK_BYTE (frm, 5, 0x80);
+    CHK_NOCAN(&frm);
+
+    TS_Wait(&node, 10);
+    CHK_NOCAN(&frm);
+    TS_ASSERT(1 == LssMstCb.LssMstEvent_Called);
+    TS_ASSERT(CO_LSS_MST_NONE == LssMstCb.LssMstEvent_ArgEvent);
+    TS_ASSERT(1 == mst.Time);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that the fastscan finds the LSS address of a slave without node ID within the
+*         bounded number of steps, and that the found slave is addressed with a node ID.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_LssMst_Found)
+{
+    CO_NODE    node;
+    CO_LSS_MST mst;
+    uint16_t   n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1018, 1, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&LssVendor);
+    TS_ODAdd(CO_KEY(0x1018, 2, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&LssProduct);
+    TS_ODAdd(CO_KEY(0x1018, 3, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&LssRevision);
+    TS_ODAdd(CO_KEY(0x1018, 4, CO_UNSIGNED32 | CO_OBJ____R_), 0, (uintptr_t)&LssSerial);
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COLssMstInit(&mst, &node, 10, TS_LssMstEvent));
+    node.NodeId = 0xFF;                               /* slave without node ID                    */
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstFastscan(&mst));
+    for (n = 0; (n < CO_LSS_MST_STEPS) && (LssMstCb.LssMstEvent_Called == 0); n++) {
+        MstLoopback();
+        TS_Wait(&node, 10);
+    }
+    TS_ASSERT(1 == LssMstCb.LssMstEvent_Called);
+    TS_ASSERT(CO_LSS_MST_FOUND == LssMstCb.LssMstEvent_ArgEvent);
+    TS_ASSERT(CO_LSS_MST_STEPS == mst.Time);
+    TS_ASSERT(LssVendor   == mst.Id[0]);
+    TS_ASSERT(LssProduct  == mst.Id[1]);
+    TS_ASSERT(LssRevision == mst.Id[2]);
+    TS_ASSERT(LssSerial   == mst.Id[3]);
+    TS_ASSERT(CO_LSS_CONF == node.Lss.Mode);
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstNodeId(&mst, 5));
+    MstLoopback();
+    TS_ASSERT(2 == LssMstCb.LssMstEvent_Called);
+    TS_ASSERT(CO_LSS_MST_NODE_ID_OK == LssMstCb.LssMstEvent_ArgEvent);
+    TS_ASSERT(5 == node.Lss.CfgNodeId);
+    TS_ASSERT(CO_LSS_WAIT == node.Lss.Mode);
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstFastscan(&mst)); /* check no further unconfigured slave      */
+    MstLoopback();
+    TS_Wait(&node, 10);
+    TS_ASSERT(3 == LssMstCb.LssMstEvent_Called);
+    TS_ASSERT(CO_LSS_MST_NONE == LssMstCb.LssMstEvent_ArgEvent);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a node ID configuration without response is reported after the response
+*         timeout, and that invalid node IDs are rejected.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_LssMst_NodeIdTimeout)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    CO_LSS_MST mst;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COLssMstInit(&mst, &node, 10, TS_LssMstEvent));
+
+    TS_ASSERT(CO_ERR_NONE != COLssMstNodeId(&mst, 0));
+    TS_ASSERT(CO_ERR_NONE != COLssMstNodeId(&mst, 128));
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstNodeId(&mst, 5));
+    CHK_CAN  (&frm);
+    CHK_BYTE (frm, 0, 17);
+    CHK_BYTE (frm, 1, 5);
+    TS_Wait(&node, 10);
+    TS_ASSERT(1 == LssMstCb.LssMstEvent_Called);
+    TS_ASSERT(CO_LSS_MST_NODE_ID_ERR == LssMstCb.LssMstEvent_ArgEvent);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a communication reset stops a running fastscan and keeps the LSS master
+*         linked to the node.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_LssMst_Reset)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    CO_LSS_MST mst;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COLssMstInit(&mst, &node, 10, TS_LssMstEvent));
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstFastscan(&mst));
+    CONmtReset(&node.Nmt, CO_RESET_COM);              /* reset communication                      */
+    TS_ASSERT(&mst == node.Lss.Mst);
+    TS_ASSERT(CO_LSS_MST_IDLE == mst.State);
+    TS_ASSERT(-1 == mst.Tmr);
+    SimCanFlush(0);
+    TS_Wait(&node, 50);
+    CHK_NOCAN(&frm);                                  /* check no further fastscan request        */
+    TS_ASSERT(0 == LssMstCb.LssMstEvent_Called);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a fastscan response is counted once, and that the node processing without a
+*         received CAN frame is not interpreted as a response.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_LssMst_NoFrame)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    CO_LSS_MST mst;
+    uint8_t    n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == COLssMstInit(&mst, &node, 10, TS_LssMstEvent));
+
+    TS_ASSERT(CO_ERR_NONE == COLssMstFastscan(&mst));
+    CHK_CAN  (&frm);                                  /* check fastscan reset                     */
+    SetRxFrm (0, 0, CO_LSS_TX_ID, 8, CO_LSS_RES_SLAVE, 0, 0, 0, 0, 0, 0, 0);
+    for (n = 0; n < 5; n++) {
+        CONodeProcess(&node);                         /* process response, then no CAN frame      */
+    }
+    TS_ASSERT(1 == mst.Resp);
+    TS_ASSERT(0 == LssMstCb.LssMstEvent_Called);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+static void LssMstSetup(void)
+{
+    TS_CallbackInit(&LssMstCb);
+}
+
+static void LssMstCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_NMT_LSS_MST()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(LssMstSetup, LssMstCleanup);
+
+    TS_RUNNER(TS_LssMst_None);
+    TS_RUNNER(TS_LssMst_Found);
+    TS_RUNNER(TS_LssMst_NodeIdTimeout);
+    TS_RUNNER(TS_LssMst_Reset);
+    TS_RUNNER(TS_LssMst_NoFrame);
+
+    TS_End();
+}
@@ -0,0 +1,349 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK NmtMstCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a state request for several slaves is sent as a single broadcast and is
+*         confirmed by the heartbeat of the slaves.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_SetModeBroadcast)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[3] = { { 10 }, { 11 }, { 12 } };
+    uint8_t      n;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 3, TS_NmtMstEvent));
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 127);
+    }
+    TS_ASSERT(0 == CONmtMstPending(&mst, 0));
+                                                      /*------------------------------------------*/
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetMode(&mst, CO_OPERATIONAL));
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 0);                          /* check for broadcast start command        */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_ASSERT(3 == CONmtMstPending(&mst, 0));
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 5);
+    }
+    TS_ASSERT(0 == CONmtMstPending(&mst, 0));
+    TS_ASSERT(CO_OPERATIONAL == CONmtMstGetMode(&mst, 11));
+    TS_ASSERT(6 == NmtMstCb.NmtMstEvent_Called[CO_NMT_MST_STATE]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a state request is sent node specific, when a single slave is not in the
+*         requested state, and is not sent at all when all slaves are in the requested state.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_SetModeSingle)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[3] = { { 10 }, { 11 }, { 12 } };
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 3, TS_NmtMstEvent));
+    TS_HB_SEND(10, 5);
+    TS_HB_SEND(11, 127);
+    TS_HB_SEND(12, 5);
+                                                      /*------------------------------------------*/
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetMode(&mst, CO_OPERATIONAL));
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 11);                         /* check for node specific start command    */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_HB_SEND(11, 5);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetMode(&mst, CO_OPERATIONAL));
+    CHK_NOCAN   (&frm);                               /* check for no CAN frame                   */
+
+    TS_ASSERT(CO_ERR_BAD_ARG == CONmtMstSetMode(&mst, CO_INIT));
+    CHK_NOCAN   (&frm);                               /* check for no CAN frame                   */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check the network boot with a broadcast reset and the automatic start of a slave, which
+*         boots up again while the network is operational.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_BootAutoStart)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[3] = { { 10 }, { 11 }, { 12 } };
+    uint8_t      n;
+
+    slave[1].Flags = CO_NMT_MST_START;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 3, TS_NmtMstEvent));
+    TS_ASSERT(CO_ERR_NONE == CONmtMstBoot(&mst));
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 130, 0);                        /* check for broadcast reset communication  */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_ASSERT(3 == CONmtMstPending(&mst, 0));
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 0);
+    }
+    CHK_NOCAN   (&frm);                               /* check for no start in pre-operational    */
+    TS_ASSERT(0 == CONmtMstPending(&mst, 0));
+    TS_ASSERT(3 == NmtMstCb.NmtMstEvent_Called[CO_NMT_MST_BOOTUP]);
+                                                      /*------------------------------------------*/
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetMode(&mst, CO_OPERATIONAL));
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 0);                          /* check for broadcast start command        */
+    for (n = 0; n < 3; n++) {
+        TS_HB_SEND(10 + n, 5);
+    }
+
+    TS_HB_SEND(10, 0);
+    CHK_NOCAN   (&frm);                               /* check for no start without flag          */
+    TS_HB_SEND(11, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 1, 11);                         /* check for node specific start command    */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_ASSERT(CO_PREOP == CONmtMstGetMode(&mst, 10));
+    TS_ASSERT(2 == CONmtMstPending(&mst, 0));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a slave with missing heartbeat is reported lost a single time.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_Lost)
+{
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[2] = { { 10 }, { 11 } };
+
+    slave[0].Time  = 50;
+    slave[0].Flags = CO_NMT_MST_MANDATORY;
+    slave[1].Time  = 50;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 2, TS_NmtMstEvent));
+    TS_HB_SEND(10, 127);
+    TS_HB_SEND(11, 127);
+    TS_Wait(&node, 40);
+    TS_HB_SEND(11, 127);
+    TS_Wait(&node, 40);
+    TS_HB_SEND(11, 127);
+
+    TS_ASSERT(CO_INVALID == CONmtMstGetMode(&mst, 10));
+    TS_ASSERT(CO_PREOP   == CONmtMstGetMode(&mst, 11));
+    TS_ASSERT(1 == NmtMstCb.NmtMstEvent_Called[CO_NMT_MST_LOST]);
+    TS_ASSERT(1 == slave[0].Lost);
+    TS_ASSERT(1 == CONmtMstPending(&mst, 1));
+                                                      /*------------------------------------------*/
+    TS_Wait(&node, 200);
+
+    TS_ASSERT(CO_INVALID == CONmtMstGetMode(&mst, 11));
+    TS_ASSERT(2 == NmtMstCb.NmtMstEvent_Called[CO_NMT_MST_LOST]);
+    TS_ASSERT(1 == slave[0].Lost);
+    TS_ASSERT(2 == CONmtMstPending(&mst, 0));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check the node specific reset of a slave and the rejection of unknown slaves.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_ResetNode)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[2] = { { 10 }, { 11 } };
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, slave, 2, TS_NmtMstEvent));
+    TS_HB_SEND(10, 5);
+    TS_HB_SEND(11, 5);
+
+    TS_ASSERT(CO_ERR_NONE == CONmtMstReset(&mst, 11, CO_RESET_NODE));
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 129, 11);                       /* check for node specific reset node       */
+    CHK_NOCAN   (&frm);                               /* check for no more CAN frame              */
+
+    TS_ASSERT(CO_OPERATIONAL == CONmtMstGetMode(&mst, 10));
+    TS_ASSERT(CO_INVALID     == CONmtMstGetMode(&mst, 11));
+                                                      /*------------------------------------------*/
+    TS_ASSERT(CO_ERR_BAD_ARG == CONmtMstReset(&mst, 20, CO_RESET_NODE));
+    TS_ASSERT(CO_ERR_BAD_ARG == CONmtMstSetNodeMode(&mst, 20, CO_STOP));
+    CHK_NOCAN   (&frm);                               /* check for no CAN frame                   */
+
+    TS_ASSERT(CO_ERR_NONE == CONmtMstSetNodeMode(&mst, 10, CO_STOP));
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_NMT_CMD (frm, 2, 10);                         /* check for node specific stop command     */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a slave table with a double Node-ID is rejected.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_BadTable)
+{
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave[2] = { { 0 }, { 0 } };
+    int16_t      err;
+
+    slave[0].NodeId = 10;
+    slave[1].NodeId = 10;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node);
+    err = CONmtMstInit(&mst, &node, slave, 2, 0);
+
+    TS_ASSERT(CO_ERR_BAD_ARG == err);
+    TS_ASSERT(0 == node.Nmt.Mst);
+    CHK_ERR(&node, CO_ERR_BAD_ARG);                   /* check error in stack execution           */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         Check that a heartbeat of a slave reaches the heartbeat consumer of the same node, too.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_NmtMst_HbConsShared)
+{
+    CO_NODE      node;
+    CO_NMT_MST   mst;
+    CO_NMT_SLAVE slave = { 0 };
+    CO_HBCONS    data  = { 0 };
+
+    slave.NodeId = 10;
+    data.NodeId  = 10;
+    data.Time    = 50;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_UNSIGNED8|CO_OBJ_D__R_), 0, (uint32_t)1);
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_UNSIGNED32|CO_OBJ____R_), CO_THB_CONS, (uintptr_t)&data);
+    TS_CreateNode(&node);
+    TS_ASSERT(CO_ERR_NONE == CONmtMstInit(&mst, &node, &slave, 1, 0));
+
+    TS_HB_SEND(10, 5);
+
+    TS_ASSERT(CO_OPERATIONAL == CONmtMstGetMode(&mst, 10));
+    TS_ASSERT(CO_OPERATIONAL == CONmtLastHbState(&node.Nmt, 10));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+static void NmtMstSetup(void)
+{
+    TS_CallbackInit(&NmtMstCb);
+}
+
+static void NmtMstCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_NMT_MST()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(NmtMstSetup, NmtMstCleanup);
+
+    TS_RUNNER(TS_NmtMst_SetModeBroadcast);
+    TS_RUNNER(TS_NmtMst_SetModeSingle);
+    TS_RUNNER(TS_NmtMst_BootAutoStart);
+    TS_RUNNER(TS_NmtMst_Lost);
+    TS_RUNNER(TS_NmtMst_ResetNode);
+    TS_RUNNER(TS_NmtMst_BadTable);
+    TS_RUNNER(TS_NmtMst_HbConsShared);
+
+    TS_End();
+}
@@ -19,11 +19,36 @@
 ******************************************************************************/
 
 #include "def_suite.h"
+#if CO_PDO_PIMG > 0
+#include "drv_shm.h"
+#endif
+
+#if CO_RPDO_SNAPSHOT > 0
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t TsRPdoSeq;               /* RPDO sequence counter during write   */
+static int16_t  TsRPdoSnap;              /* RPDO snapshot result during write    */
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+static int16_t TS_SeqWrite(CO_OBJ *obj, struct CO_NODE_T *node, void *buf, uint32_t size)
+{
+    uint64_t val[CO_PDO_MAP_N];
+
+    TsRPdoSeq  = node->RPdo[0].Seq;
+    TsRPdoSnap = CORPdoSnapshot(&node->RPdo[0], &val[0], CO_PDO_MAP_N);
+    return (COObjWrDirect(obj, node, buf, size));
+}
+
+static const CO_OBJ_TYPE TsSeqType = { 0, 0, 0, TS_SeqWrite };
+
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC1
 *
@@ -44,14 +69,14 @@ TS_DEF_MAIN(TS_RPdo_8x1Byte)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[1]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[2]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[3]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[4]);
-    TS_ODAdd(CO_KEY(0x2500, 0x10, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[5]);
-    TS_ODAdd(CO_KEY(0x2500, 0x11, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[6]);
-    TS_ODAdd(CO_KEY(0x2500, 0x12, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data[7]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[2]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[3]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[4]);
+    TS_ODAdd(CO_KEY(0x2500, 0x10, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[5]);
+    TS_ODAdd(CO_KEY(0x2500, 0x11, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[6]);
+    TS_ODAdd(CO_KEY(0x2500, 0x12, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[7]);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x51);
@@ -98,10 +123,10 @@ TS_DEF_MAIN(TS_RPdo_4x2Byte)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x16, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&data[1]);
-    TS_ODAdd(CO_KEY(0x2500, 0x17, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&data[2]);
-    TS_ODAdd(CO_KEY(0x2500, 0x18, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&data[3]);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x16, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x17, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&data[2]);
+    TS_ODAdd(CO_KEY(0x2500, 0x18, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&data[3]);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x41);
@@ -140,8 +165,8 @@ TS_DEF_MAIN(TS_RPdo_2x4Byte)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ____RW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED32|CO_OBJ____RW), 0, (uint32_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&data[1]);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x31);
@@ -178,9 +203,9 @@ TS_DEF_MAIN(TS_RPdo_1_2_4Byte)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data8);
-    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&data16);
-    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ____RW), 0, (uint32_t)&data32);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&data16);
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&data32);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x21);
@@ -243,7 +268,7 @@ TS_DEF_MAIN(TS_RPdo_UpdateAfterSync)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x11);
@@ -276,7 +301,7 @@ TS_DEF_MAIN(TS_RPdo_UpdateType254)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0x31);
@@ -305,7 +330,7 @@ TS_DEF_MAIN(TS_RPdo_UpdateType255)
     TS_CreateMandatoryDir();
     TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
     TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uint32_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data);
     TS_CreateNodeAutoStart(&node);
 
     TS_PDO_SEND(0x201, 0xE1);
@@ -315,6 +340,228 @@ TS_DEF_MAIN(TS_RPdo_UpdateType255)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC9
+*
+*          This testcase will check the principle reception of:
+*          - PDO #0 (1 quad in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_1x8Byte)
+{
+    CO_NODE        node;
+    uint32_t     rpdo_id     = 0x40000200;
+    uint32_t     rpdo_map    = 0x25002140;
+    uint8_t     rpdo_type   = 1;
+    uint8_t     rpdo_len    = 1;
+    uint64_t     data        = 0x6162636465666768;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x21, CO_UNSIGNED64|CO_OBJ____RW), 0, (uintptr_t)&data);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x41);
+
+    TS_ASSERT(0x6162636465666768 == data); /* check signal to be unchanged             */
+
+    TS_SYNC_SEND();
+
+    TS_ASSERT(0x4847464544434241 == data); /* check signal to be changed               */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC10
+*
+*          This testcase will check the principle reception of:
+*          - PDO #0 (1 dummy byte, 1 long and 1 dummy word in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_Dummy)
+{
+    CO_NODE        node;
+    uint32_t     rpdo_id     = 0x40000200;
+    uint32_t     rpdo_map[3] = { 0x00050008, 0x25001F20, 0x00060010 };
+    uint8_t     rpdo_type   = 1;
+    uint8_t     rpdo_len    = 3;
+    uint32_t     data        = 0x71727374;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&data);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x41);
+    TS_SYNC_SEND();
+
+    TS_ASSERT(0x45444342 == data);         /* check signal behind dummy byte           */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC11
+*
+*          This testcase will check the principle reception of:
+*          - PDO #0 (2 bits, 1 dummy bit and 12 bits in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_BitMapping)
+{
+    CO_NODE        node;
+    uint32_t     rpdo_id     = 0x40000200;
+    uint32_t     rpdo_map[4] = { 0x25000B01, 0x25000C01, 0x00010001, 0x2500200C };
+    uint8_t     rpdo_type   = 255;
+    uint8_t     rpdo_len    = 4;
+    uint8_t     data[2]     = { 0x00, 0x01 };
+    uint16_t     analog      = 0xFFFF;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x41);
+
+    TS_ASSERT(0x01 == data[0]);            /* check bit 0                              */
+    TS_ASSERT(0x00 == data[1]);            /* check bit 1                              */
+    TS_ASSERT(0x0848 == analog);           /* check bit 3..14 behind dummy bit         */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#if CO_PDO_PIMG > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC12
+*
+*          This testcase will check the process image of received PDOs:
+*          - PDO #0 (1 byte and 1 word in content) in shared memory
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_ProcImage)
+{
+    CO_NODE        node;
+    CO_PIMG        pimg;
+    CO_PIMG_MEM   *mem;
+    CO_PIMG_MEM   *cons;
+    CO_PIMG_PDO   *seg;
+    int16_t        result;
+    uint32_t     rpdo_id     = 0x40000200;
+    uint32_t     rpdo_map[2] = { 0x25000B08, 0x25001510 };
+    uint8_t     rpdo_type   = 254;
+    uint8_t     rpdo_len    = 2;
+    uint8_t     data        = 0x91;
+    uint16_t     analog      = 0x8182;
+    uint64_t     val[CO_PDO_MAP_N];
+    uint8_t     pos         = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), 0, (uintptr_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    mem = SimShmCreate("/co_pimg_rpdo");              /* process image of the node                */
+    TS_ASSERT(0 != mem);
+    result = COPimgInit(&pimg, &node, mem);
+    TS_ASSERT(CO_ERR_NONE == result);
+    cons = SimShmAttach("/co_pimg_rpdo");             /* mapping of the consumer process          */
+    TS_ASSERT(0 != cons);
+
+    TS_ASSERT(CO_PIMG_MAGIC == cons->Magic);          /* check layout of RPDO #0                  */
+    TS_ASSERT(2 == cons->RPdo[0].Num);
+    TS_ASSERT(CO_DEV(0x2500, 0x0B) == cons->RPdo[0].Key[0]);
+    TS_ASSERT(CO_DEV(0x2500, 0x15) == cons->RPdo[0].Key[1]);
+    TS_ASSERT(0x91   == cons->RPdo[0].Val[0]);
+    TS_ASSERT(0x8182 == cons->RPdo[0].Val[1]);
+
+    TS_PDO_SEND(0x201, 0x41);
+
+    result = COPimgRead(&cons->RPdo[0], &val[0], CO_PDO_MAP_N);
+    TS_ASSERT(2 == result);                           /* check received values in consumer        */
+    TS_ASSERT(0x41   == val[0]);
+    TS_ASSERT(0x4342 == val[1]);
+    TS_ASSERT(0 == (cons->RPdo[0].Seq & 1));
+
+    seg = COPimgFind(cons->RPdo, cons->RPdoNum, CO_DEV(0x2500, 0x15), &pos);
+    TS_ASSERT(&cons->RPdo[0] == seg);
+    TS_ASSERT(1 == pos);
+
+    SimShmDetach(cons);
+    SimShmDetach(mem);
+    SimShmRemove("/co_pimg_rpdo");
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#endif
+
+#if CO_RPDO_SNAPSHOT > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC13
+*
+*          This testcase will check the consistent snapshot of:
+*          - PDO #0 (1 byte and 1 word in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_Snapshot)
+{
+    CO_NODE        node;
+    int16_t        result;
+    uint32_t     rpdo_id     = 0x40000200;
+    uint32_t     rpdo_map[2] = { 0x25000B08, 0x25001510 };
+    uint8_t     rpdo_type   = 254;
+    uint8_t     rpdo_len    = 2;
+    uint8_t     data        = 0x91;
+    uint16_t     analog      = 0x8182;
+    uint64_t     val[CO_PDO_MAP_N];
+    uint32_t     seq;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ____RW), (CO_OBJ_TYPE *)&TsSeqType, (uintptr_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    seq = CORPdoReadBegin(&node.RPdo[0]);            /* start lock-free read                     */
+    TS_ASSERT(0 == (seq & 1));
+    TS_ASSERT(0 == CORPdoReadRetry(&node.RPdo[0], seq));
+
+    TsRPdoSeq  = 0;
+    TsRPdoSnap = 0;
+    TS_PDO_SEND(0x201, 0x41);
+
+    TS_ASSERT(1 == (TsRPdoSeq & 1));                  /* check write in progress during write     */
+    TS_ASSERT(0 > TsRPdoSnap);                        /* check bounded snapshot during write      */
+    TS_ASSERT(0 != CORPdoReadRetry(&node.RPdo[0], seq));
+    TS_ASSERT(seq + 2 == CORPdoReadBegin(&node.RPdo[0]));
+
+    result = CORPdoSnapshot(&node.RPdo[0], &val[0], CO_PDO_MAP_N);
+    TS_ASSERT(2 == result);                           /* check snapshot of received values        */
+    TS_ASSERT(0x41   == val[0]);
+    TS_ASSERT(0x4342 == val[1]);
+    TS_ASSERT(0x41   == data);
+    TS_ASSERT(0x4342 == analog);
+
+    result = CORPdoSnapshot(&node.RPdo[0], &val[0], 1);
+    TS_ASSERT(1 == result);                           /* check limited value buffer               */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#endif
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -333,6 +580,15 @@ SUITE_PDO_RX()
     TS_RUNNER(TS_RPdo_UpdateAfterSync);
     TS_RUNNER(TS_RPdo_UpdateType254);
     TS_RUNNER(TS_RPdo_UpdateType255);
+    TS_RUNNER(TS_RPdo_1x8Byte);
+    TS_RUNNER(TS_RPdo_Dummy);
+    TS_RUNNER(TS_RPdo_BitMapping);
+#if CO_PDO_PIMG > 0
+    TS_RUNNER(TS_RPdo_ProcImage);
+#endif
+#if CO_RPDO_SNAPSHOT > 0
+    TS_RUNNER(TS_RPdo_Snapshot);
+#endif
 
 //    CanDiagnosticOff(0);
 
@@ -19,6 +19,9 @@
 ******************************************************************************/
 
 #include "def_suite.h"
+#if CO_PDO_PIMG > 0
+#include "drv_shm.h"
+#endif
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -47,14 +50,14 @@ TS_DEF_MAIN(TS_TPdo_8x1Byte)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[1]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[2]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[3]);
-    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[4]);
-    TS_ODAdd(CO_KEY(0x2500, 0x10, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[5]);
-    TS_ODAdd(CO_KEY(0x2500, 0x11, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[6]);
-    TS_ODAdd(CO_KEY(0x2500, 0x12, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data[7]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[2]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[3]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[4]);
+    TS_ODAdd(CO_KEY(0x2500, 0x10, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[5]);
+    TS_ODAdd(CO_KEY(0x2500, 0x11, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[6]);
+    TS_ODAdd(CO_KEY(0x2500, 0x12, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[7]);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -95,10 +98,10 @@ TS_DEF_MAIN(TS_TPdo_4x2Byte)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x16, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&data[1]);
-    TS_ODAdd(CO_KEY(0x2500, 0x17, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&data[2]);
-    TS_ODAdd(CO_KEY(0x2500, 0x18, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&data[3]);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x16, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x17, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&data[2]);
+    TS_ODAdd(CO_KEY(0x2500, 0x18, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&data[3]);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -135,8 +138,8 @@ TS_DEF_MAIN(TS_TPdo_2x4Byte)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uint32_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uintptr_t)&data[1]);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -173,9 +176,9 @@ TS_DEF_MAIN(TS_TPdo_1_2_4Byte)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
-    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&data16);
-    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uint32_t)&data32);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&data16);
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uintptr_t)&data32);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -241,7 +244,7 @@ TS_DEF_MAIN(TS_TPdo_After3Sync)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -283,7 +286,7 @@ TS_DEF_MAIN(TS_TPdo_OnChangeAfterSync)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_SYNC_SEND();
@@ -326,7 +329,7 @@ TS_DEF_MAIN(TS_TPdo_After240Sync)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     for (n=0; n < 239; n++) {
@@ -368,7 +371,7 @@ TS_DEF_MAIN(TS_TPdo_Type254ViaObj)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     for (n = 0; n < 256; n++) {
@@ -412,7 +415,7 @@ TS_DEF_MAIN(TS_TPdo_Type255ViaObj)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     for (n = 0; n < 256; n++) {
@@ -454,7 +457,7 @@ TS_DEF_MAIN(TS_TPdo_Type254ViaNum)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     for (n = 0; n < 256; n++) {
@@ -495,7 +498,7 @@ TS_DEF_MAIN(TS_TPdo_Type255ViaNum)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     for (n = 0; n < 256; n++) {
@@ -534,7 +537,7 @@ TS_DEF_MAIN(TS_TPdo_Tmr)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNode(&node);
 
                                                       /* wait more than 1 event timer time        */
@@ -580,7 +583,7 @@ TS_DEF_MAIN(TS_TPdo_TmrAndNum)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_Wait(&node, 200);                              /* wait 200ms                               */
@@ -639,7 +642,7 @@ TS_DEF_MAIN(TS_TPdo_Inhibit)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_Wait(&node, 200);                              /* wait 200ms                               */
@@ -700,7 +703,7 @@ TS_DEF_MAIN(TS_TPdo_TmrAndInhibit)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_Wait(&node, 70);                               /* wait 70ms                                */
@@ -756,7 +759,7 @@ TS_DEF_MAIN(TS_TPdo_ChangeTmr)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNode(&node);
 
     TS_SDO_SEND (0x22, 0x1800, 5, 200);
@@ -807,7 +810,7 @@ TS_DEF_MAIN(TS_TPdo_TmrFastest)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uint32_t)&data8);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data8);
     TS_CreateNodeAutoStart(&node);
 
     TS_Wait(&node, 210);                              /* wait 210ms                               */
@@ -872,8 +875,8 @@ TS_DEF_MAIN(TS_TPdo_Async)
     TS_CreateMandatoryDir();
     TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
     TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
-    TS_ODAdd(CO_KEY(0x2500, 0x29, CO_UNSIGNED32|CO_OBJ___PRW), CO_TASYNC, (uint32_t)&data[0]);
-    TS_ODAdd(CO_KEY(0x2500, 0x2A, CO_UNSIGNED32|CO_OBJ___PRW),         0, (uint32_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x29, CO_UNSIGNED32|CO_OBJ___PRW), CO_TASYNC, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x2A, CO_UNSIGNED32|CO_OBJ___PRW),         0, (uintptr_t)&data[1]);
     TS_CreateNodeAutoStart(&node);
 
     CODictWrLong(&node.Dict,CO_DEV(0x2500,0x29),0L);  /* write to asynchronous object entry       */
@@ -887,6 +890,262 @@ TS_DEF_MAIN(TS_TPdo_Async)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC26
+*
+*          This testcase will check the principle transmission of:
+*          - PDO #0 (1 quad in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_1x8Byte)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map     = 0x25002140;
+    uint8_t     tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t     tpdo_len     = 1;
+    uint64_t     data         = 0x7172737475767778;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x21, CO_UNSIGNED64|CO_OBJ___PRW), 0, (uintptr_t)&data);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_LONG (frm, 0, 0x75767778);
+    CHK_LONG (frm, 4, 0x71727374);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC27
+*
+*          This testcase will check the principle transmission of:
+*          - PDO #0 (4 bits and 12 bits in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_BitMapping)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[5]  = { 0x25000B01, 0x25000C01, 0x25000D01, 0x25000E01, 0x2500200C };
+    uint8_t     tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t     tpdo_len     = 5;
+    uint8_t     data[4]      = { 0x01, 0x02, 0x01, 0x01 };
+    uint16_t     analog       = 0xFABC;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[0]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[2]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data[3]);
+    TS_ODAdd(CO_KEY(0x2500, 0x20, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 2);                         /* check PDO #0 (Id and DLC)                */
+    CHK_WORD (frm, 0, 0xABCD);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC28
+*
+*          This testcase will check the rejection of a mapping entry, which
+*          is larger than the mapped object.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_BadMapLen)
+{
+    int16_t     result;
+    CO_NODE        node;
+    uint32_t     tpdo_id      = 0xC0000180;
+    uint32_t     tpdo_map     = 0;
+    uint8_t     tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t     tpdo_len     = 0;
+    uint8_t     data         = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_ODAdd(OBJ1AXX_0(0, &tpdo_len));
+    TS_ODAdd(OBJ1AXX_N(0, 1, &tpdo_map));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), 0, (uintptr_t)&data);
+    TS_CreateNode(&node);
+
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1A00,1), 0x25000B09);
+    TS_ASSERT(CO_ERR_OBJ_MAP_LEN == result);
+
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1A00,1), 0x25000B00);
+    TS_ASSERT(CO_ERR_OBJ_MAP_LEN == result);
+
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1A00,1), 0x25000B03);
+    TS_ASSERT(CO_ERR_NONE == result);
+    TS_ASSERT(0x25000B03 == tpdo_map);
+
+    CHK_ERR(&node, CO_ERR_OBJ_WRITE);                 /* check for expected error                 */
+}
+
+#if CO_PDO_PIMG > 0
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC29
+*
+*          This testcase will check the asynchronous transmission with values
+*          of the process image:
+*          - PDO #0 (1 byte and 1 word in content) in shared memory
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_ProcImage)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_PIMG        pimg;
+    CO_PIMG_MEM   *mem;
+    CO_PIMG_MEM   *cons;
+    int16_t        result;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[2]  = { 0x25000B08, 0x25001510 };
+    uint8_t     tpdo_type    = 254;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t     tpdo_len     = 2;
+    uint8_t     data         = 0x91;
+    uint16_t     analog       = 0x8182;
+    uint64_t     val[2]       = { 0x5A, 0x1234 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), CO_TASYNC, (uintptr_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW),         0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    mem = SimShmCreate("/co_pimg_tpdo");              /* process image of the node                */
+    TS_ASSERT(0 != mem);
+    result = COPimgInit(&pimg, &node, mem);
+    TS_ASSERT(CO_ERR_NONE == result);
+    cons = SimShmAttach("/co_pimg_tpdo");             /* mapping of the consumer process          */
+    TS_ASSERT(0 != cons);
+
+    TS_ASSERT(2 == cons->TPdo[0].Num);                /* check layout of TPDO #0                  */
+    TS_ASSERT(0x91   == cons->TPdo[0].Val[0]);
+    TS_ASSERT(0x8182 == cons->TPdo[0].Val[1]);
+
+    CONodeProcess(&node);                             /* unchanged image: no transmission         */
+    CHK_NOCAN(&frm);
+
+    result = COPimgWrite(&cons->TPdo[0], 0, &val[0], 2);
+    TS_ASSERT(CO_ERR_NONE == result);
+    CONodeProcess(&node);                             /* apply image to object dictionary         */
+
+    TS_ASSERT(0x5A   == data);
+    TS_ASSERT(0x1234 == analog);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 3);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x5A);
+    CHK_BYTE (frm, 1, 0x34);
+    CHK_BYTE (frm, 2, 0x12);
+
+    SimShmDetach(cons);
+    SimShmDetach(mem);
+    SimShmRemove("/co_pimg_tpdo");
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC30
+*
+*          This testcase will check, that values of the process image, which are written for a
+*          previous TPDO mapping, are not applied and the node keeps the value sequence counter:
+*          - PDO #0 (1 byte and 1 word in content) in shared memory
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_ProcImageRemap)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_PIMG        pimg;
+    CO_PIMG_MEM   *mem;
+    CO_PIMG_MEM   *cons;
+    int16_t        result;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[2]  = { 0x25000B08, 0x25001510 };
+    uint8_t     tpdo_type    = 254;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t     tpdo_len     = 2;
+    uint8_t     data         = 0x91;
+    uint16_t     analog       = 0x8182;
+    uint64_t     val[2]       = { 0x5A, 0x1234 };
+    uint32_t     seq;
+    uint32_t     map;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_UNSIGNED8 |CO_OBJ___PRW), CO_TASYNC, (uintptr_t)&data);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_UNSIGNED16|CO_OBJ___PRW),         0, (uintptr_t)&analog);
+    TS_CreateNodeAutoStart(&node);
+
+    mem = SimShmCreate("/co_pimg_remap");             /* process image of the node                */
+    TS_ASSERT(0 != mem);
+    result = COPimgInit(&pimg, &node, mem);
+    TS_ASSERT(CO_ERR_NONE == result);
+    cons = SimShmAttach("/co_pimg_remap");            /* mapping of the consumer process          */
+    TS_ASSERT(0 != cons);
+
+    result = COPimgWrite(&cons->TPdo[0], 0, &val[0], 2);
+    TS_ASSERT(CO_ERR_NONE == result);
+    seq = cons->TPdo[0].Seq;
+    map = cons->TPdo[0].Map;
+
+    COPimgTPdoMap(&pimg, 0);                          /* publish mapping before values are applied */
+    TS_ASSERT(seq     == cons->TPdo[0].Seq);          /* check value counter owned by consumer    */
+    TS_ASSERT(map + 2 == cons->TPdo[0].Map);
+    TS_ASSERT(0x5A    == cons->TPdo[0].Val[0]);
+
+    CONodeProcess(&node);                             /* values of previous mapping: discarded    */
+    TS_ASSERT(0x91   == data);
+    TS_ASSERT(0x8182 == analog);
+    CHK_NOCAN(&frm);
+
+    result = COPimgWrite(&cons->TPdo[0], 0, &val[0], 2);
+    TS_ASSERT(CO_ERR_NONE == result);
+    CONodeProcess(&node);                             /* values of current mapping: applied       */
+
+    TS_ASSERT(0x5A   == data);
+    TS_ASSERT(0x1234 == analog);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 3);                         /* check PDO #0 (Id and DLC)                */
+
+    SimShmDetach(cons);
+    SimShmDetach(mem);
+    SimShmRemove("/co_pimg_remap");
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#endif
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -916,6 +1175,13 @@ SUITE_PDO_TX()
     TS_RUNNER(TS_TPdo_ChangeTmr);
     TS_RUNNER(TS_TPdo_TmrFastest);
     TS_RUNNER(TS_TPdo_Async);
+    TS_RUNNER(TS_TPdo_1x8Byte);
+    TS_RUNNER(TS_TPdo_BitMapping);
+    TS_RUNNER(TS_TPdo_BadMapLen);
+#if CO_PDO_PIMG > 0
+    TS_RUNNER(TS_TPdo_ProcImage);
+    TS_RUNNER(TS_TPdo_ProcImageRemap);
+#endif
 
 //    CanDiagnosticOff(0);
 
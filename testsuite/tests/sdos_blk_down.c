@@ -1323,7 +1323,7 @@ TS_DEF_MAIN(TS_BlkWr_ExpWrAfter43ByteDomain)
                                                       /*------------------------------------------*/
     TS_CreateMandatoryDir();
     dom = DomCreate(idx, sub, CO_OBJ____RW, size);
-    TS_ODAdd(CO_KEY(idx2, sub2, CO_UNSIGNED32|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx2, sub2, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
                                                       /*===== INIT BLOCK DOWNLOAD ================*/
@@ -1363,6 +1363,133 @@ TS_DEF_MAIN(TS_BlkWr_ExpWrAfter43ByteDomain)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download of an array with size = 994 to a stream,
+*         which is pushed to the stream functions in block-sized chunks
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_994ByteStream)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_OBJ_DOM        *dom;
+    uint32_t     size = 994;
+    uint16_t     idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = StreamCreate(idx, sub, CO_OBJ____RW, size);
+    TS_CreateNode(&node);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 127, 0, 0);                      /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 127);                           /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+    TS_SendBlk(0x79, 15, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 15);                            /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of stream                  */
+    TS_ASSERT(2 == StreamChunks());                   /* check one stream access per block        */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download of an array with size = 300 to the
+*         Domainbuffer with a configured block size of 16 segments
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_ConfiguredBlkSize)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_OBJ_DOM        *dom;
+    uint32_t     size = 300;
+    uint16_t     idx  = 0x2100;
+    uint8_t     sub  = 1;
+    int16_t      err;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ____RW, size);
+    TS_CreateNode(&node);
+    err = COSdoSetBlkSize(node.Sdo, 0, 16);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, 16);                            /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 16, 0, 0);                       /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 16);                            /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 16);                            /* check next block size                    */
+
+    TS_SendBlk(0x70, 16, 0, 0);                       /* cont. transmit segments in block         */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 16);                            /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 16);                            /* check next block size                    */
+
+    TS_SendBlk(0xE0, 11, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 11);                            /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 16);                            /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC5, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1400,6 +1527,8 @@ SUITE_BLK_DOWN()
 //    TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte);
 //    TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte_NoLen);
     TS_RUNNER(TS_BlkWr_ExpWrAfter43ByteDomain);
+    TS_RUNNER(TS_BlkWr_994ByteStream);
+    TS_RUNNER(TS_BlkWr_ConfiguredBlkSize);
 
 
 //    CanDiagnosticOff(0);
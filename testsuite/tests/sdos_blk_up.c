@@ -1099,6 +1099,211 @@ TS_DEF_MAIN(TS_BlkRd_TwoDomains)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of a stream with size = 994, which is pulled
+*         from the stream functions in block-sized chunks
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_994ByteStream)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_OBJ_DOM        *dom ;
+    uint32_t     size = 994;
+    uint16_t     idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = StreamCreate(idx, sub, CO_OBJ____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    TS_ASSERT(2 == StreamChunks());                   /* check one stream access per block        */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#if CO_SDO_BUF_BYTE >= (CO_SDO_BUF_SEG*7*2)
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check, that the next block of a stream is read while the current
+*         block is transmitted (double buffering)
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_PrefetchStream)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_OBJ_DOM        *dom ;
+    uint32_t     size = 994;
+    uint16_t     idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = StreamCreate(idx, sub, CO_OBJ____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ASSERT(2 == StreamChunks());                   /* check next block is already read         */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ASSERT(2 == StreamChunks());                   /* check no further stream access           */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of an array with size = 300 with a configured
+*         block size of 16 segments and a block size change of the client during the transfer
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_ConfiguredBlkSize)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    CO_OBJ_DOM        *dom ;
+    uint32_t     size = 300;
+    uint16_t     idx  = 0x2520;
+    uint8_t     sub  = 6;
+    int16_t      err;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node);
+    err = COSdoSetBlkSize(node.Sdo, 0, 16);
+    TS_ASSERT(CO_ERR_NONE == err);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 16, 0, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 16, 4);                      /* reduce block size                        */
+
+    TS_ChkBlk  (0x70, 4, 0, 7);                       /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 4, CO_SDO_BUF_SEG);          /* request maximal block size               */
+
+    TS_ChkBlk  (0x8C, 16, 0, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 16, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0xFC, 7, 1, 6);                       /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 7, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC5);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check, that a stream object without stream management structure is
+*         rejected
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_StreamNullPtr)
+{
+    CO_NODE        node;
+    CO_OBJ        *obj;
+    uint8_t      buf[8];
+    uint16_t     idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_DOMAIN|CO_OBJ____RW), CO_TSTREAM, (uintptr_t)0);
+    TS_CreateNode(&node);
+
+    obj = CODictFind(&node.Dict, CO_DEV(idx, sub));
+    TS_ASSERT(0 != obj);
+    TS_ASSERT(CO_ERR_TYPE_CTRL == COObjRdBufStart(obj, &node, buf, sizeof(buf)));
+    TS_ASSERT(CO_ERR_TYPE_CTRL == COObjWrBufStart(obj, &node, buf, sizeof(buf)));
+
+                                                      /*===== INIT BLOCK UPLOAD ==================*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+    CHK_SDO0_ERR(idx, sub, 0x08000020);               /* check abort code                         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1131,6 +1336,12 @@ SUITE_BLK_UP()
     TS_RUNNER(TS_BlkRd_LenTooHighAfterRestart);
     TS_RUNNER(TS_BlkRd_BadSeqNbrAfterRestart);
     TS_RUNNER(TS_BlkRd_TwoDomains);
+    TS_RUNNER(TS_BlkRd_994ByteStream);
+    TS_RUNNER(TS_BlkRd_StreamNullPtr);
+#if CO_SDO_BUF_BYTE >= (CO_SDO_BUF_SEG*7*2)
+    TS_RUNNER(TS_BlkRd_PrefetchStream);
+#endif
+    TS_RUNNER(TS_BlkRd_ConfiguredBlkSize);
 
 //    CanDiagnosticOff(0);
 
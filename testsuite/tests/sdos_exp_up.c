@@ -59,6 +59,9 @@
 * \ref TS_ExpRd_SubIdxNotExist   | badsub | --      | --      | ok     | R
 * \ref TS_ExpRd_WriteOnly        | var    | word    | wr-only | ok     | R
 * \ref TS_ExpRd_DataNullPtr      | var    | no-data | --      | ok     | R
+* \ref TS_ExpRd_AlternatePoll     | var    | long    | none    | ok     | F
+* \ref TS_ExpRd_DictChanged       | var    | long    | none    | ok     | R
+* \ref TS_ExpRd_DictChangedIdx0   | badidx | --      | --      | ok     | R
 *
 * Type Legend: R = Robustness Test, F = Functional Test
 * @{
@@ -103,7 +106,7 @@ TS_DEF_MAIN(TS_ExpRd_1BytePara)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED8|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED8|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -148,7 +151,7 @@ TS_DEF_MAIN(TS_ExpRd_2BytePara)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -193,7 +196,7 @@ TS_DEF_MAIN(TS_ExpRd_4BytePara)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -238,7 +241,7 @@ TS_DEF_MAIN(TS_ExpRd_1ByteVar)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED8|CO_OBJ___PRW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED8|CO_OBJ___PRW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -283,7 +286,7 @@ TS_DEF_MAIN(TS_ExpRd_2ByteVar)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ___PRW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -327,7 +330,7 @@ TS_DEF_MAIN(TS_ExpRd_4ByteVar)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED32|CO_OBJ___PRW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -462,7 +465,7 @@ TS_DEF_MAIN(TS_ExpRd_2ByteParaNodeId)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ__NPRW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ__NPRW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -507,7 +510,7 @@ TS_DEF_MAIN(TS_ExpRd_BadCmd)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -596,7 +599,7 @@ TS_DEF_MAIN(TS_ExpRd_SubIdxNotExist)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ____RW), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -642,7 +645,7 @@ TS_DEF_MAIN(TS_ExpRd_WriteOnly)
 
     /* -- PREPARATION -- */
     TS_CreateMandatoryDir();
-    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ_____W), 0, (uint32_t)&val);
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED16|CO_OBJ_____W), 0, (uintptr_t)&val);
     TS_CreateNode(&node);
 
     /* -- TEST -- */
@@ -703,6 +706,172 @@ TS_DEF_MAIN(TS_ExpRd_DataNullPtr)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Read two changing variables alternately from object dictionary
+*
+* \details  This test checks, that the alternating expedited upload of two variables is
+*           answered with the current values (no stale values out of the object cache).
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including two variables of type UNSIGNED32/RW.
+*
+* ####      Test Steps
+*           1. Change both values and send SDO expedited upload request for the first variable
+*           2. Send SDO expedited upload request for the second variable
+*           3. Repeat the steps 1 and 2 for a number of times
+*
+* ####      Test Checks
+*           1. Check, that SDO server responses are correct and contain the current values
+*           2. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_AlternatePoll)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint32_t  val1 = 0;
+    uint32_t  val2 = 0;
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_ODAdd(CO_KEY(idx, 2, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    TS_CreateNode(&node);
+
+    for (n = 0; n < 10; n++) {
+        /* -- TEST -- */
+        val1 = 0x11110000 + n;
+        val2 = 0x22220000 + n;
+        TS_SDO_SEND (0x40, idx, 1, 0x00000000);
+
+        /* -- CHECK -- */
+        CHK_CAN  (&frm);
+        CHK_SDO0 (frm, 0x43);
+        CHK_MLTPX(frm, idx, 1);
+        CHK_DATA (frm, val1);
+
+        /* -- TEST -- */
+        TS_SDO_SEND (0x40, idx, 2, 0x00000000);
+
+        /* -- CHECK -- */
+        CHK_CAN  (&frm);
+        CHK_SDO0 (frm, 0x43);
+        CHK_MLTPX(frm, idx, 2);
+        CHK_DATA (frm, val2);
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Read a variable after changing the object dictionary
+*
+* \details  This test checks, that an expedited upload after re-initializing a changed object
+*           dictionary is addressing the correct object entry, even if the entry of a previous
+*           upload is moved to another position.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a variable of type UNSIGNED32/RW.
+*
+* ####      Test Steps
+*           1. Send SDO expedited upload request for the variable
+*           2. Add a new object entry in front of the variable and re-initialize the dictionary
+*           3. Send SDO expedited upload request for the variable and the new object entry
+*
+* ####      Test Checks
+*           1. Check, that SDO server responses are correct
+*           2. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_DictChanged)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint32_t  val1 = 0x11223344;
+    uint32_t  val2 = 0x55667788;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_CreateNode(&node);
+
+    TS_SDO_SEND (0x40, idx, 1, 0x00000000);
+    CHK_CAN  (&frm);
+    CHK_DATA (frm, val1);
+
+    /* -- TEST -- */
+    TS_ODAdd(CO_KEY(idx - 1, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val2);
+    CODictInit(&node.Dict, &node, node.Dict.Root, node.Dict.Max);
+
+    TS_SDO_SEND (0x40, idx, 1, 0x00000000);
+
+    /* -- CHECK -- */
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x43);
+    CHK_MLTPX(frm, idx, 1);
+    CHK_DATA (frm, val1);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x40, idx - 1, 1, 0x00000000);
+
+    /* -- CHECK -- */
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x43);
+    CHK_MLTPX(frm, idx - 1, 1);
+    CHK_DATA (frm, val2);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Read object 0000h:00 after change of object dictionary
+*
+* \details  This test checks, that the cleared object cache of the SDO server does not
+*           resolve the object 0000h:00 after a change of the object dictionary.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a variable of type UNSIGNED32/RW.
+*
+* ####      Test Steps
+*           1. Send SDO expedited upload request for the variable
+*           2. Re-initialize the dictionary
+*           3. Send SDO expedited upload request for the object 0000h:00
+*
+* ####      Test Checks
+*           1. Check, that SDO server aborts with "object does not exist"
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_DictChangedIdx0)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint32_t  val1 = 0x11223344;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, 1, CO_UNSIGNED32|CO_OBJ____RW), 0, (uintptr_t)&val1);
+    TS_CreateNode(&node);
+
+    TS_SDO_SEND (0x40, idx, 1, 0x00000000);
+    CHK_CAN  (&frm);
+    CHK_DATA (frm, val1);
+
+    /* -- TEST -- */
+    CODictInit(&node.Dict, &node, node.Dict.Root, node.Dict.Max);
+
+    TS_SDO_SEND (0x40, 0x0000, 0, 0x00000000);
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(0x0000, 0, 0x06020000);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -728,6 +897,9 @@ SUITE_EXP_UP()
     TS_RUNNER(TS_ExpRd_SubIdxNotExist);
     TS_RUNNER(TS_ExpRd_WriteOnly);
     TS_RUNNER(TS_ExpRd_DataNullPtr);
+    TS_RUNNER(TS_ExpRd_AlternatePoll);
+    TS_RUNNER(TS_ExpRd_DictChanged);
+    TS_RUNNER(TS_ExpRd_DictChangedIdx0);
 
 //    CanDiagnosticOff(0);
 
@@ -290,6 +290,53 @@ TS_DEF_MAIN(TS_SegWr_44ByteDomain)
 }
 
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the segmented download of an UNSIGNED64 value
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegWr_8ByteValue)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    uint32_t     size = 8;
+    uint16_t     idx  = 0x2310;
+    uint8_t     sub  = 1;
+    uint64_t     val  = 0;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED64|CO_OBJ____RW), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+                                                      /*===== INIT SEGMENTED DOWNLOAD  ===========*/
+    TS_SDO_SEND (0x21, idx, sub, size);
+
+    CHK_SDO0_OK(idx, sub);
+
+                                                      /*===== FIRST SEGMENTED DOWNLOAD  ==========*/
+    TS_SEG_SEND(0x00, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x20);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO (frm);                                   /* check data area                          */
+    TS_ASSERT(0 == val);                              /* check value to be unchanged              */
+
+                                                      /*===== LAST SEGMENTED DOWNLOAD  ===========*/
+    TS_SEG_SEND(0x1D, 7);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x30);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO (frm);                                   /* check data area                          */
+
+    TS_ASSERT(0x0706050403020100 == val);             /* check content of value                   */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -642,6 +689,7 @@ SUITE_SEG_DOWN()
     TS_RUNNER(TS_SegWr_41ByteDomain);
     TS_RUNNER(TS_SegWr_46ByteDomain);
     TS_RUNNER(TS_SegWr_44ByteDomain);
+    TS_RUNNER(TS_SegWr_8ByteValue);
     TS_RUNNER(TS_SegWr_BadCmd);
     TS_RUNNER(TS_SegWr_ObjNotExist);
     TS_RUNNER(TS_SegWr_SubIdxNotExist);
@@ -24,6 +24,7 @@
 *
 * + obj: object entry type
 *   - dom    : object is a domain
+*   - u64    : object is an UNSIGNED64 value
 *   - badidx : index of the object is not existing in object dictionary
 *   - badsub : subindex of the object is not existing in object dictionary
 * + size: object entry size
@@ -31,6 +32,7 @@
 *   - 6seg+1 : object value contains 6 segments plus 1 byte (=6 x 7 + 1 bytes)
 *   - 6seg-1 : object value contains 6 segments minus 1 byte (=6 x 7 - 1 bytes)
 *   - 3seg+2 : object value contains 3 segments plus 2 bytes (=3 x 7 + 2 bytes)
+*   - 1seg+1 : object value contains 1 segment plus 1 byte (=1 x 7 + 1 bytes)
 *   - no-data: object data reference is invalid (NULL)
 * + prop: object entry property
 *   - none   : no special property set
@@ -49,6 +51,7 @@
 * \ref TS_SegRd_43ByteDomain    | dom    | 6seg+1  | none    | ok     | F
 * \ref TS_SegRd_41ByteDomain    | dom    | 6seg-1  | none    | ok     | F
 * \ref TS_SegRd_23ByteString    | dom    | 3seg+2  | none    | ok     | F
+* \ref TS_SegRd_8ByteValue     | u64    | 1seg+1  | none    | ok     | F
 * \ref TS_SegRd_BadCmd          | --     | --      | --      | badcmd | R
 * \ref TS_SegRd_ObjNotExist     | badidx | --      | --      | ok     | R
 * \ref TS_SegRd_SubIdxNotExist  | badsub | --      | --      | ok     | R
@@ -299,6 +302,53 @@ TS_DEF_MAIN(TS_SegRd_23ByteString)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the segmented upload of an UNSIGNED64 value
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegRd_8ByteValue)
+{
+    CO_IF_FRM frm;
+    CO_NODE        node;
+    uint32_t     size = 8;
+    uint16_t     idx  = 0x2540;
+    uint8_t     sub  = 1;
+    uint64_t     val  = 0x0706050403020100;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_UNSIGNED64|CO_OBJ____R_), 0, (uintptr_t)&val);
+    TS_CreateNode(&node);
+
+                                                      /*===== INIT SEGMENTED UPLOAD ==============*/
+    TS_SDO_SEND (0x40, idx, sub, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x41);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX(frm, idx, sub);                         /* check multiplexer                        */
+    CHK_DATA (frm, size);                             /* check data area                          */
+
+                                                      /*===== FIRST SEGMENTED UPLOAD =============*/
+    TS_SDO_SEND(0x60, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x00);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_SEG  (frm, 0, 7);                             /* check segment data                       */
+
+                                                      /*===== LAST SEGMENTED UPLOAD ==============*/
+    TS_SDO_SEND(0x70, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x1D);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_SEG  (frm, 7, 1);                             /* check segment data                       */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -579,6 +629,7 @@ SUITE_SEG_UP()
     TS_RUNNER(TS_SegRd_43ByteDomain);
     TS_RUNNER(TS_SegRd_41ByteDomain);
     TS_RUNNER(TS_SegRd_23ByteString);
+    TS_RUNNER(TS_SegRd_8ByteValue);
     TS_RUNNER(TS_SegRd_BadCmd);
     TS_RUNNER(TS_SegRd_ObjNotExist);
     TS_RUNNER(TS_SegRd_SubIdxNotExist);
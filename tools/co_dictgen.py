@@ -0,0 +1,485 @@
+#!/usr/bin/env python3
+#
+#  Copyright 2020 Embedded Office GmbH & Co. KG
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+"""CANopen object dictionary generator.
+
+Reads an electronic data sheet (EDS), a device configuration file (DCF) or a
+hand-written description with the same INI syntax and generates the object
+dictionary of the CANopen stack as C source and header file:
+
+- the object entry table as a sorted, constant CO_OBJ array, terminated with
+  the CO_OBJ_DIR_ENDMARK
+- the RAM variables of all changeable object entries; the parameters are
+  collected in a parameter memory block (communication and application part)
+  and the default values in a constant copy of this block
+- the PDO mappable object entries as a list of ready-to-use mapping entries
+
+Usage:
+    co_dictgen.py [-n NAME] [-f FILE] [-o DIR] [--async] INPUT
+
+A minimal hand-written description contains one section per object entry:
+
+    [2100]
+    DataType=0x0007
+    AccessType=rw
+    DefaultValue=0x12345678
+"""
+
+import argparse
+import configparser
+import os
+import re
+import struct
+import sys
+
+# EDS data type -> (stack data type, C type, size in byte)
+DATATYPES = {
+    0x0001: ('CO_UNSIGNED8',  'uint8_t',  1),      # BOOLEAN
+    0x0002: ('CO_SIGNED8',    'int8_t',   1),      # INTEGER8
+    0x0003: ('CO_SIGNED16',   'int16_t',  2),      # INTEGER16
+    0x0004: ('CO_SIGNED32',   'int32_t',  4),      # INTEGER32
+    0x0005: ('CO_UNSIGNED8',  'uint8_t',  1),      # UNSIGNED8
+    0x0006: ('CO_UNSIGNED16', 'uint16_t', 2),      # UNSIGNED16
+    0x0007: ('CO_UNSIGNED32', 'uint32_t', 4),      # UNSIGNED32
+    0x0008: ('CO_UNSIGNED32', 'float',    4),      # REAL32
+    0x0011: ('CO_REAL64',     'double',   8),      # REAL64
+    0x0015: ('CO_SIGNED64',   'int64_t',  8),      # INTEGER64
+    0x001B: ('CO_UNSIGNED64', 'uint64_t', 8),      # UNSIGNED64
+}
+DT_STRING = (0x0009, 0x000A)                       # VISIBLE_, OCTET_STRING
+DT_DOMAIN = 0x000F
+
+# object entry flag macros, provided by the stack (co_obj.h)
+FLAGS = {
+    '___R_', '____W', '___RW', '__P__', '__PR_', '__P_W', '__PRW',
+    '_N___', '_N_R_', '_N__W', '_N_RW', '_NPR_', '_NP_W', '_NPRW',
+    'D____', 'D__R_', 'D___W', 'D__RW', 'DN_R_', 'DN__W', 'DN_RW',
+}
+
+SECTION = re.compile(r'^([0-9a-f]{4})(?:sub([0-9a-f]{1,2}))?$', re.I)
+
+
+class GenError(Exception):
+    """Error within the object dictionary description."""
+
+
+class Entry:
+    """A single object entry (index:subindex) of the object dictionary."""
+
+    def __init__(self, idx, sub, sec, owner=None):
+        self.idx   = idx
+        self.sub   = sub
+        self.name  = sec.get('parametername', '')
+        dtype      = sec.get('datatype', owner.get('datatype', '0x0007') if owner else '0x0007')
+        self.dtype = parse_int(dtype)[0]
+        access     = sec.get('accesstype', owner.get('accesstype', 'rw') if owner else 'rw')
+        access     = access.strip().lower()
+        if access not in ('const', 'ro', 'wo', 'rw', 'rwr', 'rww'):
+            raise GenError('%s: unknown access type %r' % (self.ident(), access))
+        self.const = (access == 'const')
+        self.rd    = (access != 'wo')
+        self.wr    = access in ('wo', 'rw', 'rwr', 'rww')
+        self.pdo   = parse_int(sec.get('pdomapping', '0'))[0] != 0
+        value      = sec.get('parametervalue', sec.get('defaultvalue', ''))
+        self.raw   = value.strip()
+        self.nodeid = False
+        self.value  = 0
+        if (self.dtype in DATATYPES) and (self.raw != ''):
+            if self.dtype in (0x0008, 0x0011):
+                self.value = float(self.raw)
+            else:
+                self.value, self.nodeid = parse_int(self.raw)
+        elif self.dtype in DT_STRING:
+            self.value = self.raw
+        elif (self.dtype not in DATATYPES) and (self.dtype != DT_DOMAIN):
+            raise GenError('%s: unsupported data type 0x%04X' % (self.ident(), self.dtype))
+        self.type   = '0'        # object type reference
+        self.data   = '0'        # object data reference
+        self.flags  = ''         # object entry flags
+        self.member = ''         # name of RAM variable (struct member)
+
+    def key(self):
+        return (self.idx << 16) | (self.sub << 8)
+
+    def ident(self):
+        return '%04X:%02X' % (self.idx, self.sub)
+
+    def tag(self):
+        return '%04X_%02X' % (self.idx, self.sub)
+
+    def size(self):
+        return DATATYPES[self.dtype][2] if self.dtype in DATATYPES else 0
+
+    def ctype(self):
+        return DATATYPES[self.dtype][1]
+
+    def literal(self):
+        """C literal of the (default) value."""
+        ctype = self.ctype()
+        if ctype in ('float', 'double'):
+            text = repr(float(self.value))
+            return text + ('f' if ctype == 'float' else '')
+        if self.dtype == 0x0015:
+            return '(int64_t)%dLL' % self.value
+        if self.dtype == 0x001B:
+            return '0x%XULL' % (self.value & 0xFFFFFFFFFFFFFFFF)
+        if ctype.startswith('int'):
+            return '%d' % self.value
+        return '0x%X' % (self.value & ((1 << (8 * self.size())) - 1))
+
+    def bits(self):
+        """Unsigned bit pattern of the (default) value."""
+        if self.dtype == 0x0008:
+            return struct.unpack('<I', struct.pack('<f', self.value))[0]
+        if self.dtype == 0x0011:
+            return struct.unpack('<Q', struct.pack('<d', self.value))[0]
+        return self.value & ((1 << (8 * self.size())) - 1)
+
+
+def parse_int(text):
+    """Parse an EDS integer value; returns (value, node-id relative)."""
+    text   = text.strip()
+    nodeid = False
+    if '$nodeid' in text.lower():
+        nodeid = True
+        text   = re.sub(r'\$nodeid', '', text, flags=re.I)
+        text   = text.replace('+', ' ').strip()
+    if text == '':
+        return (0, nodeid)
+    try:
+        if text.lower().startswith(('0x', '-0x')):
+            return (int(text, 16), nodeid)
+        if (len(text) > 1) and text.startswith('0') and text.isdigit():
+            return (int(text, 8), nodeid)
+        return (int(text, 10), nodeid)
+    except ValueError:
+        raise GenError('bad integer value %r' % text)
+
+
+def read_entries(path):
+    """Read all object entries of the given EDS, DCF or description file."""
+    ini = configparser.ConfigParser(strict=False, interpolation=None,
+                                    comment_prefixes=(';', '#'),
+                                    inline_comment_prefixes=(';',))
+    with open(path, encoding='latin-1') as f:
+        ini.read_file(f)
+
+    entries = {}
+    owners  = {}
+    for name in ini.sections():
+        m = SECTION.match(name)
+        if (m is not None) and (m.group(2) is None):
+            owners[int(m.group(1), 16)] = ini[name]
+
+    for name in ini.sections():
+        m = SECTION.match(name)
+        if m is None:
+            continue
+        idx = int(m.group(1), 16)
+        sec = ini[name]
+        if m.group(2) is None:
+            objtype = parse_int(sec.get('objecttype', '0x7'))[0]
+            if objtype in (0x8, 0x9):
+                if 'compactsubobj' in sec:
+                    add_compact(entries, idx, sec)
+                continue
+            ent = Entry(idx, 0, sec)
+        else:
+            ent = Entry(idx, int(m.group(2), 16), sec, owners.get(idx))
+        if ent.key() in entries:
+            raise GenError('%s: duplicate object entry' % ent.ident())
+        entries[ent.key()] = ent
+
+    return [entries[k] for k in sorted(entries)]
+
+
+def add_compact(entries, idx, sec):
+    """Expand an array with the EDS keyword CompactSubObj."""
+    num  = parse_int(sec['compactsubobj'])[0]
+    head = {'parametername': 'Number of entries', 'datatype': '0x0005',
+            'accesstype': 'ro', 'defaultvalue': str(num)}
+    ent  = Entry(idx, 0, head)
+    entries[ent.key()] = ent
+    for sub in range(1, num + 1):
+        ent = Entry(idx, sub, sec)
+        entries[ent.key()] = ent
+
+
+def special_type(ent):
+    """Object type reference of the communication profile entries."""
+    idx, sub = ent.idx, ent.sub
+    if idx == 0x1003:
+        return 'CO_TEMCY'
+    if (idx in (0x1010, 0x1011)) and (sub > 0):
+        return 'CO_TPARA'
+    if idx in (0x1014, 0x1015):
+        return 'CO_TEMCY_CFG'
+    if (idx == 0x1016) and (sub > 0):
+        return 'CO_THB_CONS'
+    if idx == 0x1017:
+        return 'CO_THB_PROD'
+    if (0x1200 <= idx <= 0x127F) and (sub in (1, 2)):
+        return 'CO_TSDOID'
+    if 0x1400 <= idx <= 0x15FF:
+        return {1: 'CO_TPDOID', 2: 'CO_TPDOTYPE'}.get(sub)
+    if (0x1600 <= idx <= 0x17FF) or (0x1A00 <= idx <= 0x1BFF):
+        return 'CO_TPDONUM' if sub == 0 else 'CO_TPDOMAP'
+    if 0x1800 <= idx <= 0x19FF:
+        return {1: 'CO_TPDOID', 2: 'CO_TPDOTYPE', 5: 'CO_TEVENT'}.get(sub)
+    return None
+
+
+class Dictionary:
+    """Generator for the object dictionary C source and header file."""
+
+    def __init__(self, entries, name, tpdo_async):
+        self.entries = entries
+        self.name    = name
+        self.macro   = re.sub(r'(?<!^)(?=[A-Z])', '_', name).upper()
+        self.com     = []        # communication parameters
+        self.app     = []        # application parameters
+        self.var     = []        # process data and read only variables
+        self.const   = []        # constant values, not fitting into entry
+        self.strs    = []        # string objects
+        self.hbcons  = []        # heartbeat consumer objects
+        self.doms    = []        # application provided domains
+        self.paranum = 0         # number of application provided CO_PARA
+        for ent in entries:
+            self.classify(ent, tpdo_async)
+
+    def classify(self, ent, tpdo_async):
+        stype = special_type(ent)
+        d = '_'
+        n = 'N' if ent.nodeid else '_'
+        p = 'P' if ent.pdo else '_'
+        r = 'R' if ent.rd else '_'
+        w = 'W' if ent.wr else '_'
+
+        if ent.dtype in DT_STRING:
+            if ent.wr:
+                raise GenError('%s: strings are read only' % ent.ident())
+            ent.type = 'CO_TSTRING'
+            ent.data = '(uintptr_t)&%sStr%s' % (self.name, ent.tag())
+            self.strs.append(ent)
+        elif ent.dtype == DT_DOMAIN:
+            ent.type = 'CO_TDOMAIN'
+            ent.data = '(uintptr_t)&%sDom%s' % (self.name, ent.tag())
+            self.doms.append(ent)
+        elif stype == 'CO_TPARA':
+            ent.type = stype
+            ent.data = '(uintptr_t)&%sParaObj[%d]' % (self.name, ent.sub - 1)
+            self.paranum = max(self.paranum, ent.sub)
+        elif stype == 'CO_THB_CONS':
+            ent.type = stype
+            ent.data = '(uintptr_t)&%sHbCons%s' % (self.name, ent.tag())
+            self.hbcons.append(ent)
+        elif (stype is None) and ent.const:
+            if ent.size() <= 4:
+                d = 'D'
+                ent.data = '(uintptr_t)0x%X' % ent.bits()
+            else:
+                ent.data = '(uintptr_t)&%sConst%s' % (self.name, ent.tag())
+                self.const.append(ent)
+        else:
+            if stype is not None:
+                ent.type = stype
+            elif tpdo_async and ent.pdo and ent.rd:
+                ent.type = 'CO_TASYNC'
+            ent.member = 'Obj%s' % ent.tag()
+            if ent.wr and not ent.pdo:
+                group = self.com if ent.idx < 0x2000 else self.app
+                part  = 'Com' if ent.idx < 0x2000 else 'App'
+                group.append(ent)
+                ent.data = '(uintptr_t)&%sPara.%s.%s' % (self.name, part, ent.member)
+            else:
+                self.var.append(ent)
+                ent.data = '(uintptr_t)&%sVar.%s' % (self.name, ent.member)
+
+        flags = d + n + p + r + w
+        if flags in FLAGS:
+            ent.flags = 'CO_OBJ_' + flags
+        else:
+            parts = [f for (c, f) in ((d, 'CO_OBJ_D____'), (n, 'CO_OBJ__N___'),
+                                      (p, 'CO_OBJ___P__')) if c != '_']
+            parts.append('CO_OBJ____' + r + w)
+            ent.flags = '(%s)' % '|'.join(parts)
+        if ent.dtype in DATATYPES:
+            ent.flags = '%s|%s' % (DATATYPES[ent.dtype][0], ent.flags)
+        else:
+            ent.flags = 'CO_DOMAIN|%s' % ent.flags
+
+    def pdo_map(self):
+        return [e for e in self.entries if e.pdo and (e.size() > 0)]
+
+    @staticmethod
+    def members(group):
+        """Struct members, sorted by size for a dense memory layout."""
+        return sorted(group, key=lambda e: (-e.size(), e.key()))
+
+    def struct(self, tname, group):
+        lines = ['typedef struct %s_T {' % tname]
+        for ent in self.members(group):
+            lines.append('    %-9s %s;%s' % (ent.ctype(), ent.member, comment(ent)))
+        lines.append('} %s;' % tname)
+        lines.append('')
+        return lines
+
+    def header(self, fname):
+        m, n = self.macro, self.name
+        guard = re.sub(r'\W', '_', fname).upper() + '_'
+        out = banner()
+        out += ['#ifndef %s' % guard, '#define %s' % guard, '']
+        out += section('INCLUDES')
+        out += ['#include "co_core.h"', '']
+        out += section('PUBLIC DEFINES')
+        out += ['#define %-16s %5d  /*!< number of object entries        */'
+                % (m + '_DICT_N', len(self.entries))]
+        if self.pdo_map():
+            out += ['#define %-16s %5d  /*!< number of PDO mappable entries  */'
+                    % (m + '_PDO_N', len(self.pdo_map()))]
+        out += ['',
+                '/*! \\brief OBJECT DICTIONARY',
+                '*',
+                '*    The generated object dictionary for the node specification. The',
+                '*    specification member DictLen shall be set to (%s_DICT_N + 1).' % m,
+                '*/',
+                '#define %s_DICT  ((CO_OBJ *)&%sDict[0])' % (m, n), '']
+        out += section('PUBLIC TYPES')
+        if self.com:
+            out += self.struct(m + '_COM_PARA_MEM', self.com)
+        if self.app:
+            out += self.struct(m + '_APP_PARA_MEM', self.app)
+        if self.com or self.app:
+            out += ['typedef struct %s_PARA_MEM_T {' % m]
+            if self.com:
+                out += ['    %s_COM_PARA_MEM Com;' % m]
+            if self.app:
+                out += ['    %s_APP_PARA_MEM App;' % m]
+            out += ['} %s_PARA_MEM;' % m, '']
+        if self.var:
+            out += self.struct(m + '_VAR_MEM', self.var)
+        out += section('PUBLIC VARIABLES')
+        out += ['extern const CO_OBJ %sDict[%s_DICT_N + 1];' % (n, m)]
+        if self.pdo_map():
+            out += ['extern const uint32_t %sPdoMap[%s_PDO_N];' % (n, m)]
+        if self.com or self.app:
+            out += ['extern %s_PARA_MEM %sPara;' % (m, n),
+                    'extern const %s_PARA_MEM %sParaDef;' % (m, n)]
+        if self.var:
+            out += ['extern %s_VAR_MEM %sVar;' % (m, n)]
+        out += ['']
+        if self.paranum or self.doms:
+            out += section('APPLICATION PROVIDED VARIABLES')
+            if self.paranum:
+                out += ['extern CO_PARA %sParaObj[%d];' % (n, self.paranum)]
+            for ent in self.doms:
+                out += ['extern CO_OBJ_DOM %sDom%s;' % (n, ent.tag())]
+            out += ['']
+        out += ['#endif  /* #ifndef %s */' % guard]
+        return out
+
+    def source(self, fname):
+        m, n = self.macro, self.name
+        out = banner()
+        out += section('INCLUDES')
+        out += ['#include "%s.h"' % fname, '']
+        out += section('PRIVATE VARIABLES')
+        for ent in self.const:
+            out += ['static const %s %sConst%s = %s;' % (ent.ctype(), n, ent.tag(), ent.literal())]
+        for ent in self.strs:
+            out += ['static CO_OBJ_STR %sStr%s = { 0, (uint8_t *)%s };'
+                    % (n, ent.tag(), c_string(ent.value))]
+        for ent in self.hbcons:
+            out += ['static CO_HBCONS %sHbCons%s = { .Time = %d, .NodeId = %d };'
+                    % (n, ent.tag(), ent.value & 0xFFFF, (ent.value >> 16) & 0xFF)]
+        out += ['']
+        out += section('PUBLIC VARIABLES')
+        if self.com or self.app:
+            init = []
+            if self.com:
+                init += ['    {'] + self.init(self.com) + ['    },']
+            if self.app:
+                init += ['    {'] + self.init(self.app) + ['    },']
+            out += ['%s_PARA_MEM %sPara = {' % (m, n)] + init + ['};', '']
+            out += ['const %s_PARA_MEM %sParaDef = {' % (m, n)] + init + ['};', '']
+        if self.var:
+            out += ['%s_VAR_MEM %sVar = {' % (m, n)]
+            out += [line[4:] for line in self.init(self.var)]
+            out += ['};', '']
+        pdo = self.pdo_map()
+        if pdo:
+            out += ['const uint32_t %sPdoMap[%s_PDO_N] = {' % (n, m)]
+            out += ['    0x%04X%02X%02X,  /* %s */' % (e.idx, e.sub, e.size() * 8, e.name)
+                    for e in pdo]
+            out += ['};', '']
+        out += ['const CO_OBJ %sDict[%s_DICT_N + 1] = {' % (n, m)]
+        for ent in self.entries:
+            out += ['    { CO_KEY(0x%04X, 0x%02X, %s), %s, %s },'
+                    % (ent.idx, ent.sub, ent.flags, ent.type, ent.data)]
+        out += ['    CO_OBJ_DIR_ENDMARK', '};']
+        return out
+
+    def init(self, group):
+        return ['        %s,%s' % (e.literal(), comment(e)) for e in self.members(group)]
+
+
+def comment(ent):
+    return '  /* %s %s */' % (ent.ident(), ent.name.replace('*/', '')) if ent.name else \
+           '  /* %s */' % ent.ident()
+
+
+def c_string(text):
+    return '"%s"' % text.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def banner():
+    return ['/* This file is generated by co_dictgen.py - DO NOT EDIT */', '']
+
+
+def section(title):
+    return ['/' + '*' * 78, '* ' + title, '*' * 78 + '/', '']
+
+
+def main():
+    parser = argparse.ArgumentParser(description='CANopen object dictionary generator')
+    parser.add_argument('input', help='EDS, DCF or object dictionary description')
+    parser.add_argument('-n', '--name', default='App',
+                        help='name prefix of generated symbols (default: App)')
+    parser.add_argument('-f', '--file', default=None,
+                        help='base name of generated files (default: input name)')
+    parser.add_argument('-o', '--output', default='.',
+                        help='output directory (default: .)')
+    parser.add_argument('--async', dest='tpdo_async', action='store_true',
+                        help='trigger TPDOs on change of readable PDO mappable entries')
+    args = parser.parse_args()
+
+    fname = args.file or os.path.splitext(os.path.basename(args.input))[0]
+    try:
+        entries = read_entries(args.input)
+        od      = Dictionary(entries, args.name, args.tpdo_async)
+    except (GenError, configparser.Error, OSError) as err:
+        sys.stderr.write('co_dictgen: %s\n' % err)
+        return 1
+
+    os.makedirs(args.output, exist_ok=True)
+    for ext, lines in (('.h', od.header(fname)), ('.c', od.source(fname))):
+        with open(os.path.join(args.output, fname + ext), 'w') as f:
+            f.write('\n'.join(lines) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())